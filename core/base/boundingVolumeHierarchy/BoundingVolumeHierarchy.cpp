@@ -0,0 +1,708 @@
+#include <BoundingVolumeHierarchy.h>
+
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#define MODULE_S "[BoundingVolumeHierarchy] "
+
+namespace {
+
+  inline float dot(const float *const u, const float *const v) {
+    return u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+  }
+
+  inline void cross(const float *const u, const float *const v, float *const w) {
+    w[0] = u[1] * v[2] - u[2] * v[1];
+    w[1] = u[2] * v[0] - u[0] * v[2];
+    w[2] = u[0] * v[1] - u[1] * v[0];
+  }
+
+  inline float sqDistance(const float *const u, const float *const v) {
+    const float d[3] = {u[0] - v[0], u[1] - v[1], u[2] - v[2]};
+    return dot(d, d);
+  }
+
+  // closest point to p in triangle (a, b, c), from Ericson, Real-Time
+  // Collision Detection, 5.1.5
+  void closestPointInTriangle(const float *const p,
+                              const float *const a,
+                              const float *const b,
+                              const float *const c,
+                              float *const res) {
+
+    const float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    const float ap[3] = {p[0] - a[0], p[1] - a[1], p[2] - a[2]};
+
+    const auto set = [&](const float *const o, const float *const dir,
+                         const float t) {
+      for(int k = 0; k < 3; k++) {
+        res[k] = o[k] + t * dir[k];
+      }
+    };
+
+    // vertex region a
+    const float d1 = dot(ab, ap);
+    const float d2 = dot(ac, ap);
+    if(d1 <= 0.0F && d2 <= 0.0F) {
+      set(a, ab, 0.0F);
+      return;
+    }
+
+    // vertex region b
+    const float bp[3] = {p[0] - b[0], p[1] - b[1], p[2] - b[2]};
+    const float d3 = dot(ab, bp);
+    const float d4 = dot(ac, bp);
+    if(d3 >= 0.0F && d4 <= d3) {
+      set(b, ab, 0.0F);
+      return;
+    }
+
+    // edge region ab
+    const float vc = d1 * d4 - d3 * d2;
+    if(vc <= 0.0F && d1 >= 0.0F && d3 <= 0.0F) {
+      set(a, ab, d1 / (d1 - d3));
+      return;
+    }
+
+    // vertex region c
+    const float cp[3] = {p[0] - c[0], p[1] - c[1], p[2] - c[2]};
+    const float d5 = dot(ab, cp);
+    const float d6 = dot(ac, cp);
+    if(d6 >= 0.0F && d5 <= d6) {
+      set(c, ac, 0.0F);
+      return;
+    }
+
+    // edge region ac
+    const float vb = d5 * d2 - d1 * d6;
+    if(vb <= 0.0F && d2 >= 0.0F && d6 <= 0.0F) {
+      set(a, ac, d2 / (d2 - d6));
+      return;
+    }
+
+    // edge region bc
+    const float va = d3 * d6 - d5 * d4;
+    if(va <= 0.0F && (d4 - d3) >= 0.0F && (d5 - d6) >= 0.0F) {
+      const float bc[3] = {c[0] - b[0], c[1] - b[1], c[2] - b[2]};
+      set(b, bc, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+      return;
+    }
+
+    // face region
+    const float denom = va + vb + vc;
+    if(denom == 0.0F) {
+      // degenerate triangle
+      set(a, ab, 0.0F);
+      return;
+    }
+    const float v = vb / denom;
+    const float w = vc / denom;
+    for(int k = 0; k < 3; k++) {
+      res[k] = a[k] + ab[k] * v + ac[k] * w;
+    }
+  }
+
+  // signed abscissa along the (unitary) direction of the intersection between
+  // the line and triangle (a, b, c) (two-sided Moller-Trumbore)
+  bool intersectTriangle(const float *const o,
+                         const float *const dir,
+                         const float *const a,
+                         const float *const b,
+                         const float *const c,
+                         float &t) {
+
+    const float eps = powf(10, -FLT_DIG);
+
+    const float e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+
+    // skip triangles whose plane is parallel to the line
+    float n[3];
+    cross(e1, e2, n);
+    const float nMag = std::sqrt(dot(n, n));
+    if(nMag == 0.0F || std::abs(dot(dir, n)) < eps * nMag) {
+      return false;
+    }
+
+    float pv[3];
+    cross(dir, e2, pv);
+    const float invDet = 1.0F / dot(e1, pv);
+
+    const float tv[3] = {o[0] - a[0], o[1] - a[1], o[2] - a[2]};
+    const float u = dot(tv, pv) * invDet;
+    if(u < -eps || u > 1.0F + eps) {
+      return false;
+    }
+
+    float qv[3];
+    cross(tv, e1, qv);
+    const float v = dot(dir, qv) * invDet;
+    if(v < -eps || u + v > 1.0F + eps) {
+      return false;
+    }
+
+    t = dot(e2, qv) * invDet;
+    return true;
+  }
+
+  // signed abscissa along the (unitary) direction of the intersection between
+  // the ray and triangle (a, b, c), uv gets the barycentric coordinates
+  // relative to b and c
+  //
+  // Contrary to intersectTriangle(), computations are done in double
+  // precision: for rays cast from far away onto small triangles, the single
+  // precision rounding errors on the barycentric coordinates exceed the
+  // tolerance and rays slip between adjacent triangles.
+  bool intersectRayTriangle(const float *const o,
+                            const float *const dir,
+                            const float *const a,
+                            const float *const b,
+                            const float *const c,
+                            float &t,
+                            float *const uv) {
+
+    const double e1[3] = {(double)b[0] - a[0], (double)b[1] - a[1],
+                          (double)b[2] - a[2]};
+    const double e2[3] = {(double)c[0] - a[0], (double)c[1] - a[1],
+                          (double)c[2] - a[2]};
+
+    const double pv[3] = {dir[1] * e2[2] - dir[2] * e2[1],
+                          dir[2] * e2[0] - dir[0] * e2[2],
+                          dir[0] * e2[1] - dir[1] * e2[0]};
+    const double det = e1[0] * pv[0] + e1[1] * pv[1] + e1[2] * pv[2];
+    // parallel or degenerate triangle
+    if(det == 0.0) {
+      return false;
+    }
+    const double invDet = 1.0 / det;
+
+    const double tv[3] = {(double)o[0] - a[0], (double)o[1] - a[1],
+                          (double)o[2] - a[2]};
+    const double u = (tv[0] * pv[0] + tv[1] * pv[1] + tv[2] * pv[2]) * invDet;
+    if(u < 0.0 || u > 1.0) {
+      return false;
+    }
+
+    const double qv[3] = {tv[1] * e1[2] - tv[2] * e1[1],
+                          tv[2] * e1[0] - tv[0] * e1[2],
+                          tv[0] * e1[1] - tv[1] * e1[0]};
+    const double v
+      = (dir[0] * qv[0] + dir[1] * qv[1] + dir[2] * qv[2]) * invDet;
+    if(v < 0.0 || u + v > 1.0) {
+      return false;
+    }
+
+    t = (e2[0] * qv[0] + e2[1] * qv[1] + e2[2] * qv[2]) * invDet;
+    uv[0] = u;
+    uv[1] = v;
+    return true;
+  }
+
+} // namespace
+
+std::pair<ttk::SimplexId, ttk::SimplexId>
+  ttk::BoundingVolumeHierarchy::nodeCount(const SimplexId n) const {
+
+  // median splits: the sizes of the two children of a node holding n
+  // triangles are floor(n/2) and ceil(n/2)
+  if(n + 1 <= leafSize_) {
+    return std::make_pair(1, 1);
+  }
+
+  const auto half = nodeCount(n / 2);
+
+  if(n % 2 == 0) {
+    return std::make_pair(
+      n <= leafSize_ ? 1 : 1 + 2 * half.first, 1 + half.first + half.second);
+  }
+  return std::make_pair(
+    n <= leafSize_ ? 1 : 1 + half.first + half.second, 1 + 2 * half.second);
+}
+
+void ttk::BoundingVolumeHierarchy::buildNode(const SimplexId nodeId,
+                                             const SimplexId begin,
+                                             const SimplexId end,
+                                             const float *const centroids,
+                                             const float *const bounds) {
+
+  Node &node = nodes_[nodeId];
+  node.begin = begin;
+  node.end = end;
+  node.left = -1;
+  node.right = -1;
+
+  const float inf = std::numeric_limits<float>::infinity();
+
+  if(end - begin <= leafSize_) {
+    node.lo = {inf, inf, inf};
+    node.hi = {-inf, -inf, -inf};
+    for(SimplexId i = begin; i < end; i++) {
+      const float *const b = &bounds[6 * static_cast<size_t>(order_[i])];
+      for(int k = 0; k < 3; k++) {
+        node.lo[k] = std::min(node.lo[k], b[k]);
+        node.hi[k] = std::max(node.hi[k], b[3 + k]);
+      }
+    }
+    return;
+  }
+
+  // split along the widest extent of the centroids
+  std::array<float, 3> clo{inf, inf, inf}, chi{-inf, -inf, -inf};
+  for(SimplexId i = begin; i < end; i++) {
+    const float *const c = &centroids[3 * static_cast<size_t>(order_[i])];
+    for(int k = 0; k < 3; k++) {
+      clo[k] = std::min(clo[k], c[k]);
+      chi[k] = std::max(chi[k], c[k]);
+    }
+  }
+  int axis = 0;
+  for(int k = 1; k < 3; k++) {
+    if(chi[k] - clo[k] > chi[axis] - clo[axis]) {
+      axis = k;
+    }
+  }
+
+  const SimplexId mid = begin + (end - begin) / 2;
+  std::nth_element(order_.begin() + begin, order_.begin() + mid,
+                   order_.begin() + end,
+                   [&](const SimplexId a, const SimplexId b) {
+                     return centroids[3 * static_cast<size_t>(a) + axis]
+                            < centroids[3 * static_cast<size_t>(b) + axis];
+                   });
+
+  // children indices follow the pre-allocated depth-first layout
+  const SimplexId left = nodeId + 1;
+  const SimplexId right = left + nodeCount(mid - begin).first;
+  node.left = left;
+  node.right = right;
+
+  if(end - begin > taskSize_) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp task firstprivate(left, begin, mid)
+#endif // TTK_ENABLE_OPENMP
+    buildNode(left, begin, mid, centroids, bounds);
+    buildNode(right, mid, end, centroids, bounds);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp taskwait
+#endif // TTK_ENABLE_OPENMP
+  } else {
+    buildNode(left, begin, mid, centroids, bounds);
+    buildNode(right, mid, end, centroids, bounds);
+  }
+
+  for(int k = 0; k < 3; k++) {
+    node.lo[k] = std::min(nodes_[left].lo[k], nodes_[right].lo[k]);
+    node.hi[k] = std::max(nodes_[left].hi[k], nodes_[right].hi[k]);
+  }
+}
+
+int ttk::BoundingVolumeHierarchy::build(Triangulation *const triangulation) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(triangulation == nullptr) {
+    return -1;
+  }
+#endif // TTK_ENABLE_KAMIKAZE
+
+  Timer t;
+
+  clear();
+
+  const SimplexId triangleNumber = triangulation->getNumberOfTriangles();
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(triangleNumber <= 0) {
+    return -2;
+  }
+#endif // TTK_ENABLE_KAMIKAZE
+
+  const size_t nTriangles = static_cast<size_t>(triangleNumber);
+
+  // triangle coordinates, bounding boxes and centroids
+  std::vector<float> points(9 * nTriangles);
+  std::vector<float> bounds(6 * nTriangles);
+  std::vector<float> centroids(3 * nTriangles);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nTriangles; i++) {
+    float *const p = &points[9 * i];
+    for(int j = 0; j < 3; j++) {
+      SimplexId v;
+      triangulation->getTriangleVertex(i, j, v);
+      triangulation->getVertexPoint(v, p[3 * j], p[3 * j + 1], p[3 * j + 2]);
+    }
+    for(int k = 0; k < 3; k++) {
+      bounds[6 * i + k] = std::min(std::min(p[k], p[3 + k]), p[6 + k]);
+      bounds[6 * i + 3 + k] = std::max(std::max(p[k], p[3 + k]), p[6 + k]);
+      centroids[3 * i + k] = (p[k] + p[3 + k] + p[6 + k]) / 3.0F;
+    }
+  }
+
+  order_.resize(nTriangles);
+  std::iota(order_.begin(), order_.end(), 0);
+  nodes_.resize(nodeCount(triangleNumber).first);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#pragma omp single nowait
+#endif // TTK_ENABLE_OPENMP
+  buildNode(0, 0, triangleNumber, centroids.data(), bounds.data());
+
+  // store the triangle coordinates in leaf order
+  points_.resize(9 * nTriangles);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < nTriangles; i++) {
+    const float *const src = &points[9 * static_cast<size_t>(order_[i])];
+    std::copy(src, src + 9, &points_[9 * i]);
+  }
+
+  triangulation_ = triangulation;
+
+  {
+    std::stringstream msg;
+    msg << MODULE_S "Built hierarchy over " << triangleNumber << " triangles ("
+        << nodes_.size() << " nodes) in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " thread(s))." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+void ttk::BoundingVolumeHierarchy::clear() {
+  triangulation_ = nullptr;
+  nodes_.clear();
+  order_.clear();
+  points_.clear();
+}
+
+ttk::SimplexId ttk::BoundingVolumeHierarchy::closestPoint(
+  const float *const p, float *const res, Scratch &scratch) const {
+
+  scratch.trianglesTested = 0;
+  if(nodes_.empty()) {
+    return -1;
+  }
+
+  SimplexId best = -1;
+  float bestDist = std::numeric_limits<float>::infinity();
+
+  auto &stack = scratch.stack;
+  stack.clear();
+  stack.emplace_back(0);
+
+  while(!stack.empty()) {
+    const Node &node = nodes_[stack.back()];
+    stack.pop_back();
+
+    if(boxSqDistance(node, p) >= bestDist) {
+      continue;
+    }
+
+    if(node.left == -1) {
+      for(SimplexId i = node.begin; i < node.end; i++) {
+        const float *const tp = trianglePoints(i);
+        float q[3];
+        closestPointInTriangle(p, tp, tp + 3, tp + 6, q);
+        const float d = sqDistance(p, q);
+        if(d < bestDist) {
+          bestDist = d;
+          best = i;
+          std::copy(q, q + 3, res);
+        }
+      }
+      scratch.trianglesTested += node.end - node.begin;
+      continue;
+    }
+
+    // visit the nearest child first
+    const float dl = boxSqDistance(nodes_[node.left], p);
+    const float dr = boxSqDistance(nodes_[node.right], p);
+    if(dl < dr) {
+      stack.emplace_back(node.right);
+      stack.emplace_back(node.left);
+    } else {
+      stack.emplace_back(node.left);
+      stack.emplace_back(node.right);
+    }
+  }
+
+  return best == -1 ? -1 : order_[best];
+}
+
+ttk::SimplexId ttk::BoundingVolumeHierarchy::intersectLine(
+  const float *const origin,
+  const float *const direction,
+  float *const res,
+  Scratch &scratch) const {
+
+  scratch.trianglesTested = 0;
+  if(nodes_.empty()) {
+    return -1;
+  }
+
+  const float mag = std::sqrt(dot(direction, direction));
+  if(!(mag > 0.0F)) {
+    return -1;
+  }
+  const float dir[3]
+    = {direction[0] / mag, direction[1] / mag, direction[2] / mag};
+
+  // lower bound of the distance from origin to the intersections of the line
+  // with the box of a node (infinity if none)
+  const auto boxDistance = [&](const Node &node) {
+    float tmin = -std::numeric_limits<float>::infinity();
+    float tmax = std::numeric_limits<float>::infinity();
+    for(int k = 0; k < 3; k++) {
+      if(dir[k] == 0.0F) {
+        if(origin[k] < node.lo[k] || origin[k] > node.hi[k]) {
+          return std::numeric_limits<float>::infinity();
+        }
+        continue;
+      }
+      const float t0 = (node.lo[k] - origin[k]) / dir[k];
+      const float t1 = (node.hi[k] - origin[k]) / dir[k];
+      tmin = std::max(tmin, std::min(t0, t1));
+      tmax = std::min(tmax, std::max(t0, t1));
+    }
+    if(tmin > tmax) {
+      return std::numeric_limits<float>::infinity();
+    }
+    if(tmin > 0.0F) {
+      return tmin;
+    }
+    if(tmax < 0.0F) {
+      return -tmax;
+    }
+    return 0.0F;
+  };
+
+  SimplexId best = -1;
+  float bestDist = std::numeric_limits<float>::infinity();
+  float bestT = 0.0F;
+
+  auto &stack = scratch.stack;
+  stack.clear();
+  stack.emplace_back(0);
+
+  while(!stack.empty()) {
+    const Node &node = nodes_[stack.back()];
+    stack.pop_back();
+
+    if(boxDistance(node) >= bestDist) {
+      continue;
+    }
+
+    if(node.left == -1) {
+      for(SimplexId i = node.begin; i < node.end; i++) {
+        const float *const tp = trianglePoints(i);
+        float tHit;
+        if(intersectTriangle(origin, dir, tp, tp + 3, tp + 6, tHit)
+           && std::abs(tHit) < bestDist) {
+          bestDist = std::abs(tHit);
+          bestT = tHit;
+          best = i;
+        }
+      }
+      scratch.trianglesTested += node.end - node.begin;
+      continue;
+    }
+
+    const float dl = boxDistance(nodes_[node.left]);
+    const float dr = boxDistance(nodes_[node.right]);
+    if(dl < dr) {
+      stack.emplace_back(node.right);
+      stack.emplace_back(node.left);
+    } else {
+      stack.emplace_back(node.left);
+      stack.emplace_back(node.right);
+    }
+  }
+
+  if(best == -1) {
+    return -1;
+  }
+
+  for(int k = 0; k < 3; k++) {
+    res[k] = origin[k] + bestT * dir[k];
+  }
+  return order_[best];
+}
+
+ttk::SimplexId
+  ttk::BoundingVolumeHierarchy::intersectRay(const float *const origin,
+                                             const float *const direction,
+                                             const float tMin,
+                                             const float tMax,
+                                             float &t,
+                                             float *const uv,
+                                             Scratch &scratch) const {
+
+  scratch.trianglesTested = 0;
+  if(nodes_.empty()) {
+    return -1;
+  }
+
+  const float mag = std::sqrt(dot(direction, direction));
+  if(!(mag > 0.0F)) {
+    return -1;
+  }
+  const float dir[3]
+    = {direction[0] / mag, direction[1] / mag, direction[2] / mag};
+  // infinite for null components, handled by the slab test below
+  const float invDir[3] = {1.0F / dir[0], 1.0F / dir[1], 1.0F / dir[2]};
+
+  // entry abscissa of the ray in the box of a node, clipped to the current
+  // ray interval (infinity if the box is missed)
+  const auto boxEntry = [&](const Node &node, const float tEnd) {
+    float t0 = tMin;
+    float t1 = tEnd;
+    for(int k = 0; k < 3; k++) {
+      if(dir[k] == 0.0F) {
+        if(origin[k] < node.lo[k] || origin[k] > node.hi[k]) {
+          return std::numeric_limits<float>::infinity();
+        }
+        continue;
+      }
+      const float ta = (node.lo[k] - origin[k]) * invDir[k];
+      const float tb = (node.hi[k] - origin[k]) * invDir[k];
+      t0 = std::max(t0, std::min(ta, tb));
+      t1 = std::min(t1, std::max(ta, tb));
+    }
+    return t0 <= t1 ? t0 : std::numeric_limits<float>::infinity();
+  };
+
+  SimplexId best = -1;
+  float bestT = tMax;
+  float bestUV[2] = {0.0F, 0.0F};
+
+  auto &stack = scratch.stack;
+  stack.clear();
+  stack.emplace_back(0);
+
+  while(!stack.empty()) {
+    const Node &node = nodes_[stack.back()];
+    stack.pop_back();
+
+    // the nearest intersection may have moved since the node was pushed
+    if(boxEntry(node, bestT) == std::numeric_limits<float>::infinity()) {
+      continue;
+    }
+
+    if(node.left == -1) {
+      for(SimplexId i = node.begin; i < node.end; i++) {
+        const float *const tp = trianglePoints(i);
+        float tHit, uvHit[2];
+        if(intersectRayTriangle(origin, dir, tp, tp + 3, tp + 6, tHit, uvHit)
+           && tHit >= tMin && tHit <= bestT) {
+          bestT = tHit;
+          bestUV[0] = uvHit[0];
+          bestUV[1] = uvHit[1];
+          best = i;
+        }
+      }
+      scratch.trianglesTested += node.end - node.begin;
+      continue;
+    }
+
+    // children hit before the current nearest intersection, the nearest one
+    // is traversed first
+    const float tl = boxEntry(nodes_[node.left], bestT);
+    const float tr = boxEntry(nodes_[node.right], bestT);
+    const bool hitL = tl < std::numeric_limits<float>::infinity();
+    const bool hitR = tr < std::numeric_limits<float>::infinity();
+    if(hitL && hitR) {
+      if(tl < tr) {
+        stack.emplace_back(node.right);
+        stack.emplace_back(node.left);
+      } else {
+        stack.emplace_back(node.left);
+        stack.emplace_back(node.right);
+      }
+    } else if(hitL) {
+      stack.emplace_back(node.left);
+    } else if(hitR) {
+      stack.emplace_back(node.right);
+    }
+  }
+
+  if(best == -1) {
+    return -1;
+  }
+
+  t = bestT;
+  if(uv != nullptr) {
+    uv[0] = bestUV[0];
+    uv[1] = bestUV[1];
+  }
+  return order_[best];
+}
+
+ttk::SimplexId ttk::BoundingVolumeHierarchy::nearestVertex(
+  const float *const p, Scratch &scratch) const {
+
+  scratch.trianglesTested = 0;
+  if(nodes_.empty()) {
+    return -1;
+  }
+
+  // every vertex belonging to a triangle lies in the box of its leaf
+  SimplexId best = -1;
+  int bestLocal = 0;
+  float bestDist = std::numeric_limits<float>::infinity();
+
+  auto &stack = scratch.stack;
+  stack.clear();
+  stack.emplace_back(0);
+
+  while(!stack.empty()) {
+    const Node &node = nodes_[stack.back()];
+    stack.pop_back();
+
+    if(boxSqDistance(node, p) >= bestDist) {
+      continue;
+    }
+
+    if(node.left == -1) {
+      for(SimplexId i = node.begin; i < node.end; i++) {
+        const float *const tp = trianglePoints(i);
+        for(int j = 0; j < 3; j++) {
+          const float d = sqDistance(p, tp + 3 * j);
+          if(d < bestDist) {
+            bestDist = d;
+            best = i;
+            bestLocal = j;
+          }
+        }
+      }
+      scratch.trianglesTested += node.end - node.begin;
+      continue;
+    }
+
+    const float dl = boxSqDistance(nodes_[node.left], p);
+    const float dr = boxSqDistance(nodes_[node.right], p);
+    if(dl < dr) {
+      stack.emplace_back(node.right);
+      stack.emplace_back(node.left);
+    } else {
+      stack.emplace_back(node.left);
+      stack.emplace_back(node.right);
+    }
+  }
+
+  if(best == -1) {
+    return -1;
+  }
+
+  SimplexId vertexId;
+  triangulation_->getTriangleVertex(order_[best], bestLocal, vertexId);
+  return vertexId;
+}
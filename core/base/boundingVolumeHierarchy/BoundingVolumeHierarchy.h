@@ -0,0 +1,161 @@
+/// \ingroup base
+/// \class ttk::BoundingVolumeHierarchy
+///
+/// \brief TTK bounding volume hierarchy over the triangles of a surface
+/// triangulation.
+///
+/// The hierarchy is built once per input triangulation (median splits along
+/// the widest centroid axis, subtrees built in parallel with OpenMP tasks)
+/// and stores the triangle coordinates in leaf order. It answers the
+/// following queries:
+///   - closestPoint(): closest point on the surface,
+///   - intersectLine(): intersection of a line with the surface nearest to
+///   a given origin (e.g. projection alongside a normal),
+///   - intersectRay(): first intersection of a ray with the surface (e.g.
+///   ray casting),
+///   - nearestVertex(): nearest triangulation vertex (belonging to a
+///   triangle).
+///
+/// Queries are read-only and thread-safe. Each thread should use its own
+/// BoundingVolumeHierarchy::Scratch instance so that no allocation happens
+/// per query.
+///
+/// \sa ttk::QuadrangulationSubdivision
+
+#pragma once
+
+// base code includes
+#include <Triangulation.h>
+#include <Wrapper.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace ttk {
+
+  class BoundingVolumeHierarchy : public Debug {
+
+  public:
+    /// Per-thread query buffers.
+    struct Scratch {
+      // traversal stack (node indices)
+      std::vector<SimplexId> stack{};
+      // number of triangles tested during the last query
+      size_t trianglesTested{};
+    };
+
+    /// Build the hierarchy over the triangles of the given triangulation.
+    /// \return 0 upon success, negative values otherwise.
+    int build(Triangulation *const triangulation);
+
+    /// Release the hierarchy.
+    void clear();
+
+    /// Check if the hierarchy is built for the given triangulation.
+    inline bool isBuilt(const Triangulation *const triangulation) const {
+      return triangulation_ == triangulation && !nodes_.empty();
+    }
+
+    inline size_t getNumberOfNodes() const {
+      return nodes_.size();
+    }
+
+    /// Find the closest point to p on the surface.
+    /// \param p Input query point.
+    /// \param res Output closest point.
+    /// \param scratch Per-thread query buffers.
+    /// \return Identifier of the triangle containing res, -1 if empty.
+    SimplexId closestPoint(const float *const p,
+                           float *const res,
+                           Scratch &scratch) const;
+
+    /// Intersect the line (origin, direction) with the surface.
+    /// \param origin Input line origin.
+    /// \param direction Input line direction (not necessarily unitary).
+    /// \param res Output intersection nearest to origin.
+    /// \param scratch Per-thread query buffers.
+    /// \return Identifier of the intersected triangle, -1 if no
+    /// intersection.
+    SimplexId intersectLine(const float *const origin,
+                            const float *const direction,
+                            float *const res,
+                            Scratch &scratch) const;
+
+    /// Find the first intersection of the ray (origin, direction) with the
+    /// surface inside the abscissa interval [tMin, tMax].
+    /// \param origin Input ray origin.
+    /// \param direction Input ray direction (not necessarily unitary).
+    /// \param tMin Input lower bound of the ray interval.
+    /// \param tMax Input upper bound of the ray interval.
+    /// \param t Output abscissa of the intersection along the normalized
+    /// direction.
+    /// \param uv Output barycentric coordinates of the intersection relative
+    /// to the second and third triangle vertices (may be nullptr).
+    /// \param scratch Per-thread query buffers.
+    /// \return Identifier of the intersected triangle, -1 if no
+    /// intersection.
+    SimplexId intersectRay(const float *const origin,
+                           const float *const direction,
+                           const float tMin,
+                           const float tMax,
+                           float &t,
+                           float *const uv,
+                           Scratch &scratch) const;
+
+    /// Find the triangulation vertex nearest to p.
+    /// \param p Input query point.
+    /// \param scratch Per-thread query buffers.
+    /// \return Identifier of the nearest vertex, -1 if empty.
+    SimplexId nearestVertex(const float *const p, Scratch &scratch) const;
+
+  protected:
+    struct Node {
+      // bounding box
+      std::array<float, 3> lo;
+      std::array<float, 3> hi;
+      // range of triangles in order_ (leaves)
+      SimplexId begin;
+      SimplexId end;
+      // children (-1 for leaves)
+      SimplexId left;
+      SimplexId right;
+    };
+
+    // number of nodes of the subtrees holding n and n + 1 triangles
+    std::pair<SimplexId, SimplexId> nodeCount(const SimplexId n) const;
+
+    void buildNode(const SimplexId nodeId,
+                   const SimplexId begin,
+                   const SimplexId end,
+                   const float *const centroids,
+                   const float *const bounds);
+
+    // squared distance between p and the box of a node
+    inline float boxSqDistance(const Node &node, const float *const p) const {
+      float res = 0.0F;
+      for(int k = 0; k < 3; k++) {
+        const float d = std::max(
+          std::max(node.lo[k] - p[k], 0.0F), std::max(p[k] - node.hi[k], 0.0F));
+        res += d * d;
+      }
+      return res;
+    }
+
+    // triangle coordinates in leaf order (9 floats per triangle)
+    inline const float *trianglePoints(const SimplexId i) const {
+      return &points_[9 * static_cast<size_t>(i)];
+    }
+
+    // maximum number of triangles per leaf
+    const SimplexId leafSize_{4};
+    // minimum number of triangles for a subtree to be built in a task
+    const SimplexId taskSize_{4096};
+
+    Triangulation *triangulation_{};
+    std::vector<Node> nodes_{};
+    // triangle identifiers in leaf order
+    std::vector<SimplexId> order_{};
+    std::vector<float> points_{};
+  };
+} // namespace ttk
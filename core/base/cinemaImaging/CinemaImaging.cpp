@@ -0,0 +1,178 @@
+#include <CinemaImaging.h>
+
+#include <cmath>
+
+#define MODULE_S "[CinemaImaging] "
+
+int ttk::CinemaImaging::setupTriangulation(Triangulation *const triangulation) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(triangulation == nullptr) {
+    dMsg(std::cerr, MODULE_S "Error: null triangulation.\n", fatalMsg);
+    return -1;
+  }
+  if(triangulation->getDimensionality() != 2) {
+    dMsg(std::cerr, MODULE_S "Error: the input is not a surface triangulation.\n",
+         fatalMsg);
+    return -2;
+  }
+#endif
+
+  triangulation_ = triangulation;
+
+  if(bvh_.isBuilt(triangulation_)) {
+    return 0;
+  }
+
+  Timer t;
+
+  bvh_.setThreadNumber(threadNumber_);
+  bvh_.setDebugLevel(debugLevel_);
+  if(bvh_.build(triangulation_) != 0) {
+    return -3;
+  }
+
+  {
+    std::stringstream msg;
+    msg << MODULE_S "Indexed " << triangulation_->getNumberOfCells()
+        << " triangles (" << bvh_.getNumberOfNodes() << " nodes) in "
+        << t.getElapsedTime() << " s." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+void ttk::CinemaImaging::clear() {
+  bvh_.clear();
+}
+
+int ttk::CinemaImaging::renderImages(const size_t cameraNumber,
+                                     const double *const camPositions,
+                                     const double *const camFocus,
+                                     const double *const camUp,
+                                     const double *const camNearFar,
+                                     const double camHeight,
+                                     const int *const resolution,
+                                     float *const *const depthImages,
+                                     SimplexId *const primitiveIds,
+                                     float *const barycentrics) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(triangulation_ == nullptr || !bvh_.isBuilt(triangulation_))
+    return -1;
+  if(camPositions == nullptr || camFocus == nullptr || camUp == nullptr
+     || camNearFar == nullptr || resolution == nullptr
+     || depthImages == nullptr || primitiveIds == nullptr
+     || barycentrics == nullptr)
+    return -2;
+  if(resolution[0] <= 0 || resolution[1] <= 0)
+    return -3;
+  if(!(camNearFar[1] > camNearFar[0]))
+    return -4;
+#endif
+
+  Timer t;
+
+  const size_t width = resolution[0];
+  const size_t height = resolution[1];
+  const size_t imageSize = width * height;
+
+  // Camera and pixel sizes in world coordinates
+  const double camWidth = ((double)width) / ((double)height) * camHeight;
+  const double pixelWidthWorld = camWidth / width;
+  const double pixelHeightWorld = camHeight / height;
+
+  const float camNear = camNearFar[0];
+  const float camFar = camNearFar[1];
+  const float invDelta = 1.0F / (camFar - camNear);
+
+  // Rows of all the rendered images are processed in parallel (the hit cost
+  // of a row depends on the visible geometry)
+  const SimplexId rowNumber = cameraNumber * height;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    BoundingVolumeHierarchy::Scratch scratch{};
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for(SimplexId r = 0; r < rowNumber; r++) {
+      const size_t c = r / height;
+      const size_t y = r % height;
+      const double *const camPos = &camPositions[3 * c];
+
+      // Camera frame (see DepthImageBasedGeometryApproximation)
+      double camDir[3] = {camFocus[0] - camPos[0], camFocus[1] - camPos[1],
+                          camFocus[2] - camPos[2]};
+      double temp = std::sqrt(camDir[0] * camDir[0] + camDir[1] * camDir[1]
+                              + camDir[2] * camDir[2]);
+      camDir[0] /= temp;
+      camDir[1] /= temp;
+      camDir[2] /= temp;
+
+      // camRight = camDir x camUp
+      double camRight[3] = {camDir[1] * camUp[2] - camDir[2] * camUp[1],
+                            camDir[2] * camUp[0] - camDir[0] * camUp[2],
+                            camDir[0] * camUp[1] - camDir[1] * camUp[0]};
+      temp = std::sqrt(camRight[0] * camRight[0] + camRight[1] * camRight[1]
+                       + camRight[2] * camRight[2]);
+      camRight[0] /= temp;
+      camRight[1] /= temp;
+      camRight[2] /= temp;
+
+      // true up vector: camRight x camDir
+      const double camUpTrue[3]
+        = {camRight[1] * camDir[2] - camRight[2] * camDir[1],
+           camRight[2] * camDir[0] - camRight[0] * camDir[2],
+           camRight[0] * camDir[1] - camRight[1] * camDir[0]};
+
+      // origin of the first pixel of the row (half pixel offset to cast rays
+      // through pixel centers)
+      const double v = (y + 0.5) * pixelHeightWorld - 0.5 * camHeight;
+      const double u0 = 0.5 * pixelWidthWorld - 0.5 * camWidth;
+      double rowOrigin[3];
+      for(int k = 0; k < 3; k++)
+        rowOrigin[k] = camPos[k] + v * camUpTrue[k] + u0 * camRight[k];
+
+      const float dir[3]
+        = {(float)camDir[0], (float)camDir[1], (float)camDir[2]};
+
+      float *const depth = depthImages[c] + y * width;
+      const size_t offset = c * imageSize + y * width;
+      for(size_t x = 0; x < width; x++) {
+        const double u = x * pixelWidthWorld;
+        const float origin[3] = {(float)(rowOrigin[0] + u * camRight[0]),
+                                 (float)(rowOrigin[1] + u * camRight[1]),
+                                 (float)(rowOrigin[2] + u * camRight[2])};
+
+        float tHit = 0.0F;
+        const size_t p = offset + x;
+        const SimplexId triangleId = bvh_.intersectRay(
+          origin, dir, camNear, camFar, tHit, &barycentrics[2 * p], scratch);
+
+        primitiveIds[p] = triangleId;
+        if(triangleId == -1) {
+          depth[x] = 1.0F;
+          barycentrics[2 * p] = 0.0F;
+          barycentrics[2 * p + 1] = 0.0F;
+        } else {
+          depth[x] = (tHit - camNear) * invDelta;
+        }
+      }
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << MODULE_S "Rendered " << cameraNumber << " images (" << width << "x"
+        << height << ") in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " thread(s))." << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 0;
+}
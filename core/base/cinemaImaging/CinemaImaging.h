@@ -0,0 +1,199 @@
+/// \ingroup base
+/// \class ttk::CinemaImaging
+///
+/// \brief TTK %cinemaImaging processing package.
+///
+/// %CinemaImaging is a TTK processing package that renders images of a
+/// surface triangulation without any graphics context. It casts one ray per
+/// pixel through a bounding volume hierarchy of the triangles, using the
+/// same orthographic camera model as ttk::DepthImageBasedGeometryApproximation,
+/// and records for each pixel:
+///   - the normalized depth ((t - near) / (far - near), 1 for the
+///   background), i.e. the content of an OpenGL depth buffer with a parallel
+///   projection,
+///   - the identifier of the visible triangle (-1 for the background),
+///   - the barycentric coordinates of the visible point in this triangle.
+///
+/// Vertex data are then interpolated with interpolateVertexData() and cell
+/// data are looked up with lookupCellData() (NaN for the background, as the
+/// floating point value passes of VTK).
+///
+/// The hierarchy is only built once per triangulation and the pixels of the
+/// rendered cameras are processed in parallel. Large camera samplings are
+/// meant to be rendered in batches of cameras, which bounds the memory used
+/// by the primitive identifiers and barycentric coordinates to the batch.
+///
+/// \sa ttkCinemaImaging
+/// \sa ttk::BoundingVolumeHierarchy
+/// \sa ttk::DepthImageBasedGeometryApproximation
+
+#pragma once
+
+// base code includes
+#include <BoundingVolumeHierarchy.h>
+#include <Triangulation.h>
+#include <Wrapper.h>
+
+#include <limits>
+#include <vector>
+
+namespace ttk {
+
+  class CinemaImaging : public Debug {
+
+  public:
+    /// Set the surface triangulation to render and index its triangles.
+    /// The hierarchy is only rebuilt if the triangulation changed or after
+    /// a call to clear().
+    /// \return 0 upon success, negative values otherwise.
+    int setupTriangulation(Triangulation *const triangulation);
+
+    /// Release the hierarchy.
+    void clear();
+
+    /// Render depth images of the surface (typically for a batch of
+    /// cameras).
+    /// \param cameraNumber Number of cameras.
+    /// \param camPositions Camera positions (3 values per camera).
+    /// \param camFocus Camera focal point (shared by all cameras).
+    /// \param camUp Camera up vector (shared by all cameras).
+    /// \param camNearFar Near and far clipping planes.
+    /// \param camHeight Height of the orthographic viewport.
+    /// \param resolution Image resolution (width, height).
+    /// \param depthImages Output normalized depth values, one image per
+    /// camera (row-major, first row at the bottom), e.g. the arrays of the
+    /// output images.
+    /// \param primitiveIds Output visible triangle identifiers (-1 for the
+    /// background), for all the cameras one image after the other.
+    /// \param barycentrics Output barycentric coordinates of the visible
+    /// points relative to the second and third triangle vertices (2 values
+    /// per pixel), for all the cameras one image after the other.
+    /// \return 0 upon success, negative values otherwise.
+    int renderImages(const size_t cameraNumber,
+                     const double *const camPositions,
+                     const double *const camFocus,
+                     const double *const camUp,
+                     const double *const camNearFar,
+                     const double camHeight,
+                     const int *const resolution,
+                     float *const *const depthImages,
+                     SimplexId *const primitiveIds,
+                     float *const barycentrics) const;
+
+    /// Interpolate one component of a vertex data array at the visible
+    /// points of rendered images.
+    /// \param data Input vertex data array.
+    /// \param componentNumber Number of components of the data array.
+    /// \param component Component to interpolate.
+    /// \param pixelNumber Number of pixels.
+    /// \param primitiveIds Input visible triangle identifiers.
+    /// \param barycentrics Input barycentric coordinates.
+    /// \param output Output pixel values (NaN for the background).
+    /// \return 0 upon success, negative values otherwise.
+    template <class dataType>
+    int interpolateVertexData(const dataType *const data,
+                              const int componentNumber,
+                              const int component,
+                              const size_t pixelNumber,
+                              const SimplexId *const primitiveIds,
+                              const float *const barycentrics,
+                              float *const output) const;
+
+    /// Look up one component of a cell data array at the visible triangles
+    /// of rendered images.
+    /// \param data Input cell data array.
+    /// \param componentNumber Number of components of the data array.
+    /// \param component Component to look up.
+    /// \param pixelNumber Number of pixels.
+    /// \param primitiveIds Input visible triangle identifiers.
+    /// \param output Output pixel values (NaN for the background).
+    /// \return 0 upon success, negative values otherwise.
+    template <class dataType>
+    int lookupCellData(const dataType *const data,
+                       const int componentNumber,
+                       const int component,
+                       const size_t pixelNumber,
+                       const SimplexId *const primitiveIds,
+                       float *const output) const;
+
+  protected:
+    Triangulation *triangulation_{};
+    BoundingVolumeHierarchy bvh_{};
+  };
+} // namespace ttk
+
+template <class dataType>
+int ttk::CinemaImaging::interpolateVertexData(
+  const dataType *const data,
+  const int componentNumber,
+  const int component,
+  const size_t pixelNumber,
+  const SimplexId *const primitiveIds,
+  const float *const barycentrics,
+  float *const output) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(triangulation_ == nullptr || data == nullptr || primitiveIds == nullptr
+     || barycentrics == nullptr || output == nullptr)
+    return -1;
+  if(component < 0 || component >= componentNumber)
+    return -2;
+#endif
+
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < (SimplexId)pixelNumber; i++) {
+    const SimplexId triangleId = primitiveIds[i];
+    if(triangleId == -1) {
+      output[i] = nan;
+      continue;
+    }
+
+    SimplexId v[3];
+    for(int j = 0; j < 3; j++)
+      triangulation_->getTriangleVertex(triangleId, j, v[j]);
+
+    const float u = barycentrics[2 * i];
+    const float w = barycentrics[2 * i + 1];
+    output[i] = (1.0F - u - w) * data[v[0] * componentNumber + component]
+                + u * data[v[1] * componentNumber + component]
+                + w * data[v[2] * componentNumber + component];
+  }
+
+  return 0;
+}
+
+template <class dataType>
+int ttk::CinemaImaging::lookupCellData(
+  const dataType *const data,
+  const int componentNumber,
+  const int component,
+  const size_t pixelNumber,
+  const SimplexId *const primitiveIds,
+  float *const output) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(data == nullptr || primitiveIds == nullptr || output == nullptr)
+    return -1;
+  if(component < 0 || component >= componentNumber)
+    return -2;
+#endif
+
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  // on surface triangulations, triangle and cell identifiers are the same
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < (SimplexId)pixelNumber; i++) {
+    const SimplexId triangleId = primitiveIds[i];
+    output[i] = triangleId == -1
+                  ? nan
+                  : data[triangleId * componentNumber + component];
+  }
+
+  return 0;
+}
@@ -1,5 +1,8 @@
 #include <CinemaQuery.h>
 
+#include <algorithm>
+#include <sys/stat.h>
+
 #if TTK_ENABLE_SQLITE3
 #include <sqlite3.h>
 
@@ -23,6 +26,25 @@ static int processRow(void *data, int argc, char **argv, char **azColName) {
 
   return 0;
 }
+
+// Read the first value of a query result
+static int processValue(void *data, int argc, char **argv, char **) {
+  string &value = *((string *)data);
+  if(argc > 0 && argv[0] != nullptr)
+    value = argv[0];
+  return 0;
+}
+
+// Quote a SQL identifier
+static string quoteIdentifier(const string &name) {
+  string quoted = "\"";
+  for(auto c : name) {
+    if(c == '"')
+      quoted += '"';
+    quoted += c;
+  }
+  return quoted + "\"";
+}
 #endif
 
 ttk::CinemaQuery::CinemaQuery() {
@@ -137,3 +159,320 @@ int ttk::CinemaQuery::execute(const string &sqlTableDefinition,
 
   return 1;
 }
+
+int ttk::CinemaQuery::execute(const string &databaseFile,
+                              const string &sourceFile,
+                              const string &tableSignature,
+                              const vector<string> &columnNames,
+                              const vector<bool> &isNumeric,
+                              const size_t &nRows,
+                              const CellGetter &getCell,
+                              const vector<string> &indexedColumns,
+                              const string &sqlQuery,
+                              string &resultCSV) const {
+
+#if TTK_ENABLE_SQLITE3
+  sqlite3 *db = nullptr;
+  Timer t;
+
+  // The cache is identified by the table layout and the source file state
+  string signature = "";
+  if(databaseFile != "") {
+    struct stat sourceStat;
+    if(stat(sourceFile.data(), &sourceStat) == 0) {
+      stringstream s;
+      s << sourceFile << "|" << sourceStat.st_size << "|"
+        << sourceStat.st_mtime << "|" << tableSignature << "|" << nRows;
+      for(size_t i = 0; i < columnNames.size(); i++)
+        s << "|" << columnNames[i] << (isNumeric[i] ? " REAL" : " TEXT");
+      signature = s.str();
+    }
+  }
+
+  if(signature == "" || !this->openDatabase(databaseFile, db)) {
+    if(databaseFile != "")
+      dMsg(cout,
+           "[ttkCinemaQuery] Unable to use the database cache, importing in "
+           "memory.\n",
+           infoMsg);
+    if(!this->openDatabase(":memory:", db))
+      return 0;
+    signature = "";
+  }
+
+  // Check if the cached table is up to date
+  string cachedSignature = "";
+  if(signature != "")
+    sqlite3_exec(db, "SELECT value FROM ttkCacheInfo WHERE key='signature'",
+                 processValue, (void *)(&cachedSignature), nullptr);
+
+  if(signature == "" || cachedSignature != signature) {
+    if(!this->importTable(
+         db, columnNames, isNumeric, nRows, getCell, signature)) {
+      sqlite3_close(db);
+      return 0;
+    }
+  } else {
+    stringstream msg;
+    msg << "[ttkCinemaQuery] Using cached database `" << databaseFile << "'."
+        << endl;
+    dMsg(cout, msg.str(), infoMsg);
+  }
+
+  if(!this->createIndices(db, columnNames, indexedColumns)) {
+    sqlite3_close(db);
+    return 0;
+  }
+
+  // The user query must not alter the persistent table (its signature would
+  // remain valid), so it is run on a read-only connection
+  if(signature != "") {
+    sqlite3_close(db);
+    db = nullptr;
+    if(sqlite3_open_v2(
+         databaseFile.data(), &db, SQLITE_OPEN_READONLY, nullptr)
+       != SQLITE_OK) {
+      stringstream msg;
+      msg << "[ttkCinemaQuery] ERROR: Unable to reopen database `"
+          << databaseFile << "'." << endl;
+      msg << "[ttkCinemaQuery]         - " << sqlite3_errmsg(db) << endl;
+      dMsg(cout, msg.str(), fatalMsg);
+      sqlite3_close(db);
+      return 0;
+    }
+  }
+
+  if(!this->query(db, sqlQuery, resultCSV)) {
+    sqlite3_close(db);
+    return 0;
+  }
+
+  sqlite3_close(db);
+
+  {
+    stringstream msg;
+    msg << "[ttkCinemaQuery] Query processed in " << t.getElapsedTime()
+        << " s." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+#else
+  dMsg(
+    cout, "[ttkCinemaQuery] ERROR: This filter requires Sqlite3.\n", fatalMsg);
+#endif
+
+  return 1;
+}
+
+int ttk::CinemaQuery::openDatabase(const string &databaseFile,
+                                   sqlite3 *&db) const {
+#if TTK_ENABLE_SQLITE3
+  int rc = sqlite3_open(databaseFile.data(), &db);
+  if(rc == SQLITE_OK) // fails on read-only locations
+    rc = sqlite3_exec(db,
+                      "CREATE TABLE IF NOT EXISTS ttkCacheInfo (key TEXT "
+                      "PRIMARY KEY, value TEXT)",
+                      nullptr, 0, nullptr);
+  if(rc != SQLITE_OK) {
+    stringstream msg;
+    msg << "[ttkCinemaQuery] Unable to open database `" << databaseFile
+        << "'." << endl;
+    msg << "[ttkCinemaQuery]         - " << sqlite3_errmsg(db) << endl;
+    dMsg(cout, msg.str(), infoMsg);
+    sqlite3_close(db);
+    db = nullptr;
+    return 0;
+  }
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+int ttk::CinemaQuery::importTable(sqlite3 *db,
+                                  const vector<string> &columnNames,
+                                  const vector<bool> &isNumeric,
+                                  const size_t &nRows,
+                                  const CellGetter &getCell,
+                                  const string &signature) const {
+#if TTK_ENABLE_SQLITE3
+  dMsg(cout, "[ttkCinemaQuery] Creating database ... ", timeMsg);
+  Timer t;
+
+  const size_t nc = columnNames.size();
+  char *zErrMsg = 0;
+
+  auto error = [&](const string &message) {
+    stringstream msg;
+    msg << "failed\n[ttkCinemaQuery] ERROR: " << message << endl;
+    dMsg(cout, msg.str(), fatalMsg);
+    if(zErrMsg)
+      sqlite3_free(zErrMsg);
+    sqlite3_exec(db, "ROLLBACK", nullptr, 0, nullptr);
+    return 0;
+  };
+
+  // Table definition
+  string sqlTableDefinition = "CREATE TABLE InputTable (";
+  for(size_t i = 0; i < nc; i++)
+    sqlTableDefinition += (i > 0 ? "," : "") + quoteIdentifier(columnNames[i])
+                          + " " + (isNumeric[i] ? "REAL" : "TEXT");
+  sqlTableDefinition += ")";
+
+  // Everything happens in one transaction: a cache is either complete or
+  // not updated at all
+  int rc = sqlite3_exec(db, "BEGIN", nullptr, 0, &zErrMsg);
+  if(rc == SQLITE_OK)
+    rc = sqlite3_exec(db,
+                      "DROP TABLE IF EXISTS InputTable; DELETE FROM "
+                      "ttkCacheInfo",
+                      nullptr, 0, &zErrMsg);
+  if(rc == SQLITE_OK)
+    rc = sqlite3_exec(db, sqlTableDefinition.data(), nullptr, 0, &zErrMsg);
+  if(rc != SQLITE_OK)
+    return error(zErrMsg ? zErrMsg : sqlite3_errmsg(db));
+
+  // Prepared statements inserting batches of rows (at most 999 bound
+  // parameters per statement)
+  const size_t batchSize = nc > 0 ? max((size_t)1, (size_t)999 / nc) : 1;
+  auto prepare = [&](const size_t rows, sqlite3_stmt *&stmt) {
+    string sql = "INSERT INTO InputTable VALUES ";
+    string row = "(";
+    for(size_t i = 0; i < nc; i++)
+      row += i > 0 ? ",?" : "?";
+    row += ")";
+    for(size_t j = 0; j < rows; j++)
+      sql += (j > 0 ? "," : "") + row;
+    return sqlite3_prepare_v2(db, sql.data(), -1, &stmt, nullptr);
+  };
+
+  sqlite3_stmt *batchStmt = nullptr;
+  sqlite3_stmt *rowStmt = nullptr;
+  if(prepare(batchSize, batchStmt) != SQLITE_OK
+     || prepare(1, rowStmt) != SQLITE_OK) {
+    sqlite3_finalize(batchStmt);
+    sqlite3_finalize(rowStmt);
+    return error(sqlite3_errmsg(db));
+  }
+
+  for(size_t j = 0; j < nRows && rc == SQLITE_OK;) {
+    const size_t rows = nRows - j >= batchSize ? batchSize : 1;
+    sqlite3_stmt *stmt = rows == batchSize ? batchStmt : rowStmt;
+
+    int parameter = 1;
+    for(size_t r = 0; r < rows; r++, j++) {
+      for(size_t i = 0; i < nc; i++, parameter++) {
+        const string value = getCell(j, i);
+        if(isNumeric[i] && !value.empty()) {
+          // same conversion as a numeric literal
+          char *end = nullptr;
+          const double number = strtod(value.data(), &end);
+          if(end != nullptr && *end == '\0') {
+            sqlite3_bind_double(stmt, parameter, number);
+            continue;
+          }
+        }
+        sqlite3_bind_text(
+          stmt, parameter, value.data(), value.size(), SQLITE_TRANSIENT);
+      }
+    }
+
+    rc = sqlite3_step(stmt) == SQLITE_DONE ? SQLITE_OK : SQLITE_ERROR;
+    sqlite3_reset(stmt);
+  }
+  sqlite3_finalize(batchStmt);
+  sqlite3_finalize(rowStmt);
+  if(rc != SQLITE_OK)
+    return error(sqlite3_errmsg(db));
+
+  // Record the signature of the imported data
+  if(signature != "") {
+    sqlite3_stmt *stmt = nullptr;
+    rc = sqlite3_prepare_v2(
+      db, "INSERT INTO ttkCacheInfo VALUES ('signature', ?)", -1, &stmt,
+      nullptr);
+    if(rc == SQLITE_OK) {
+      sqlite3_bind_text(
+        stmt, 1, signature.data(), signature.size(), SQLITE_TRANSIENT);
+      rc = sqlite3_step(stmt) == SQLITE_DONE ? SQLITE_OK : SQLITE_ERROR;
+    }
+    sqlite3_finalize(stmt);
+    if(rc != SQLITE_OK)
+      return error(sqlite3_errmsg(db));
+  }
+
+  rc = sqlite3_exec(db, "COMMIT", nullptr, 0, &zErrMsg);
+  if(rc != SQLITE_OK)
+    return error(zErrMsg ? zErrMsg : sqlite3_errmsg(db));
+
+  stringstream msg;
+  msg << "done (#" << nRows << " rows in " << t.getElapsedTime() << " s)."
+      << endl;
+  dMsg(cout, msg.str(), timeMsg);
+
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+int ttk::CinemaQuery::createIndices(sqlite3 *db,
+                                    const vector<string> &columnNames,
+                                    const vector<string> &indexedColumns) const {
+#if TTK_ENABLE_SQLITE3
+  for(auto &column : indexedColumns) {
+    if(find(columnNames.begin(), columnNames.end(), column)
+       == columnNames.end()) {
+      stringstream msg;
+      msg << "[ttkCinemaQuery] WARNING: Column `" << column
+          << "' not found, not indexed." << endl;
+      dMsg(cout, msg.str(), infoMsg);
+      continue;
+    }
+
+    // existing indices (persistent databases) are kept
+    string sql = "CREATE INDEX IF NOT EXISTS "
+                 + quoteIdentifier("ttkIndex_" + column) + " ON InputTable("
+                 + quoteIdentifier(column) + ")";
+    char *zErrMsg = 0;
+    if(sqlite3_exec(db, sql.data(), nullptr, 0, &zErrMsg) != SQLITE_OK) {
+      stringstream msg;
+      msg << "[ttkCinemaQuery] ERROR: " << zErrMsg << endl;
+      dMsg(cout, msg.str(), fatalMsg);
+      sqlite3_free(zErrMsg);
+      return 0;
+    }
+  }
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+int ttk::CinemaQuery::query(sqlite3 *db,
+                            const string &sqlQuery,
+                            string &resultCSV) const {
+#if TTK_ENABLE_SQLITE3
+  dMsg(cout, "[ttkCinemaQuery] Querying database ... ", timeMsg);
+  Timer t;
+
+  char *zErrMsg = 0;
+  int rc = sqlite3_exec(
+    db, sqlQuery.data(), processRow, (void *)(&resultCSV), &zErrMsg);
+  if(rc != SQLITE_OK) {
+    stringstream msg;
+    msg << "failed\n[ttkCinemaQuery] ERROR: " << zErrMsg << endl;
+    dMsg(cout, msg.str(), fatalMsg);
+    sqlite3_free(zErrMsg);
+    return 0;
+  }
+
+  stringstream msg;
+  msg << "done (" << t.getElapsedTime() << " s)." << endl;
+  dMsg(cout, msg.str(), timeMsg);
+
+  return 1;
+#else
+  return 0;
+#endif
+}
@@ -7,14 +7,21 @@
 ///
 /// %CinemaQuery is a TTK processing package that generates a temporary SQLite3
 /// Database to perform a SQL query which is returned as a CSV String
+///
+/// The database can also be persisted in a cache file, in which case it is only
+/// rebuilt when the CSV file of the Cinema database changes.
 
 #pragma once
 
 // base code includes
 #include <Wrapper.h>
 
+#include <functional>
+
 using namespace std;
 
+struct sqlite3;
+
 namespace ttk {
   class CinemaQuery : public Debug {
   public:
@@ -27,5 +34,40 @@ namespace ttk {
                 const string &sqlTableRows,
                 const string &sqlQuery,
                 string &resultCSV) const;
+
+    // Returns the value of a table cell (row, column) as a string.
+    typedef function<string(const size_t &, const size_t &)> CellGetter;
+
+    // Performs a query on a table whose content is provided cell by cell.
+    // If databaseFile is not empty, the database is persisted in this file
+    // (which holds a single table) and only rebuilt when sourceFile (path,
+    // size and modification time), the table layout or the table signature
+    // (a short description of the table, e.g. its first and last rows)
+    // change. The table is imported with prepared, batched inserts inside a
+    // single transaction and the listed columns are indexed. The query
+    // itself runs on a read-only connection to the persisted database.
+    int execute(const string &databaseFile,
+                const string &sourceFile,
+                const string &tableSignature,
+                const vector<string> &columnNames,
+                const vector<bool> &isNumeric,
+                const size_t &nRows,
+                const CellGetter &getCell,
+                const vector<string> &indexedColumns,
+                const string &sqlQuery,
+                string &resultCSV) const;
+
+  protected:
+    int openDatabase(const string &databaseFile, sqlite3 *&db) const;
+    int importTable(sqlite3 *db,
+                    const vector<string> &columnNames,
+                    const vector<bool> &isNumeric,
+                    const size_t &nRows,
+                    const CellGetter &getCell,
+                    const string &signature) const;
+    int createIndices(sqlite3 *db,
+                      const vector<string> &columnNames,
+                      const vector<string> &indexedColumns) const;
+    int query(sqlite3 *db, const string &sqlQuery, string &resultCSV) const;
   };
-} // namespace ttk
\ No newline at end of file
+} // namespace ttk
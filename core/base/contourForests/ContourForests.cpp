@@ -5,6 +5,7 @@
  * date:                  Aout 2015
  */
 
+#include <algorithm>
 #include <iterator>
 #include <list>
 
@@ -23,6 +24,8 @@ ContourForests::ContourForests()
   : ContourForestsTree(new Params(), nullptr, new Scalars()), parallelParams_(),
     parallelData_() {
   params_->treeType = TreeType::Contour;
+  parallelParams_.partitionStrategy = PartitionStrategy::EqualCount;
+  parallelParams_.overDecomposition = 1;
   stringstream msg;
   msg << "[ContourForests]: DEPRECATED This module will be removed in a future"
       << "release, please use FTM instead for contour trees"
@@ -56,8 +59,32 @@ idPartition ContourForests::vertex2partition(const SimplexId &v) {
 // {
 
 void ContourForests::initInterfaces() {
-  // We have nbThread_ partition of the same size through all vertices
-  size_t partitionSize = scalars_->size / parallelParams_.nbPartitions;
+  // sorted position of the seed of each interface
+  vector<SimplexId> positions;
+
+  if(parallelParams_.partitionStrategy == PartitionStrategy::WorkBalanced
+     && parallelParams_.nbInterfaces) {
+    estimateInterfacePositions(positions);
+  } else {
+    // We have nbPartitions partition of the same size through all vertices
+    size_t partitionSize = scalars_->size / parallelParams_.nbPartitions;
+    for(idInterface i = 0; i < parallelParams_.nbInterfaces; ++i) {
+      positions.emplace_back(partitionSize * (i + 1));
+    }
+  }
+
+  // Seeds have to be distinct and inside the domain: on tiny domains, we may
+  // end up with less partitions than requested.
+  SimplexId nbPositions = 0;
+  for(const SimplexId &p : positions) {
+    if(p > 0 && p < scalars_->size
+       && (!nbPositions || p > positions[nbPositions - 1])) {
+      positions[nbPositions++] = p;
+    }
+  }
+  positions.resize(nbPositions);
+  parallelParams_.nbInterfaces = nbPositions;
+  parallelParams_.nbPartitions = nbPositions + 1;
 
   // ------------------
   // Seeds
@@ -67,12 +94,47 @@ void ContourForests::initInterfaces() {
   // We initiate interface with their seed (isovalue) and their adjacent
   // partition
   //  and each partition with it size and bounds.
+  parallelData_.interfaces.clear();
   for(idInterface i = 0; i < parallelParams_.nbInterfaces; ++i) {
     // interfaces have their first vertex of the sorted array as seed
     parallelData_.interfaces.emplace_back(
-      scalars_->sortedVertices[partitionSize * (i + 1)]);
+      scalars_->sortedVertices[positions[i]]);
   }
 
+  // }
+  // ------------------
+  // Scheduling
+  // ------------------
+  // {
+
+  // without estimation, the work is considered proportional to the size
+  if((idPartition)parallelData_.partitionWork.size()
+     != parallelParams_.nbPartitions) {
+    parallelData_.partitionWork.resize(parallelParams_.nbPartitions);
+    for(idPartition i = 0; i < parallelParams_.nbPartitions; ++i) {
+      const SimplexId start = (i == 0) ? 0 : positions[i - 1];
+      const SimplexId end
+        = (i == parallelParams_.nbInterfaces) ? scalars_->size : positions[i];
+      parallelData_.partitionWork[i] = end - start;
+    }
+  }
+
+  // largest partitions first, so that the dynamic scheduling of the
+  // over-decomposed partitions ends with the small ones
+  parallelData_.partitionOrder.resize(parallelParams_.nbPartitions);
+  for(idPartition i = 0; i < parallelParams_.nbPartitions; ++i) {
+    parallelData_.partitionOrder[i] = i;
+  }
+  stable_sort(parallelData_.partitionOrder.begin(),
+              parallelData_.partitionOrder.end(),
+              [&](const idPartition &a, const idPartition &b) {
+                return parallelData_.partitionWork[a]
+                       > parallelData_.partitionWork[b];
+              });
+
+  parallelParams_.nbWorkers
+    = min(parallelParams_.nbWorkers, parallelParams_.nbPartitions);
+
   // }
   // ------------------
   // Print Debug
@@ -92,6 +154,121 @@ void ContourForests::initInterfaces() {
   // }
 }
 
+void ContourForests::estimateInterfacePositions(vector<SimplexId> &positions) {
+  // Building the merge trees is linear in the number of vertices (plus their
+  // neighbors), but each critical point also creates, closes or merges arcs
+  // and union-finds: estimate the work of each sorted interval from a sample
+  // of its vertices, critical points weighing more than regular ones.
+  const double criticalWeight = 16;
+  const SimplexId nbSamplesPerPartition = 1024;
+
+  const SimplexId nbSamples
+    = min(scalars_->size, nbSamplesPerPartition * parallelParams_.nbPartitions);
+  if(!nbSamples)
+    return;
+  const SimplexId stride = scalars_->size / nbSamples;
+
+  vector<double> sampleWork(nbSamples, 1);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(parallelParams_.nbThreads)
+#endif
+  {
+    vector<SimplexId> neighbors;
+    vector<SimplexId> components;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for(SimplexId s = 0; s < nbSamples; s++) {
+      const SimplexId v = scalars_->sortedVertices[s * stride];
+      const SimplexId nbNeighbors = mesh_->getVertexNeighborNumber(v);
+
+      neighbors.resize(nbNeighbors);
+      components.resize(nbNeighbors);
+      for(SimplexId n = 0; n < nbNeighbors; n++) {
+        mesh_->getVertexNeighbor(v, n, neighbors[n]);
+        components[n] = n;
+      }
+
+      // connected components of the lower and upper links, approximated by
+      // the edges between neighbors on the same side of v
+      SimplexId nbComponents = nbNeighbors;
+      for(SimplexId n = 0; n < nbNeighbors; n++) {
+        const bool isLow = isLower(neighbors[n], v);
+        const SimplexId nbSubNeighbors
+          = mesh_->getVertexNeighborNumber(neighbors[n]);
+        for(SimplexId m = 0; m < nbSubNeighbors; m++) {
+          SimplexId u;
+          mesh_->getVertexNeighbor(neighbors[n], m, u);
+          if(u == v || isLower(u, v) != isLow)
+            continue;
+          const auto it = find(neighbors.cbegin(), neighbors.cend(), u);
+          if(it == neighbors.cend())
+            continue;
+
+          SimplexId r0 = n, r1 = it - neighbors.cbegin();
+          while(components[r0] != r0)
+            r0 = components[r0];
+          while(components[r1] != r1)
+            r1 = components[r1];
+          if(r0 != r1) {
+            components[max(r0, r1)] = min(r0, r1);
+            nbComponents--;
+          }
+        }
+      }
+
+      SimplexId nbLower = 0;
+      for(SimplexId n = 0; n < nbNeighbors; n++) {
+        if(isLower(neighbors[n], v))
+          nbLower++;
+      }
+
+      // regular vertices have exactly one lower and one upper component
+      const bool isRegular
+        = (nbLower > 0 && nbLower < nbNeighbors && nbComponents == 2);
+      if(!isRegular) {
+        sampleWork[s] = criticalWeight;
+      }
+    }
+  }
+
+  double totalWork = 0;
+  for(const double &w : sampleWork) {
+    totalWork += w;
+  }
+
+  // interface i is placed where the cumulated work reaches the (i+1)-th
+  // fraction of the total work
+  positions.clear();
+  parallelData_.partitionWork.assign(parallelParams_.nbPartitions, 0);
+
+  double cumulatedWork = 0;
+  idPartition partition = 0;
+  for(SimplexId s = 0; s < nbSamples; s++) {
+    if(partition < parallelParams_.nbInterfaces
+       && cumulatedWork >= totalWork * (partition + 1)
+                             / parallelParams_.nbPartitions) {
+      positions.emplace_back(s * stride);
+      partition++;
+    }
+    cumulatedWork += sampleWork[s];
+    parallelData_.partitionWork[partition] += sampleWork[s] * stride;
+  }
+
+  if(params_->debugLevel >= 3) {
+    stringstream msg;
+    msg << "[ContourForests] Estimated work (sample of " << nbSamples
+        << " vertices):";
+    for(const double &w : parallelData_.partitionWork) {
+      msg << " " << w;
+    }
+    msg << endl;
+    dMsg(cout, msg.str(), 3);
+  }
+}
+
 void ContourForests::initOverlap() {
   const SimplexId nbEdges = mesh_->getNumberOfEdges();
 
@@ -250,12 +427,18 @@ void ContourForests::initOverlap() {
 
 void ContourForests::initNbPartitions() {
   if(parallelParams_.lessPartition && parallelParams_.nbThreads >= 2) {
-    parallelParams_.nbPartitions = parallelParams_.nbThreads / 2;
+    parallelParams_.nbWorkers = parallelParams_.nbThreads / 2;
   } else {
-    parallelParams_.nbPartitions = parallelParams_.nbThreads;
+    parallelParams_.nbWorkers = parallelParams_.nbThreads;
   }
 
+  // over-decomposition: more partitions than workers, dynamically scheduled
+  parallelParams_.nbPartitions
+    = parallelParams_.nbWorkers * max(parallelParams_.overDecomposition, 1);
   parallelParams_.nbInterfaces = parallelParams_.nbPartitions - 1;
+
+  // reset by initInterfaces() or its work estimation
+  parallelData_.partitionWork.clear();
 }
 
 // }
@@ -104,17 +104,31 @@ namespace ttk {
       // }
     };
 
+    // EqualCount: partitions with the same number of vertices
+    // WorkBalanced: partitions with the same estimated amount of work, based on
+    // the density of critical points in a sample of the sorted vertices
+    enum class PartitionStrategy : char { EqualCount = 0, WorkBalanced = 1 };
+
     struct ParallelParams {
       numThread nbThreads;
+      // threads working on distinct partitions (halved with lessPartition)
+      numThread nbWorkers;
       idInterface nbInterfaces;
       idPartition nbPartitions;
       int partitionNum;
       bool lessPartition;
+      PartitionStrategy partitionStrategy;
+      // number of partitions per worker, dynamically scheduled
+      int overDecomposition;
     };
 
     struct ParallelData {
       std::vector<Interface> interfaces;
       std::vector<ContourForestsTree> trees;
+      // estimated work of each partition and processing order (decreasing
+      // work first)
+      std::vector<double> partitionWork;
+      std::vector<idPartition> partitionOrder;
     };
 
     class ContourForests : public ContourForestsTree {
@@ -149,6 +163,14 @@ namespace ttk {
         parallelParams_.lessPartition = l;
       }
 
+      inline void setPartitionStrategy(const PartitionStrategy &strategy) {
+        parallelParams_.partitionStrategy = strategy;
+      }
+
+      inline void setOverDecomposition(int o) {
+        parallelParams_.overDecomposition = (o > 0) ? o : 1;
+      }
+
       // range of partitions, position of seeds , ...
 
       inline std::tuple<SimplexId, SimplexId>
@@ -223,6 +245,10 @@ namespace ttk {
       // {
       void initInterfaces(void);
 
+      // sorted positions of the interface seeds balancing the work estimated
+      // on a sample of the sorted vertices
+      void estimateInterfacePositions(std::vector<SimplexId> &positions);
+
       void initOverlap(void);
 
       void initNbPartitions(void);
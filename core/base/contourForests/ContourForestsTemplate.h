@@ -22,6 +22,8 @@
 
 #include "ContourForests.h"
 
+#include <numeric>
+
 namespace ttk {
   namespace cf {
 
@@ -55,6 +57,12 @@ namespace ttk {
         std::cout << "partitions : "
                   << static_cast<unsigned>(parallelParams_.nbPartitions)
                   << std::endl;
+        std::cout << "partition strategy : "
+                  << ((parallelParams_.partitionStrategy
+                       == PartitionStrategy::WorkBalanced)
+                        ? "work balanced"
+                        : "equal count")
+                  << std::endl;
         if(params_->simplifyThreshold) {
           std::cout << "simplify method : " << params_->simplifyMethod
                     << std::endl;
@@ -93,11 +101,11 @@ namespace ttk {
       // -----------------------
 
       DebugTimer timerAllocPara;
-      // Union find std::vector for each partition
+      // Union find std::vector for each worker, reset between its partitions
       std::vector<std::vector<ExtendedUnionFind *>> vect_baseUF_JT(
-        parallelParams_.nbPartitions),
+        parallelParams_.nbWorkers),
 
-        vect_baseUF_ST(parallelParams_.nbPartitions);
+        vect_baseUF_ST(parallelParams_.nbWorkers);
       const SimplexId &resSize
         = (scalars_->size / parallelParams_.nbPartitions) / 10;
 
@@ -118,8 +126,10 @@ namespace ttk {
         parallelData_.trees[tree].flush();
 
         // UF-array reserve
-        vect_baseUF_JT[tree].resize(scalars_->size);
-        vect_baseUF_ST[tree].resize(scalars_->size);
+        if(tree < parallelParams_.nbWorkers) {
+          vect_baseUF_JT[tree].resize(scalars_->size);
+          vect_baseUF_ST[tree].resize(scalars_->size);
+        }
 
         // Statistical reserve
         parallelData_.trees[tree].jt_->treeData_.nodes.reserve(resSize);
@@ -284,6 +294,8 @@ namespace ttk {
       std::vector<std::vector<ExtendedUnionFind *>> &vect_baseUF_ST) {
       std::vector<float> timeSimplify(parallelParams_.nbPartitions, 0);
       std::vector<float> speedProcess(parallelParams_.nbPartitions * 2, 0);
+      std::vector<float> timePartition(parallelParams_.nbPartitions, 0);
+      std::vector<float> timeWorker(parallelParams_.nbWorkers, 0);
 #ifdef TTK_ENABLE_CONTOUR_FORESTS_PARALLEL_SIMPLIFY
       SimplexId nbPairMerged = 0;
 #endif
@@ -293,13 +305,22 @@ namespace ttk {
 #endif
 
 // std::cout << "NO PARALLEL DEBUG MODE" << std::endl;
+// partitions are processed by decreasing estimated work: with
+// over-decomposition, the dynamic scheduling balances the workers
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(parallelParams_.nbPartitions) \
-  schedule(static)
+#pragma omp parallel for num_threads(parallelParams_.nbWorkers) \
+  schedule(dynamic, 1)
 #endif
-      for(idPartition i = 0; i < parallelParams_.nbPartitions; ++i) {
+      for(idPartition p = 0; p < parallelParams_.nbPartitions; ++p) {
         DebugTimer timerMergeTree;
 
+        const idPartition i = parallelData_.partitionOrder[p];
+#ifdef TTK_ENABLE_OPENMP
+        const numThread worker = omp_get_thread_num();
+#else
+        const numThread worker = 0;
+#endif
+
         // ------------------------------------------------------
         // Skip partition that are not asked to compute if needed
         // ------------------------------------------------------
@@ -340,7 +361,7 @@ namespace ttk {
                    == TreeType::JoinAndSplit){DebugTimer timerSimplify;
         DebugTimer timerBuild;
         parallelData_.trees[i].getJoinTree()->build(
-          vect_baseUF_JT[i], std::get<0>(overlaps), std::get<1>(overlaps),
+          vect_baseUF_JT[worker], std::get<0>(overlaps), std::get<1>(overlaps),
           std::get<0>(rangeJT), std::get<1>(rangeJT), std::get<0>(seedsPos),
           std::get<1>(seedsPos));
         speedProcess[i] = partitionSize / timerBuild.getElapsedTime();
@@ -373,7 +394,7 @@ namespace ttk {
         DebugTimer timerSimplify;
         DebugTimer timerBuild;
         parallelData_.trees[i].getSplitTree()->build(
-          vect_baseUF_ST[i], std::get<1>(overlaps), std::get<0>(overlaps),
+          vect_baseUF_ST[worker], std::get<1>(overlaps), std::get<0>(overlaps),
           std::get<0>(rangeST), std::get<1>(rangeST), std::get<0>(seedsPos),
           std::get<1>(seedsPos));
         speedProcess[parallelParams_.nbPartitions + i]
@@ -406,6 +427,20 @@ namespace ttk {
     dMsg(std::cout, mt.str(), infoMsg);
   }
 
+  // Reset the union-find arrays of this worker for its next partition
+  {
+    auto resetUF = [&](const SimplexId &v) {
+      vect_baseUF_JT[worker][v] = nullptr;
+      vect_baseUF_ST[worker][v] = nullptr;
+    };
+    for(const SimplexId &v : std::get<0>(overlaps))
+      resetUF(v);
+    for(const SimplexId &v : std::get<1>(overlaps))
+      resetUF(v);
+    for(SimplexId s = std::get<0>(rangeJT); s < std::get<1>(rangeJT); ++s)
+      resetUF(scalars_->sortedVertices[s]);
+  }
+
   // Update segmentation of each arc if needed
   if(params_->simplifyThreshold || params_->treeType != TreeType::Contour) {
     DebugTimer timerUpdateSegm;
@@ -478,8 +513,38 @@ namespace ttk {
       std::cout << "combine" << std::endl;
     }
   }
+
+  timePartition[i] = timerMergeTree.getElapsedTime();
+  timeWorker[worker] += timePartition[i];
 } // namespace ttk
 
+// ------------------------
+// Print partition timings
+// ------------------------
+
+if(params_->debugLevel >= infoMsg && parallelParams_.partitionNum == -1) {
+  std::stringstream msg;
+  for(idPartition i = 0; i < parallelParams_.nbPartitions; ++i) {
+    SimplexId start, end;
+    std::tie(start, end) = getJTRange(i);
+    msg << "[ContourForests] Partition " << static_cast<unsigned>(i) << " : "
+        << end - start << " vertices, estimated work "
+        << parallelData_.partitionWork[i] << ", " << timePartition[i] << " s"
+        << std::endl;
+  }
+  const float maxTime
+    = *max_element(timeWorker.cbegin(), timeWorker.cend());
+  const float sumTime
+    = std::accumulate(timeWorker.cbegin(), timeWorker.cend(), 0.f);
+  msg << "[ContourForests] "
+      << static_cast<unsigned>(parallelParams_.nbPartitions)
+      << " partitions on " << static_cast<unsigned>(parallelParams_.nbWorkers)
+      << " worker(s), imbalance (max / mean worker time) : "
+      << ((sumTime > 0) ? maxTime * timeWorker.size() / sumTime : 1)
+      << std::endl;
+  dMsg(std::cout, msg.str(), infoMsg);
+}
+
 // -------------------------------------
 // Print process speed and simplify info
 // -------------------------------------
@@ -1 +1,123 @@
-// This file needs to exist for the Mac compiler
\ No newline at end of file
+#include <DepthImageBasedGeometryApproximation.h>
+
+#include <cmath>
+
+size_t ttk::DepthImageBasedGeometryApproximation::getCameraModel(
+  const CameraParameters &camera, const size_t step) const {
+
+  const double *camPos = camera.camPos;
+  const double *camDir = camera.camDir;
+  const double *camUp = camera.camUp;
+  const double *camRes = camera.camRes;
+  const double *camNearFar = camera.camNearFar;
+  const double *camHeight = camera.camHeight;
+
+  const array<double, 14> parameters
+    = {{camPos[0], camPos[1], camPos[2], camDir[0], camDir[1], camDir[2],
+        camUp[0], camUp[1], camUp[2], camRes[0], camRes[1], camNearFar[0],
+        camNearFar[1], camHeight[0]}};
+
+  // Look for the camera configuration in the cache
+  for(size_t i = 0; i < cameraModels_.size(); i++) {
+    if(cameraModels_[i].step == step
+       && cameraModels_[i].parameters == parameters)
+      return i;
+  }
+
+  cameraModels_.emplace_back();
+  auto &model = cameraModels_.back();
+  model.parameters = parameters;
+  model.step = step;
+
+  size_t camResST[2] = {(size_t)camRes[0], (size_t)camRes[1]};
+  model.res[0] = camResST[0];
+  model.res[1] = camResST[1];
+  model.samples[0] = (camResST[0] + step - 1) / step;
+  model.samples[1] = (camResST[1] + step - 1) / step;
+
+  // -------------------------------------------------------------------------
+  // Compute Camera Vectors
+  // -------------------------------------------------------------------------
+
+  // Compute camera size
+  double camSize[2] = {camRes[0] / camRes[1] * camHeight[0], camHeight[0]};
+
+  // Compute camRight = camDir x CamUp
+  double camRight[3] = {camDir[1] * camUp[2] - camDir[2] * camUp[1],
+                        camDir[2] * camUp[0] - camDir[0] * camUp[2],
+                        camDir[0] * camUp[1] - camDir[1] * camUp[0]};
+  double temp = sqrt(camRight[0] * camRight[0] + camRight[1] * camRight[1]
+                     + camRight[2] * camRight[2]);
+  camRight[0] /= temp;
+  camRight[1] /= temp;
+  camRight[2] /= temp;
+
+  // Compute true up vector
+  double camUpTrue[3]
+    = {camDir[1] * (-camRight[2]) - camDir[2] * (-camRight[1]),
+       camDir[2] * (-camRight[0]) - camDir[0] * (-camRight[2]),
+       camDir[0] * (-camRight[1]) - camDir[1] * (-camRight[0])};
+  temp = sqrt(camUpTrue[0] * camUpTrue[0] + camUpTrue[1] * camUpTrue[1]
+              + camUpTrue[2] * camUpTrue[2]);
+  camUpTrue[0] /= temp;
+  camUpTrue[1] /= temp;
+  camUpTrue[2] /= temp;
+
+  model.dir[0] = camDir[0];
+  model.dir[1] = camDir[1];
+  model.dir[2] = camDir[2];
+
+  // Compute depth delta
+  model.near = camNearFar[0];
+  model.delta = camNearFar[1] - camNearFar[0];
+
+  // -------------------------------------------------------------------------
+  // Compute Pixel Rays
+  // -------------------------------------------------------------------------
+
+  // Compute pixel size in world coordinates
+  double pixelWidthWorld = camSize[0] / camRes[0];
+  double pixelHeightWorld = camSize[1] / camRes[1];
+
+  // Optimization: precompute half of the camera size to reduce the number of
+  // operations in the for loop Include a half pixel offset (-0.5) to center
+  // vertices at pixel centers
+  double camWidthWorldHalf = 0.5 * camSize[0] - 0.5 * pixelWidthWorld;
+  double camHeightWorldHalf = 0.5 * camSize[1] - 0.5 * pixelHeightWorld;
+
+  // Optimization: reorient camera model to bottom left corner to reduce
+  // operations in for loop
+  double camPosCorner[3] = {camPos[0] - camRight[0] * camWidthWorldHalf
+                              - camUpTrue[0] * camHeightWorldHalf,
+                            camPos[1] - camRight[1] * camWidthWorldHalf
+                              - camUpTrue[1] * camHeightWorldHalf,
+                            camPos[2] - camRight[2] * camWidthWorldHalf
+                              - camUpTrue[2] * camHeightWorldHalf};
+
+  const size_t sx = model.samples[0];
+  const size_t sy = model.samples[1];
+  model.rowOrigins.resize(3 * sy);
+  model.columnOffsets.resize(3 * sx);
+
+  // Ray origin of pixel (x, y): rowOrigins[y] + columnOffsets[x]
+  for(size_t j = 0; j < sy; j++) {
+    double v = ((double)(j * step)) * pixelHeightWorld;
+    for(size_t k = 0; k < 3; k++)
+      model.rowOrigins[3 * j + k] = camPosCorner[k] + v * camUpTrue[k];
+  }
+  for(size_t i = 0; i < sx; i++) {
+    double u = ((double)(i * step)) * pixelWidthWorld;
+    for(size_t k = 0; k < 3; k++)
+      model.columnOffsets[3 * i + k] = u * camRight[k];
+  }
+
+  {
+    stringstream msg;
+    msg << "[ttkDepthImageBasedGeometryApproximation] New camera model ("
+        << camResST[0] << "x" << camResST[1] << ":" << step << "), "
+        << cameraModels_.size() << " in cache." << endl;
+    dMsg(cout, msg.str(), advancedInfoMsg);
+  }
+
+  return cameraModels_.size() - 1;
+}
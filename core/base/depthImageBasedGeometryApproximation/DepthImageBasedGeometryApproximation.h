@@ -9,6 +9,13 @@
 /// approximates geomerty based on an input depth image and its corresponding
 /// camera parameters.
 ///
+/// The camera vectors and the pixel rays only depend on the camera
+/// parameters, the resolution and the subsampling. They are computed once
+/// per camera configuration and cached across calls, so that the depth
+/// images of a Cinema database rendered with a few cameras only pay for the
+/// vertex and triangle generation. Several depth images can also be
+/// processed in parallel with executeBatch() into a single merged geometry.
+///
 /// Related publication:
 /// 'VOIDGA: A View-Approximation Oriented Image Database Generation Approach'
 /// Jonas Lukasczyk, Eric Kinner, James Ahrens, Heike Leitte, and Christoph
@@ -22,6 +29,11 @@
 // base code includes
 #include <Wrapper.h>
 
+#include <array>
+#include <limits>
+#include <tuple>
+#include <vector>
+
 using namespace std;
 
 namespace ttk {
@@ -32,6 +44,16 @@ namespace ttk {
     DepthImageBasedGeometryApproximation(){};
     ~DepthImageBasedGeometryApproximation(){};
 
+    // Camera parameters of a depth image (see Cinema Spec D).
+    struct CameraParameters {
+      double *camPos;
+      double *camDir;
+      double *camUp;
+      double *camRes;
+      double *camNearFar;
+      double *camHeight;
+    };
+
     // Execute the geometry approximation.
     template <class dataType>
     int execute(dataType *depthValues,
@@ -48,131 +70,136 @@ namespace ttk {
                 vector<tuple<double, double, double>> &vertices,
                 vector<tuple<int, int, int>> &triangles,
                 vector<double> &triangleDistortions) const;
+
+    // Execute the geometry approximation on a set of depth images (in
+    // parallel) and merge the results. imageIndices stores the depth image
+    // of every vertex (indicies stores its pixel index). Fails if the merged
+    // geometry has more vertices than SimplexId can address.
+    template <class dataType>
+    int executeBatch(const vector<dataType *> &depthValues,
+                     const vector<CameraParameters> &cameras,
+
+                     int subsampling,
+
+                     vector<size_t> &imageIndices,
+                     vector<size_t> &indicies,
+                     vector<tuple<double, double, double>> &vertices,
+                     vector<tuple<SimplexId, SimplexId, SimplexId>> &triangles,
+                     vector<double> &triangleDistortions) const;
+
+    // Release the cached camera models.
+    inline void clearCameraCache() const {
+      cameraModels_.clear();
+    }
+
+  protected:
+    // Camera vectors and pixel rays of a camera configuration.
+    struct CameraModel {
+      // camera parameters and subsampling step (cache key)
+      array<double, 14> parameters;
+      size_t step;
+
+      // resolution
+      size_t res[2];
+      // number of sampled pixels per row and per column
+      size_t samples[2];
+      // camera direction
+      double dir[3];
+      // near plane distance and depth delta
+      double near;
+      double delta;
+      // ray origin of every sampled row (3 coordinates per row)
+      vector<double> rowOrigins;
+      // ray origin offset of every sampled column (3 coordinates per column)
+      vector<double> columnOffsets;
+    };
+
+    // Index of the model of a camera configuration in the cache (computed
+    // if missing).
+    size_t getCameraModel(const CameraParameters &camera,
+                          const size_t step) const;
+
+    // Geometry approximation of one depth image.
+    template <class dataType>
+    int approximate(const dataType *depthValues,
+                    const CameraModel &model,
+                    const int threadNumber,
+
+                    vector<size_t> &indicies,
+                    vector<tuple<double, double, double>> &vertices,
+                    vector<tuple<int, int, int>> &triangles,
+                    vector<double> &triangleDistortions) const;
+
+    // maximum number of cached camera models
+    const size_t maxCameraModels_{32};
+    mutable vector<CameraModel> cameraModels_{};
   };
 } // namespace ttk
 
 template <class dataType>
-int ttk::DepthImageBasedGeometryApproximation::execute(
-  dataType *depthValues,
-  double *camPos,
-  double *camDir,
-  double *camUp,
-  double *camRes,
-  double *camNearFar,
-  double *camHeight,
-
-  int subsampling,
+int ttk::DepthImageBasedGeometryApproximation::approximate(
+  const dataType *depthValues,
+  const CameraModel &model,
+  const int threadNumber,
 
   vector<size_t> &indicies,
   vector<tuple<double, double, double>> &vertices,
   vector<tuple<int, int, int>> &triangles,
   vector<double> &triangleDistortions) const {
 
-  Timer t;
-  size_t step = subsampling + 1;
-
-  size_t camResST[2] = {(size_t)camRes[0], (size_t)camRes[1]};
-
-  // -------------------------------------------------------------------------
-  // Compute Camera Vectors
-  // -------------------------------------------------------------------------
+  const size_t sx = model.samples[0];
+  const size_t sy = model.samples[1];
+  const size_t step = model.step;
+  const size_t yD = step * model.res[0];
 
-  // Compute camera size
-  double camSize[2] = {camRes[0] / camRes[1] * camHeight[0], camHeight[0]};
-
-  // Compute camRight = camDir x CamUp
-  double camRight[3] = {camDir[1] * camUp[2] - camDir[2] * camUp[1],
-                        camDir[2] * camUp[0] - camDir[0] * camUp[2],
-                        camDir[0] * camUp[1] - camDir[1] * camUp[0]};
-  double temp = sqrt(camRight[0] * camRight[0] + camRight[1] * camRight[1]
-                     + camRight[2] * camRight[2]);
-  camRight[0] /= temp;
-  camRight[1] /= temp;
-  camRight[2] /= temp;
-
-  // Compute true up vector
-  double camUpTrue[3]
-    = {camDir[1] * (-camRight[2]) - camDir[2] * (-camRight[1]),
-       camDir[2] * (-camRight[0]) - camDir[0] * (-camRight[2]),
-       camDir[0] * (-camRight[1]) - camDir[1] * (-camRight[0])};
-  temp = sqrt(camUpTrue[0] * camUpTrue[0] + camUpTrue[1] * camUpTrue[1]
-              + camUpTrue[2] * camUpTrue[2]);
-  camUpTrue[0] /= temp;
-  camUpTrue[1] /= temp;
-  camUpTrue[2] /= temp;
-
-  // Compute Index Map
-  size_t n = camResST[0] * camResST[1];
+  // Compute Index Map (over the sampled pixels)
+  size_t n = sx * sy;
 
   vector<int> pixelIndexVertexIndexMap;
   pixelIndexVertexIndexMap.resize(n);
   size_t numberNewVertices = 0;
   {
-    for(size_t i = 0; i < n; i++)
-      pixelIndexVertexIndexMap[i]
-        = depthValues[i] > 0.99 ? -1 : numberNewVertices++;
+    for(size_t y = 0; y < sy; y++)
+      for(size_t x = 0; x < sx; x++)
+        pixelIndexVertexIndexMap[x + y * sx]
+          = depthValues[x * step + y * yD] > 0.99 ? -1 : numberNewVertices++;
   }
 
   // -------------------------------------------------------------------------
   // Create Vertices
   // -------------------------------------------------------------------------
   {
-    // Compute pixel size in world coordinates
-    double pixelWidthWorld = camSize[0] / camRes[0];
-    double pixelHeightWorld = camSize[1] / camRes[1];
-
-    // Optimization: precompute half of the camera size to reduce the number of
-    // operations in the for loop Include a half pixel offset (-0.5) to center
-    // vertices at pixel centers
-    double camWidthWorldHalf = 0.5 * camSize[0] - 0.5 * pixelWidthWorld;
-    double camHeightWorldHalf = 0.5 * camSize[1] - 0.5 * pixelHeightWorld;
-
-    // Make room for new vertices
+    // Make room for new vertices (and triangles)
     vertices.resize(numberNewVertices);
     indicies.resize(numberNewVertices);
+    triangles.reserve(triangles.size() + 2 * numberNewVertices);
+    triangleDistortions.reserve(triangleDistortions.size()
+                                + 2 * numberNewVertices);
 
-    // Compute depth delta
-    double delta = camNearFar[1] - camNearFar[0];
-
-    // Optimization: reorient camera model to bottom left corner to reduce
-    // operations in for loop
-    double camPosCorner[3] = {camPos[0] - camRight[0] * camWidthWorldHalf
-                                - camUpTrue[0] * camHeightWorldHalf,
-                              camPos[1] - camRight[1] * camWidthWorldHalf
-                                - camUpTrue[1] * camHeightWorldHalf,
-                              camPos[2] - camRight[2] * camWidthWorldHalf
-                                - camUpTrue[2] * camHeightWorldHalf};
-
-// Compute vertex positions and parallize over rows
+// Compute vertex positions along the cached pixel rays and parallize over
+// rows
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel for num_threads(threadNumber)
 #endif
-    for(size_t y = 0; y < camResST[1]; y += step) {
-      double v = ((double)y) * pixelHeightWorld;
-      double vTimesUp[3]
-        = {v * camUpTrue[0], v * camUpTrue[1], v * camUpTrue[2]};
-
-      size_t yOffset = y * camResST[0];
-      for(size_t x = 0; x < camResST[0]; x += step) {
-        size_t pixelIndex = x + yOffset;
-        int vertexIndex = pixelIndexVertexIndexMap[pixelIndex];
+    for(size_t y = 0; y < sy; y++) {
+      const double *rowOrigin = &model.rowOrigins[3 * y];
+
+      for(size_t x = 0; x < sx; x++) {
+        int vertexIndex = pixelIndexVertexIndexMap[x + y * sx];
         if(vertexIndex < 0)
           continue;
 
-        // double d = (double)(depthValues[ pixelIndex ])*delta+camNearFar[0];
-        double d = ((double)depthValues[pixelIndex]) * delta + camNearFar[0];
-        double u = ((double)x) * pixelWidthWorld;
+        size_t pixelIndex = x * step + y * yD;
+        double d = ((double)depthValues[pixelIndex]) * model.delta + model.near;
+        const double *columnOffset = &model.columnOffsets[3 * x];
         auto &vertex = vertices[vertexIndex];
 
         // Store pixel index of vertex
         indicies[vertexIndex] = pixelIndex;
 
-        get<0>(vertex)
-          = camPosCorner[0] + u * camRight[0] + vTimesUp[0] + d * camDir[0];
-        get<1>(vertex)
-          = camPosCorner[1] + u * camRight[1] + vTimesUp[1] + d * camDir[1];
-        get<2>(vertex)
-          = camPosCorner[2] + u * camRight[2] + vTimesUp[2] + d * camDir[2];
+        get<0>(vertex) = rowOrigin[0] + columnOffset[0] + d * model.dir[0];
+        get<1>(vertex) = rowOrigin[1] + columnOffset[1] + d * model.dir[1];
+        get<2>(vertex) = rowOrigin[2] + columnOffset[2] + d * model.dir[2];
       }
     }
   }
@@ -188,31 +215,26 @@ int ttk::DepthImageBasedGeometryApproximation::execute(
     | / |
     2 - 3
     */
-    size_t xl = camResST[0] - step;
-    size_t yl = camResST[1] - step;
-    size_t yD = step * camResST[0];
-
-    for(size_t y = 0; y < yl; y += step) {
-      for(size_t x = 0; x < xl; x += step) {
-        size_t i0 = x + y * camResST[0];
+    for(size_t y = 0; y + 1 < sy; y++) {
+      for(size_t x = 0; x + 1 < sx; x++) {
+        size_t s0 = x + y * sx;
+        size_t i0 = x * step + y * yD;
         size_t i1 = i0 + step;
         size_t i2 = i0 + yD;
         size_t i3 = i2 + step;
 
-        int i0Index = pixelIndexVertexIndexMap[i0];
-        int i1Index = pixelIndexVertexIndexMap[i1];
-        int i2Index = pixelIndexVertexIndexMap[i2];
-        int i3Index = pixelIndexVertexIndexMap[i3];
+        int i0Index = pixelIndexVertexIndexMap[s0];
+        int i1Index = pixelIndexVertexIndexMap[s0 + 1];
+        int i2Index = pixelIndexVertexIndexMap[s0 + sx];
+        int i3Index = pixelIndexVertexIndexMap[s0 + sx + 1];
 
-        dataType i0Depth = depthValues[i0];
-        dataType i1Depth = depthValues[i1];
-        dataType i2Depth = depthValues[i2];
-        dataType i3Depth = depthValues[i3];
+        if(i1Index >= 0 && i2Index >= 0) {
+          dataType i1Depth = depthValues[i1];
+          dataType i2Depth = depthValues[i2];
 
-        if(pixelIndexVertexIndexMap[i1] >= 0
-           && pixelIndexVertexIndexMap[i2] >= 0) {
           // Check first triangle
-          if(pixelIndexVertexIndexMap[i0] >= 0) {
+          if(i0Index >= 0) {
+            dataType i0Depth = depthValues[i0];
             triangles.push_back(make_tuple(i0Index, i1Index, i2Index));
 
             dataType distortion
@@ -223,7 +245,8 @@ int ttk::DepthImageBasedGeometryApproximation::execute(
           }
 
           // Check second triangle
-          if(pixelIndexVertexIndexMap[i3] >= 0) {
+          if(i3Index >= 0) {
+            dataType i3Depth = depthValues[i3];
             triangles.push_back(make_tuple(i1Index, i3Index, i2Index));
 
             dataType distortion
@@ -237,11 +260,166 @@ int ttk::DepthImageBasedGeometryApproximation::execute(
     }
   }
 
+  return 0;
+}
+
+template <class dataType>
+int ttk::DepthImageBasedGeometryApproximation::execute(
+  dataType *depthValues,
+  double *camPos,
+  double *camDir,
+  double *camUp,
+  double *camRes,
+  double *camNearFar,
+  double *camHeight,
+
+  int subsampling,
+
+  vector<size_t> &indicies,
+  vector<tuple<double, double, double>> &vertices,
+  vector<tuple<int, int, int>> &triangles,
+  vector<double> &triangleDistortions) const {
+
+  Timer t;
+  size_t step = subsampling + 1;
+
+  if(cameraModels_.size() >= maxCameraModels_)
+    cameraModels_.clear();
+
+  const CameraParameters camera{camPos,     camDir,    camUp,
+                                camRes,     camNearFar, camHeight};
+  const auto &model = cameraModels_[getCameraModel(camera, step)];
+
+  approximate(depthValues, model, threadNumber_, indicies, vertices,
+              triangles, triangleDistortions);
+
   // Print performance
   {
     stringstream msg;
     msg << "[ttkDepthImageBasedGeometryApproximation] Depth Image ("
-        << camResST[0] << "x" << camResST[1] << ":" << step << ") processed in "
+        << model.res[0] << "x" << model.res[1] << ":" << step
+        << ") processed in " << t.getElapsedTime() << " s. (" << threadNumber_
+        << " thread(s))." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+  {
+    stringstream msg;
+    msg << "[ttkDepthImageBasedGeometryApproximation] Generated ("
+        << vertices.size() << " vertices) and (" << triangles.size()
+        << " triangles)." << endl;
+    dMsg(cout, msg.str(), infoMsg);
+  }
+
+  return 0;
+}
+
+template <class dataType>
+int ttk::DepthImageBasedGeometryApproximation::executeBatch(
+  const vector<dataType *> &depthValues,
+  const vector<CameraParameters> &cameras,
+
+  int subsampling,
+
+  vector<size_t> &imageIndices,
+  vector<size_t> &indicies,
+  vector<tuple<double, double, double>> &vertices,
+  vector<tuple<SimplexId, SimplexId, SimplexId>> &triangles,
+  vector<double> &triangleDistortions) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(depthValues.size() != cameras.size())
+    return -1;
+#endif
+
+  Timer t;
+  size_t step = subsampling + 1;
+  size_t nImages = depthValues.size();
+
+  // Look for the camera models first (the cache is not thread-safe)
+  if(cameraModels_.size() >= maxCameraModels_)
+    cameraModels_.clear();
+
+  vector<size_t> imageModels(nImages);
+  for(size_t i = 0; i < nImages; i++)
+    imageModels[i] = getCameraModel(cameras[i], step);
+
+  // Per-image geometries
+  vector<vector<size_t>> imageIndicies(nImages);
+  vector<vector<tuple<double, double, double>>> imageVertices(nImages);
+  vector<vector<tuple<int, int, int>>> imageTriangles(nImages);
+  vector<vector<double>> imageDistortions(nImages);
+
+  // Process the images in parallel (one thread per image)
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+  for(size_t i = 0; i < nImages; i++) {
+    approximate(depthValues[i], cameraModels_[imageModels[i]], 1,
+                imageIndicies[i], imageVertices[i], imageTriangles[i],
+                imageDistortions[i]);
+  }
+
+  // Offsets of the images in the merged geometry
+  vector<size_t> vertexOffsets(nImages + 1, 0);
+  vector<size_t> triangleOffsets(nImages + 1, 0);
+  for(size_t i = 0; i < nImages; i++) {
+    vertexOffsets[i + 1] = vertexOffsets[i] + imageVertices[i].size();
+    triangleOffsets[i + 1] = triangleOffsets[i] + imageTriangles[i].size();
+  }
+
+  // Vertex identifiers of the merged geometry
+  if(vertexOffsets[nImages]
+     > static_cast<size_t>(numeric_limits<SimplexId>::max())) {
+    stringstream msg;
+    msg << "[ttkDepthImageBasedGeometryApproximation] ERROR: Too many "
+           "vertices to merge ("
+        << vertexOffsets[nImages] << ")." << endl;
+    dMsg(cerr, msg.str(), fatalMsg);
+    return -2;
+  }
+
+  imageIndices.resize(vertexOffsets[nImages]);
+  indicies.resize(vertexOffsets[nImages]);
+  vertices.resize(vertexOffsets[nImages]);
+  triangles.resize(triangleOffsets[nImages]);
+  triangleDistortions.resize(triangleOffsets[nImages]);
+
+  // Merge
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+  for(size_t i = 0; i < nImages; i++) {
+    size_t vo = vertexOffsets[i];
+    size_t to = triangleOffsets[i];
+    const SimplexId o = static_cast<SimplexId>(vo);
+
+    std::fill(imageIndices.begin() + vo,
+              imageIndices.begin() + vertexOffsets[i + 1], i);
+    std::copy(imageIndicies[i].begin(), imageIndicies[i].end(),
+              indicies.begin() + vo);
+    std::copy(
+      imageVertices[i].begin(), imageVertices[i].end(), vertices.begin() + vo);
+    std::copy(imageDistortions[i].begin(), imageDistortions[i].end(),
+              triangleDistortions.begin() + to);
+    for(size_t j = 0; j < imageTriangles[i].size(); j++) {
+      const auto &tr = imageTriangles[i][j];
+      triangles[to + j] = make_tuple(static_cast<SimplexId>(get<0>(tr)) + o,
+                                     static_cast<SimplexId>(get<1>(tr)) + o,
+                                     static_cast<SimplexId>(get<2>(tr)) + o);
+    }
+
+    // Release the image geometry
+    vector<size_t>().swap(imageIndicies[i]);
+    vector<tuple<double, double, double>>().swap(imageVertices[i]);
+    vector<tuple<int, int, int>>().swap(imageTriangles[i]);
+    vector<double>().swap(imageDistortions[i]);
+  }
+
+  // Print performance
+  {
+    stringstream msg;
+    msg << "[ttkDepthImageBasedGeometryApproximation] " << nImages
+        << " Depth Images (" << step << ") processed in "
         << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
         << endl;
     dMsg(cout, msg.str(), timeMsg);
@@ -250,7 +428,8 @@ int ttk::DepthImageBasedGeometryApproximation::execute(
     stringstream msg;
     msg << "[ttkDepthImageBasedGeometryApproximation] Generated ("
         << vertices.size() << " vertices) and (" << triangles.size()
-        << " triangles)." << endl;
+        << " triangles), " << cameraModels_.size()
+        << " camera model(s) in cache." << endl;
     dMsg(cout, msg.str(), infoMsg);
   }
 
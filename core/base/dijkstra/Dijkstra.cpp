@@ -1,7 +1,8 @@
 #include <Dijkstra.h>
+#include <algorithm>
 #include <array>
 #include <functional>
-#include <queue>
+#include <limits>
 
 template <typename T>
 int ttk::Dijkstra::shortestPath(const ttk::SimplexId source,
@@ -10,6 +11,27 @@ int ttk::Dijkstra::shortestPath(const ttk::SimplexId source,
                                 const std::vector<ttk::SimplexId> &bounds,
                                 const std::vector<bool> &mask) {
 
+  // single query: the workspace only lives for this call
+  Workspace<T> workspace{};
+
+  int ret = shortestPath(source, triangulation, workspace, bounds, mask);
+  if(ret != 0) {
+    return ret;
+  }
+
+  // preprocess output vector
+  workspace.getDistances(outputDists);
+
+  return 0;
+}
+
+template <typename T>
+int ttk::Dijkstra::shortestPath(const ttk::SimplexId source,
+                                ttk::Triangulation &triangulation,
+                                Workspace<T> &workspace,
+                                const std::vector<ttk::SimplexId> &bounds,
+                                const std::vector<bool> &mask) {
+
   // should we process the whole mesh or stop at some point?
   bool processAllVertices = bounds.empty();
   // total number of vertices in the mesh
@@ -22,32 +44,47 @@ int ttk::Dijkstra::shortestPath(const ttk::SimplexId source,
     return 1;
   }
 
-  // list all reached bounds
-  std::vector<bool> reachedBounds;
-
-  // alloc and fill reachedBounds
-  if(!processAllVertices) {
-    reachedBounds.resize(bounds.size(), false);
+  // only allocates on the first query (or if the mesh size changed)
+  workspace.setVertexNumber(vertexNumber);
+  workspace.newQuery();
+
+  const auto stamp = workspace.stamp_;
+  auto &boundStamps = workspace.boundStamps_;
+  auto &dists = workspace.dists_;
+  auto &pq = workspace.heap_;
+
+  // mark all bounds, count the distinct ones
+  size_t remainingBounds = 0;
+  for(const auto b : bounds) {
+    if(boundStamps[b] != stamp) {
+      boundStamps[b] = stamp;
+      remainingBounds++;
+    }
   }
 
-  // preprocess output vector
-  outputDists.clear();
-  outputDists.resize(vertexNumber, std::numeric_limits<T>::infinity());
-
-  // link vertex and current distance to source
-  using pq_t = std::pair<T, SimplexId>;
-
-  // priority queue storing pairs of (distance, vertices TTK id)
-  std::priority_queue<pq_t, std::vector<pq_t>, std::greater<pq_t>> pq;
-
   // init pipeline
-  pq.push(std::make_pair(T(0.0F), source));
-  outputDists[source] = T(0.0F);
+  pq.push(T(0.0F), source);
+  workspace.setDistance(source, T(0.0F));
 
   while(!pq.empty()) {
-    auto elem = pq.top();
-    pq.pop();
+    auto elem = pq.pop();
     auto vert = elem.second;
+
+    // skip outdated queue entries
+    if(elem.first > dists[vert]) {
+      continue;
+    }
+
+    if(!processAllVertices && boundStamps[vert] == stamp) {
+      // distance to this bound is final
+      boundStamps[vert] = 0;
+      remainingBounds--;
+      // break if all are found
+      if(remainingBounds == 0) {
+        break;
+      }
+    }
+
     std::array<float, 3> vCoords{};
     triangulation.getVertexPoint(vert, vCoords[0], vCoords[1], vCoords[2]);
 
@@ -68,22 +105,10 @@ int ttk::Dijkstra::shortestPath(const ttk::SimplexId source,
       triangulation.getVertexPoint(neigh, nCoords[0], nCoords[1], nCoords[2]);
       // (square) distance between vertex and neighbor
       T distVN = Geometry::distance(vCoords.data(), nCoords.data());
-      if(outputDists[neigh] > outputDists[vert] + distVN) {
-        outputDists[neigh] = outputDists[vert] + distVN;
-        if(!processAllVertices) {
-          // check if neigh in bounds
-          auto it = std::find(bounds.begin(), bounds.end(), neigh);
-          if(it != bounds.end()) {
-            // mark it as found
-            reachedBounds[it - bounds.begin()] = true;
-          }
-          // break if all are found
-          if(std::all_of(reachedBounds.begin(), reachedBounds.end(),
-                         [](const bool v) { return v; })) {
-            break;
-          }
-        }
-        pq.push(std::make_pair(outputDists[neigh], neigh));
+      T newDist = dists[vert] + distVN;
+      if(workspace.getDistance(neigh) > newDist) {
+        workspace.setDistance(neigh, newDist);
+        pq.push(newDist, neigh);
       }
     }
   }
@@ -91,6 +116,52 @@ int ttk::Dijkstra::shortestPath(const ttk::SimplexId source,
   return 0;
 }
 
+template <typename T>
+int ttk::Dijkstra::shortestPaths(
+  const std::vector<ttk::SimplexId> &sources,
+  ttk::Triangulation &triangulation,
+  std::vector<Workspace<T>> &workspaces,
+  const std::function<void(const size_t, const Workspace<T> &)> &callback,
+  const std::vector<std::vector<ttk::SimplexId>> &bounds,
+  const std::vector<bool> &mask) {
+
+  const size_t vertexNumber = triangulation.getNumberOfVertices();
+
+  // check inputs
+  if(!bounds.empty() && bounds.size() != sources.size()) {
+    return 1;
+  }
+  if(!mask.empty() && mask.size() != vertexNumber) {
+    return 2;
+  }
+
+  if(workspaces.empty()) {
+    workspaces.resize(1);
+  }
+  for(auto &workspace : workspaces) {
+    workspace.setVertexNumber(vertexNumber);
+  }
+
+  const std::vector<SimplexId> noBounds{};
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(workspaces.size())
+#endif // TTK_ENABLE_OPENMP
+  for(size_t i = 0; i < sources.size(); ++i) {
+    int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+#endif // TTK_ENABLE_OPENMP
+    auto &workspace = workspaces[threadId];
+
+    shortestPath(sources[i], triangulation, workspace,
+                 bounds.empty() ? noBounds : bounds[i], mask);
+    callback(i, workspace);
+  }
+
+  return 0;
+}
+
 // explicit intantiations for floating-point types
 template int
   ttk::Dijkstra::shortestPath<float>(const ttk::SimplexId source,
@@ -104,3 +175,29 @@ template int
                                       std::vector<double> &outputDists,
                                       const std::vector<ttk::SimplexId> &bounds,
                                       const std::vector<bool> &mask);
+template int
+  ttk::Dijkstra::shortestPath<float>(const ttk::SimplexId source,
+                                     ttk::Triangulation &triangulation,
+                                     Workspace<float> &workspace,
+                                     const std::vector<ttk::SimplexId> &bounds,
+                                     const std::vector<bool> &mask);
+template int
+  ttk::Dijkstra::shortestPath<double>(const ttk::SimplexId source,
+                                      ttk::Triangulation &triangulation,
+                                      Workspace<double> &workspace,
+                                      const std::vector<ttk::SimplexId> &bounds,
+                                      const std::vector<bool> &mask);
+template int ttk::Dijkstra::shortestPaths<float>(
+  const std::vector<ttk::SimplexId> &sources,
+  ttk::Triangulation &triangulation,
+  std::vector<Workspace<float>> &workspaces,
+  const std::function<void(const size_t, const Workspace<float> &)> &callback,
+  const std::vector<std::vector<ttk::SimplexId>> &bounds,
+  const std::vector<bool> &mask);
+template int ttk::Dijkstra::shortestPaths<double>(
+  const std::vector<ttk::SimplexId> &sources,
+  ttk::Triangulation &triangulation,
+  std::vector<Workspace<double>> &workspaces,
+  const std::function<void(const size_t, const Workspace<double> &)> &callback,
+  const std::vector<std::vector<ttk::SimplexId>> &bounds,
+  const std::vector<bool> &mask);
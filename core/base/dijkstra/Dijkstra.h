@@ -4,8 +4,234 @@
 #include <Triangulation.h>
 #include <Wrapper.h>
 
+#include <array>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <vector>
+
 namespace ttk {
   namespace Dijkstra {
+
+    /**
+     * @brief Monotone priority queue on non-negative floating-point keys
+     *
+     * Dijkstra never pushes a key lower than the last popped one, which
+     * enables a radix heap organization (one bucket per highest bit of the
+     * key representation differing from the last popped key). Non-negative
+     * IEEE-754 values are ordered as their bit patterns. The buckets are
+     * kept allocated between two queries.
+     */
+    template <typename T>
+    class RadixHeap {
+    public:
+      using Item = std::pair<T, SimplexId>;
+
+      inline void clear() {
+        for(auto &bucket : buckets_) {
+          bucket.clear();
+        }
+        last_ = 0;
+        size_ = 0;
+      }
+
+      inline bool empty() const {
+        return size_ == 0;
+      }
+
+      inline void push(const T key, const SimplexId vertexId) {
+        buckets_[getBucketId(toBits(key))].emplace_back(key, vertexId);
+        size_++;
+      }
+
+      inline Item pop() {
+        if(buckets_[0].empty()) {
+          size_t bucketId = 1;
+          while(buckets_[bucketId].empty()) {
+            bucketId++;
+          }
+
+          // new reference: minimum key of the first non-empty bucket
+          unsigned long long minBits = toBits(buckets_[bucketId][0].first);
+          for(const auto &item : buckets_[bucketId]) {
+            minBits = std::min(minBits, toBits(item.first));
+          }
+          last_ = minBits;
+
+          // all the items of this bucket move to lower buckets
+          items_.swap(buckets_[bucketId]);
+          for(const auto &item : items_) {
+            buckets_[getBucketId(toBits(item.first))].emplace_back(item);
+          }
+          items_.clear();
+        }
+
+        const Item item = buckets_[0].back();
+        buckets_[0].pop_back();
+        size_--;
+        return item;
+      }
+
+    private:
+      // non-negative keys only
+      static inline unsigned long long toBits(const float key) {
+        unsigned int bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return bits;
+      }
+      static inline unsigned long long toBits(const double key) {
+        unsigned long long bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return bits;
+      }
+
+      inline size_t getBucketId(const unsigned long long bits) const {
+        unsigned long long diff = bits ^ last_;
+        size_t bucketId = 0;
+        while(diff) {
+          diff >>= 1;
+          bucketId++;
+        }
+        return bucketId;
+      }
+
+      std::array<std::vector<Item>, 65> buckets_{};
+      std::vector<Item> items_{};
+      unsigned long long last_{};
+      size_t size_{};
+    };
+
+    template <typename T>
+    class Workspace;
+
+    /**
+     * @brief Compute the Dijkstra shortest path from source in a workspace
+     *
+     * The cost of a query only depends on the number of reached
+     * vertices. The search stops as soon as the distances to every
+     * bound vertex are final.
+     *
+     * @param[in] source Source vertex for the Dijkstra algorithm
+     * @param[in] triangulation Access to neighbor vertices
+     * @param[in,out] workspace Reusable state holding the output distances
+     * @param[in] bounds Stop the algorithim if all vertices are reached
+     * @param[in] mask Vector masking the triangulation
+     *
+     * @return 0 in case of success
+     */
+    template <typename T>
+    int shortestPath(const SimplexId source,
+                     Triangulation &triangulation,
+                     Workspace<T> &workspace,
+                     const std::vector<SimplexId> &bounds
+                     = std::vector<SimplexId>(),
+                     const std::vector<bool> &mask = std::vector<bool>());
+
+    /**
+     * @brief Reusable state for many (local) shortest path queries
+     *
+     * Distances and bounds are stored in arrays allocated once for the
+     * whole mesh and versioned with a query timestamp: a new query only
+     * touches the vertices it reaches instead of resetting every vertex.
+     * A workspace is not thread-safe: use one workspace per thread.
+     */
+    template <typename T>
+    class Workspace {
+    public:
+      /**
+       * @brief Allocate the workspace for a given mesh size
+       *
+       * @param[in] vertexNumber Number of vertices in the mesh
+       *
+       * @return 0 in case of success
+       */
+      inline int setVertexNumber(const SimplexId vertexNumber) {
+        if(static_cast<size_t>(vertexNumber) != dists_.size()) {
+          dists_.resize(vertexNumber);
+          stamps_.clear();
+          stamps_.resize(vertexNumber, 0);
+          boundStamps_.clear();
+          boundStamps_.resize(vertexNumber, 0);
+          stamp_ = 0;
+        }
+        return 0;
+      }
+
+      inline SimplexId getVertexNumber() const {
+        return dists_.size();
+      }
+
+      /**
+       * @brief Distance to the last query source
+       *
+       * @return infinity if the vertex was not reached
+       */
+      inline T getDistance(const SimplexId vertexId) const {
+        return stamps_[vertexId] == stamp_ ? dists_[vertexId]
+                                           : std::numeric_limits<T>::infinity();
+      }
+
+      /**
+       * @brief Vertices reached by the last query (finite distance)
+       */
+      inline const std::vector<SimplexId> &getReachedVertices() const {
+        return reached_;
+      }
+
+      /**
+       * @brief Copy the distances of the last query into a dense vector
+       *
+       * @param[out] outputDists Distances to source for every mesh vertex
+       *
+       * @return 0 in case of success
+       */
+      inline int getDistances(std::vector<T> &outputDists) const {
+        outputDists.clear();
+        outputDists.resize(dists_.size(), std::numeric_limits<T>::infinity());
+        for(const auto v : reached_) {
+          outputDists[v] = dists_[v];
+        }
+        return 0;
+      }
+
+    protected:
+      // start a new query (invalidates the previous distances)
+      inline void newQuery() {
+        stamp_++;
+        if(stamp_ == 0) {
+          // timestamp overflow: reset every vertex once
+          std::fill(stamps_.begin(), stamps_.end(), 0);
+          std::fill(boundStamps_.begin(), boundStamps_.end(), 0);
+          stamp_ = 1;
+        }
+        reached_.clear();
+        heap_.clear();
+      }
+
+      inline void setDistance(const SimplexId vertexId, const T dist) {
+        if(stamps_[vertexId] != stamp_) {
+          stamps_[vertexId] = stamp_;
+          reached_.emplace_back(vertexId);
+        }
+        dists_[vertexId] = dist;
+      }
+
+      std::vector<T> dists_{};
+      std::vector<unsigned int> stamps_{};
+      // bounds not reached yet by the current query
+      std::vector<unsigned int> boundStamps_{};
+      unsigned int stamp_{};
+      std::vector<SimplexId> reached_{};
+      RadixHeap<T> heap_{};
+
+      template <typename U>
+      friend int shortestPath(const SimplexId source,
+                              Triangulation &triangulation,
+                              Workspace<U> &workspace,
+                              const std::vector<SimplexId> &bounds,
+                              const std::vector<bool> &mask);
+    };
+
     /**
      * @brief Compute the Dijkstra shortest path from source
      *
@@ -25,5 +251,31 @@ namespace ttk {
                      = std::vector<SimplexId>(),
                      const std::vector<bool> &mask = std::vector<bool>());
 
+    /**
+     * @brief Compute many independent shortest paths in parallel
+     *
+     * Queries are dynamically distributed over the threads, each thread
+     * using its own workspace (allocated once, then reused across calls).
+     *
+     * @param[in] sources Source vertices, one per query
+     * @param[in] triangulation Access to neighbor vertices
+     * @param[in,out] workspaces One workspace per thread
+     * @param[in] callback Called on the query thread with the query index
+     * and the workspace holding its distances, once the query is done
+     * @param[in] bounds Per-query bounds (empty for no bound)
+     * @param[in] mask Vector masking the triangulation
+     *
+     * @return 0 in case of success
+     */
+    template <typename T>
+    int shortestPaths(
+      const std::vector<SimplexId> &sources,
+      Triangulation &triangulation,
+      std::vector<Workspace<T>> &workspaces,
+      const std::function<void(const size_t, const Workspace<T> &)> &callback,
+      const std::vector<std::vector<SimplexId>> &bounds
+      = std::vector<std::vector<SimplexId>>(),
+      const std::vector<bool> &mask = std::vector<bool>());
+
   } // namespace Dijkstra
 } // namespace ttk
@@ -8,12 +8,22 @@
 #include <numpy/arrayobject.h>
 #endif
 
+#ifdef TTK_ENABLE_EIGEN
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
 using namespace std;
 using namespace ttk;
 
 DimensionReduction::DimensionReduction()
   : numberOfRows_{0}, numberOfColumns_{0}, numberOfComponents_{0},
-    numberOfNeighbors_{0}, randomState_{0}, matrix_{nullptr},
+    numberOfNeighbors_{0}, randomState_{0}, backend_{Backend::Auto},
+    matrix_{nullptr},
     embedding_{nullptr}, majorVersion_{'0'} {
 #ifdef TTK_ENABLE_SCIKIT_LEARN
   auto finalize_callback = []() { Py_Finalize(); };
@@ -56,7 +66,37 @@ bool DimensionReduction::isPythonFound() const {
 #endif
 }
 
+bool DimensionReduction::useNativeBackend() const {
+#ifdef TTK_ENABLE_EIGEN
+  if(backend_ == Backend::Python)
+    return false;
+#ifdef TTK_ENABLE_SCIKIT_LEARN
+  // Auto keeps the scikit-learn results (e.g. SMACOF for MDS) when available
+  if(backend_ == Backend::Auto)
+    return false;
+#endif
+  // SE, MDS and PCA
+  return method_ == 0 or method_ == 2 or method_ == 5;
+#else
+  return false;
+#endif
+}
+
 int DimensionReduction::execute() const {
+  if(useNativeBackend())
+    return executeNative();
+
+  if(backend_ == Backend::Native) {
+    stringstream msg;
+    msg << "[DimensionReduction] No native implementation for this method, "
+        << "falling back to scikit-learn." << endl;
+    dMsg(cout, msg.str(), infoMsg);
+  }
+
+  return executePython();
+}
+
+int DimensionReduction::executePython() const {
 #ifdef TTK_ENABLE_SCIKIT_LEARN
 #ifndef TTK_ENABLE_KAMIKAZE
   if(majorVersion_ < '3')
@@ -412,3 +452,357 @@ collect_garbage:
 
   return 0;
 }
+
+#ifdef TTK_ENABLE_EIGEN
+namespace {
+
+  using RowMatrix
+    = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  // under this size, symmetric eigenproblems are solved exactly
+  const Eigen::Index denseEigenThreshold = 1000;
+  // additional random vectors of the randomized methods
+  const Eigen::Index oversampling = 10;
+
+  void gaussianMatrix(const Eigen::Index rows,
+                      const Eigen::Index cols,
+                      mt19937 &generator,
+                      Eigen::MatrixXd &m) {
+    normal_distribution<double> distribution(0.0, 1.0);
+    m.resize(rows, cols);
+    for(Eigen::Index j = 0; j < cols; ++j)
+      for(Eigen::Index i = 0; i < rows; ++i)
+        m(i, j) = distribution(generator);
+  }
+
+  // replaces m by an orthonormal basis of its column space
+  void orthonormalize(Eigen::MatrixXd &m) {
+    Eigen::HouseholderQR<Eigen::MatrixXd> qr(m);
+    m = qr.householderQ() * Eigen::MatrixXd::Identity(m.rows(), m.cols());
+  }
+
+  // makes the entry of largest magnitude of each column positive
+  void flipSigns(Eigen::MatrixXd &m) {
+    for(Eigen::Index j = 0; j < m.cols(); ++j) {
+      Eigen::Index i;
+      m.col(j).cwiseAbs().maxCoeff(&i);
+      if(m(i, j) < 0)
+        m.col(j) *= -1;
+    }
+  }
+
+  void denseTopEigenpairs(const Eigen::MatrixXd &a,
+                          const Eigen::Index k,
+                          Eigen::VectorXd &values,
+                          Eigen::MatrixXd &vectors) {
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(a);
+    // eigenvalues are sorted in increasing order
+    values = solver.eigenvalues().tail(k).reverse();
+    vectors = solver.eigenvectors().rightCols(k).rowwise().reverse();
+  }
+
+  // k algebraically largest eigenpairs of the symmetric matrix a by subspace
+  // iteration on (a + shift.I), shift making the operator positive
+  // semi-definite
+  template <typename MatrixType>
+  void iterativeTopEigenpairs(const MatrixType &a,
+                              const Eigen::Index k,
+                              const double shift,
+                              const int maxIteration,
+                              const double tolerance,
+                              mt19937 &generator,
+                              Eigen::VectorXd &values,
+                              Eigen::MatrixXd &vectors) {
+    const Eigen::Index n = a.rows();
+    const Eigen::Index l = std::min(n, k + oversampling);
+
+    Eigen::MatrixXd q;
+    gaussianMatrix(n, l, generator, q);
+    orthonormalize(q);
+
+    Eigen::MatrixXd aq;
+    Eigen::VectorXd previous = Eigen::VectorXd::Zero(k);
+    for(int it = 1; it <= maxIteration; ++it) {
+      aq = a * q;
+      if(it % 10 == 0) {
+        // Ritz values convergence test
+        const Eigen::MatrixXd t = q.transpose() * aq;
+        Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(t);
+        const Eigen::VectorXd current = solver.eigenvalues().tail(k);
+        const double scale = std::max(current.cwiseAbs().maxCoeff(), 1e-300);
+        if((current - previous).cwiseAbs().maxCoeff() <= tolerance * scale)
+          break;
+        previous = current;
+      }
+      q = aq + shift * q;
+      orthonormalize(q);
+    }
+
+    // Rayleigh-Ritz projection
+    aq = a * q;
+    const Eigen::MatrixXd t = q.transpose() * aq;
+    Eigen::VectorXd ritzValues;
+    Eigen::MatrixXd ritzVectors;
+    denseTopEigenpairs(t, k, ritzValues, ritzVectors);
+    values = ritzValues;
+    vectors = q * ritzVectors;
+  }
+
+  void squaredDistances(const RowMatrix &x, Eigen::MatrixXd &d, int threads) {
+    const Eigen::Index n = x.rows();
+    d.resize(n, n);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threads)
+#endif
+    for(Eigen::Index i = 0; i < n; ++i) {
+      d(i, i) = 0;
+      for(Eigen::Index j = i + 1; j < n; ++j) {
+        const double s = (x.row(i) - x.row(j)).squaredNorm();
+        d(i, j) = s;
+        d(j, i) = s;
+      }
+    }
+  }
+
+} // namespace
+#endif // TTK_ENABLE_EIGEN
+
+int DimensionReduction::executeNative() const {
+#ifdef TTK_ENABLE_EIGEN
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!matrix_ or !embedding_)
+    return -1;
+  if(numberOfRows_ <= 0 or numberOfColumns_ <= 0)
+    return -1;
+#endif
+
+  Timer t;
+
+  const int numberOfComponents = std::max(2, numberOfComponents_);
+  const Eigen::Index n = numberOfRows_;
+  const Eigen::Index d = numberOfColumns_;
+  const Eigen::Map<const RowMatrix> input(
+    static_cast<const double *>(matrix_), n, d);
+
+  mt19937 generator(randomState_ > 0 ? 0 : random_device()());
+  Eigen::setNbThreads(threadNumber_);
+
+  // n x numberOfComponents embedding
+  Eigen::MatrixXd result = Eigen::MatrixXd::Zero(n, numberOfComponents);
+
+  string methodName;
+
+  if(method_ == 5) {
+    methodName = "PCA";
+
+    // centering
+    RowMatrix x(n, d);
+    const Eigen::RowVectorXd mean = input.colwise().mean();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(Eigen::Index i = 0; i < n; ++i)
+      x.row(i) = input.row(i) - mean;
+
+    const Eigen::Index rank = std::min(n, d);
+    const Eigen::Index k = std::min<Eigen::Index>(numberOfComponents, rank);
+    const Eigen::Index l = std::min(rank, k + oversampling);
+
+    Eigen::MatrixXd u;
+    Eigen::VectorXd s;
+    if(pca_SVDSolver == "full" or l == rank) {
+      Eigen::BDCSVD<Eigen::MatrixXd> svd(
+        x, Eigen::ComputeThinU | Eigen::ComputeThinV);
+      u = svd.matrixU().leftCols(k);
+      s = svd.singularValues().head(k);
+    } else {
+      // randomized SVD (Halko et al.) with power iterations
+      int powerIterations = (k < 0.1 * rank) ? 7 : 4;
+      if(pca_MaxIteration != "auto")
+        powerIterations = std::max(0, atoi(pca_MaxIteration.data()));
+
+      Eigen::MatrixXd omega;
+      gaussianMatrix(d, l, generator, omega);
+      Eigen::MatrixXd y = x * omega;
+      orthonormalize(y);
+      for(int i = 0; i < powerIterations; ++i) {
+        Eigen::MatrixXd z = x.transpose() * y;
+        orthonormalize(z);
+        y = x * z;
+        orthonormalize(y);
+      }
+
+      const Eigen::MatrixXd b = y.transpose() * x;
+      Eigen::JacobiSVD<Eigen::MatrixXd> svd(b, Eigen::ComputeThinU);
+      u = y * svd.matrixU().leftCols(k);
+      s = svd.singularValues().head(k);
+    }
+    flipSigns(u);
+
+    if(pca_Whiten)
+      result.leftCols(k) = u * std::sqrt(static_cast<double>(n - 1));
+    else
+      result.leftCols(k) = u * s.asDiagonal();
+  } else if(method_ == 2) {
+    methodName = "MDS";
+
+    // classical (Torgerson) scaling: eigen-decomposition of the
+    // double-centered squared distance matrix
+    Eigen::MatrixXd b;
+    if(mds_Dissimilarity == "precomputed") {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(n != d) {
+        cerr << "[DimensionReduction] Error: precomputed dissimilarities "
+             << "require a square matrix." << endl;
+        return -1;
+      }
+#endif
+      b = input.cwiseAbs2();
+    } else
+      squaredDistances(input, b, threadNumber_);
+
+    const Eigen::VectorXd rowMean = b.rowwise().mean();
+    const Eigen::RowVectorXd colMean = b.colwise().mean();
+    const double mean = rowMean.mean();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(Eigen::Index j = 0; j < n; ++j) {
+      for(Eigen::Index i = 0; i < n; ++i)
+        b(i, j) = -0.5 * (b(i, j) - rowMean(i) - colMean(j) + mean);
+    }
+    // symmetrize precomputed inputs
+    if(mds_Dissimilarity == "precomputed")
+      b = 0.5 * (b + b.transpose()).eval();
+
+    const Eigen::Index k = std::min<Eigen::Index>(numberOfComponents, n);
+    Eigen::VectorXd values;
+    Eigen::MatrixXd vectors;
+    if(n <= denseEigenThreshold)
+      denseTopEigenpairs(b, k, values, vectors);
+    else
+      // b is positive semi-definite for euclidean inputs: no shift
+      iterativeTopEigenpairs(
+        b, k, 0.0, 1000, 1e-10, generator, values, vectors);
+    flipSigns(vectors);
+
+    for(Eigen::Index i = 0; i < k; ++i)
+      result.col(i) = vectors.col(i) * std::sqrt(std::max(0.0, values(i)));
+  } else if(method_ == 0) {
+    methodName = "SE";
+
+    // affinity matrix
+    const bool isSparse = se_Affinity == "nearest_neighbors";
+    Eigen::MatrixXd w;
+    Eigen::SparseMatrix<double> sw;
+    if(se_Affinity == "precomputed") {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(n != d) {
+        cerr << "[DimensionReduction] Error: precomputed affinities "
+             << "require a square matrix." << endl;
+        return -1;
+      }
+#endif
+      w = 0.5 * (input + input.transpose());
+    } else if(isSparse) {
+      // symmetrized k-nearest neighbors connectivity (self included)
+      const Eigen::Index numberOfNeighbors
+        = std::min<Eigen::Index>(std::max(1, numberOfNeighbors_), n);
+      vector<vector<Eigen::Index>> neighbors(n);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+      {
+        vector<pair<double, Eigen::Index>> candidates(n);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for(Eigen::Index i = 0; i < n; ++i) {
+          for(Eigen::Index j = 0; j < n; ++j)
+            candidates[j] = {(input.row(i) - input.row(j)).squaredNorm(), j};
+          // the point itself comes first (null distance, smallest index
+          // among duplicates)
+          candidates[i].first = -1;
+          partial_sort(candidates.begin(),
+                       candidates.begin() + numberOfNeighbors,
+                       candidates.end());
+          neighbors[i].resize(numberOfNeighbors);
+          for(Eigen::Index j = 0; j < numberOfNeighbors; ++j)
+            neighbors[i][j] = candidates[j].second;
+        }
+      }
+
+      vector<Eigen::Triplet<double>> triplets;
+      triplets.reserve(2 * n * numberOfNeighbors);
+      for(Eigen::Index i = 0; i < n; ++i) {
+        for(const auto j : neighbors[i]) {
+          triplets.emplace_back(i, j, 0.5);
+          triplets.emplace_back(j, i, 0.5);
+        }
+      }
+      sw.resize(n, n);
+      sw.setFromTriplets(triplets.begin(), triplets.end());
+    } else {
+      // rbf kernel
+      const double gamma = se_Gamma > 0 ? se_Gamma : 1.0 / d;
+      squaredDistances(input, w, threadNumber_);
+      // flush denormals to zero, they slow down the products a lot
+      w = (-gamma * w).array().exp().matrix().unaryExpr([](const double x) {
+        return x < numeric_limits<double>::min() ? 0.0 : x;
+      });
+    }
+
+    // normalized affinity D^-1/2.W.D^-1/2, whose top eigenvectors are the
+    // bottom ones of the normalized graph Laplacian
+    const Eigen::VectorXd degrees
+      = isSparse ? Eigen::VectorXd(sw * Eigen::VectorXd::Ones(n))
+                 : Eigen::VectorXd(w.rowwise().sum());
+    const Eigen::VectorXd invSqrtDegrees
+      = degrees.unaryExpr([](const double x) {
+          return x > 0 ? 1.0 / std::sqrt(x) : 0.0;
+        });
+    if(isSparse)
+      sw = invSqrtDegrees.asDiagonal() * sw * invSqrtDegrees.asDiagonal();
+    else
+      w = invSqrtDegrees.asDiagonal() * w * invSqrtDegrees.asDiagonal();
+
+    // the first eigenvector is trivial (eigenvalue 1)
+    const Eigen::Index k
+      = std::min<Eigen::Index>(numberOfComponents + 1, n);
+    Eigen::VectorXd values;
+    Eigen::MatrixXd vectors;
+    if(n <= denseEigenThreshold)
+      denseTopEigenpairs(
+        isSparse ? Eigen::MatrixXd(sw) : w, k, values, vectors);
+    else if(isSparse)
+      iterativeTopEigenpairs(
+        sw, k, 1.0, 1000, 1e-10, generator, values, vectors);
+    else
+      iterativeTopEigenpairs(
+        w, k, 1.0, 1000, 1e-10, generator, values, vectors);
+
+    vectors = invSqrtDegrees.asDiagonal() * vectors;
+    flipSigns(vectors);
+    result.leftCols(k - 1) = vectors.rightCols(k - 1);
+  } else {
+    return -2;
+  }
+
+  embedding_->resize(numberOfComponents);
+  for(int i = 0; i < numberOfComponents; ++i)
+    (*embedding_)[i].assign(
+      result.col(i).data(), result.col(i).data() + numberOfRows_);
+
+  {
+    stringstream msg;
+    msg << "[DimensionReduction] " << methodName << " (native) computed in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+#else
+  return -1;
+#endif
+}
@@ -11,6 +11,11 @@
 /// \brief TTK VTK-filter that takes a matrix (vtkTable) as input and apply a
 /// dimension reduction algorithm from scikit-learn.
 ///
+/// Spectral Embedding, classical Multi-Dimensional Scaling and Principal
+/// Component Analysis also have a native implementation (based on Eigen),
+/// which does not require Python and is used by default when available. The
+/// other methods, or an explicit request, go through scikit-learn.
+///
 /// \sa ttk::Triangulation
 /// \sa ttkDimensionReduction.cpp %for a usage example.
 
@@ -24,6 +29,8 @@ namespace ttk {
   class DimensionReduction : public Debug {
 
   public:
+    enum class Backend { Auto = 0, Native = 1, Python = 2 };
+
     DimensionReduction();
     ~DimensionReduction();
 
@@ -168,6 +175,11 @@ namespace ttk {
       return 0;
     }
 
+    inline int setInputBackend(const Backend backend) {
+      backend_ = backend;
+      return 0;
+    }
+
     inline int setOutputComponents(std::vector<std::vector<double>> *data) {
       embedding_ = data;
       return 0;
@@ -175,9 +187,17 @@ namespace ttk {
 
     bool isPythonFound() const;
 
+    /// Returns true if the current method is going to be computed by the
+    /// native backend (Eigen support enabled and method implemented). The
+    /// Auto backend only uses it when scikit-learn support is disabled.
+    bool useNativeBackend() const;
+
     int execute() const;
 
   protected:
+    int executeNative() const;
+    int executePython() const;
+
     // se
     std::string se_Affinity;
     float se_Gamma;
@@ -237,6 +257,7 @@ namespace ttk {
     int numberOfComponents_;
     int numberOfNeighbors_;
     int randomState_;
+    Backend backend_;
     void *matrix_;
     std::vector<std::vector<double>> *embedding_;
     char majorVersion_;
@@ -4,7 +4,7 @@ using namespace std;
 using namespace ttk;
 
 DistanceField::DistanceField()
-  : vertexNumber_{}, sourceNumber_{}, triangulation_{},
+  : vertexNumber_{}, sourceNumber_{}, method_{}, triangulation_{},
     vertexIdentifierScalarFieldPointer_{}, outputScalarFieldPointer_{},
     outputIdentifiers_{}, outputSegmentation_{} {
 }
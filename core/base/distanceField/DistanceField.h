@@ -10,11 +10,19 @@
 /// identifiers attached to them) and produces a distance field to the closest
 /// source.
 ///
-/// \b Related \b publication \n
+/// Distances either follow the mesh edges (Dijkstra) or are geodesic
+/// distances computed by a fast marching solver propagating through the
+/// triangles and tetrahedra of the mesh (see ttk::FastMarching).
+///
+/// \b Related \b publications \n
 /// "A note on two problems in connexion with graphs" \n
 /// Edsger W. Dijkstra \n
 /// Numerische Mathematik, 1959.
 ///
+/// "A Fast Iterative Method for Eikonal Equations" \n
+/// Won-Ki Jeong, Ross T. Whitaker \n
+/// SIAM Journal on Scientific Computing, 2008.
+///
 /// \sa ttkDistanceField.cpp %for a usage example.
 
 #ifndef _DISTANCEFIELD_H
@@ -22,6 +30,7 @@
 
 // base code includes
 #include <Dijkstra.h>
+#include <FastMarching.h>
 #include <Geometry.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
@@ -54,6 +63,13 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the distance computation method.
+    /// \param method 0: Dijkstra (mesh edges), 1: fast marching (geodesic).
+    inline int setMethod(int method) {
+      method_ = method;
+      return 0;
+    }
+
     inline int setupTriangulation(Triangulation *triangulation) {
       triangulation_ = triangulation;
       if(triangulation_) {
@@ -85,6 +101,7 @@ namespace ttk {
   protected:
     SimplexId vertexNumber_;
     SimplexId sourceNumber_;
+    int method_;
     Triangulation *triangulation_;
     void *vertexIdentifierScalarFieldPointer_;
     void *outputScalarFieldPointer_;
@@ -118,11 +135,28 @@ int ttk::DistanceField::execute() const {
   // prepare output
   std::vector<std::vector<dataType>> scalars(sources.size());
 
+  if(method_ == 1) {
+    triangulation_->preprocessVertexStars();
+
+    // few sources: parallelism inside the solver
+    const int solverThreadNumber
+      = (SimplexId)sources.size() < threadNumber_ ? threadNumber_ : 1;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_ / solverThreadNumber)
+#endif
+    for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
+      FastMarching::shortestPath<dataType>(
+        sources[i], *triangulation_, scalars[i], std::vector<SimplexId>(),
+        std::vector<bool>(), solverThreadNumber);
+    }
+  } else {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
-    Dijkstra::shortestPath<dataType>(sources[i], *triangulation_, scalars[i]);
+    for(SimplexId i = 0; i < (SimplexId)sources.size(); ++i) {
+      Dijkstra::shortestPath<dataType>(sources[i], *triangulation_, scalars[i]);
+    }
   }
 
 #ifdef TTK_ENABLE_OPENMP
@@ -1,11 +1,17 @@
 #include <EigenField.h>
 #include <Laplacian.h>
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
 #define MODULE_S "[EigenField] "
 
 #if defined(TTK_ENABLE_EIGEN) && defined(TTK_ENABLE_SPECTRA)
 #include <Eigen/Eigenvalues>
 #include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
 
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
@@ -13,11 +19,227 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif // __GNUC__
 #include <Spectra/MatOp/SparseSymMatProd.h>
+#include <Spectra/SymEigsShiftSolver.h>
 #include <Spectra/SymEigsSolver.h>
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #endif // __GNUC__
 
+namespace ttk {
+
+  // cached Laplacian factorization and eigenpairs for one floating-point
+  // type
+  template <typename T>
+  struct EigenBasis {
+    using SpMat = Eigen::SparseMatrix<T>;
+    using DMat = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+    using Vec = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+    // cotangent Laplacian
+    SpMat lap{};
+    // sparse LDLT factorization of lap - shift * I
+    Eigen::SimplicialLDLT<SpMat> factor{};
+    bool factorized{false};
+    T shift{};
+    // eigenpairs (in solver order) and solver mode used
+    Vec eigenvalues{};
+    DMat eigenvectors{};
+    int mode{-1};
+  };
+
+  // shift-invert operator for Spectra, deflating known eigenvectors
+  //
+  // y = P (L - shift * I)^-1 P x, with P = I - V V^T the projection onto
+  // the orthogonal complement of the (orthonormal) known eigenvectors V:
+  // those get a zero Ritz value and are not computed again.
+  template <typename T>
+  class DeflatedShiftSolve {
+  public:
+    using SpMat = typename EigenBasis<T>::SpMat;
+    using DMat = typename EigenBasis<T>::DMat;
+    using Vec = typename EigenBasis<T>::Vec;
+
+    DeflatedShiftSolve(const Eigen::SimplicialLDLT<SpMat> &factor,
+                       const DMat &deflated)
+      : factor_(factor), deflated_(deflated) {
+    }
+
+    inline Eigen::Index rows() const {
+      return factor_.rows();
+    }
+    inline Eigen::Index cols() const {
+      return factor_.cols();
+    }
+    // the shift is applied beforehand by the factorization
+    inline void set_shift(const T) {
+    }
+
+    void perform_op(const T *x_in, T *y_out) const {
+      Eigen::Map<const Vec> x(x_in, rows());
+      Eigen::Map<Vec> y(y_out, rows());
+      if(deflated_.cols() == 0) {
+        y.noalias() = factor_.solve(x);
+        return;
+      }
+      const Vec px = x - deflated_ * (deflated_.transpose() * x);
+      y.noalias() = factor_.solve(px);
+      y -= deflated_ * (deflated_.transpose() * y);
+    }
+
+  private:
+    const Eigen::SimplicialLDLT<SpMat> &factor_;
+    const DMat &deflated_;
+  };
+
+} // namespace ttk
+
+struct ttk::EigenField::Cache {
+  // mesh the cache was computed on
+  const Triangulation *triangulation{};
+  SimplexId vertexNumber{};
+  SimplexId edgeNumber{};
+
+  EigenBasis<float> floatBasis{};
+  EigenBasis<double> doubleBasis{};
+
+  inline EigenBasis<float> &basis(float) {
+    return floatBasis;
+  }
+  inline EigenBasis<double> &basis(double) {
+    return doubleBasis;
+  }
+};
+
+namespace {
+
+  // eigenbasis file header
+  const char eigenBasisMagic[8] = {'T', 'T', 'K', 'E', 'I', 'G', 'B', '1'};
+
+  // FNV-1a hash of the mesh geometry and connectivity, identifies the
+  // mesh of a stored eigenbasis
+  std::uint64_t meshHash(ttk::Triangulation &triangulation) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    const auto combine = [&hash](const void *data, const size_t size) {
+      const auto bytes = static_cast<const unsigned char *>(data);
+      for(size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+      }
+    };
+    const auto vertexNumber = triangulation.getNumberOfVertices();
+    for(ttk::SimplexId i = 0; i < vertexNumber; ++i) {
+      float p[3];
+      triangulation.getVertexPoint(i, p[0], p[1], p[2]);
+      combine(p, sizeof(p));
+    }
+    const auto edgeNumber = triangulation.getNumberOfEdges();
+    for(ttk::SimplexId i = 0; i < edgeNumber; ++i) {
+      ttk::SimplexId e[2];
+      triangulation.getEdgeVertex(i, 0, e[0]);
+      triangulation.getEdgeVertex(i, 1, e[1]);
+      combine(e, sizeof(e));
+    }
+    return hash;
+  }
+
+  // read a stored eigenbasis, 0 upon success
+  template <typename T>
+  int loadEigenBasis(const std::string &fileName,
+                     const std::uint64_t hash,
+                     const ttk::SimplexId vertexNumber,
+                     const int mode,
+                     ttk::EigenBasis<T> &basis) {
+
+    std::ifstream file(fileName, std::ios::binary);
+    if(!file.good()) {
+      return -1;
+    }
+
+    char magic[sizeof(eigenBasisMagic)];
+    std::uint64_t fileHash{};
+    std::int64_t n{}, m{};
+    std::int32_t fileMode{};
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&fileHash), sizeof(fileHash));
+    file.read(reinterpret_cast<char *>(&n), sizeof(n));
+    file.read(reinterpret_cast<char *>(&m), sizeof(m));
+    file.read(reinterpret_cast<char *>(&fileMode), sizeof(fileMode));
+
+    // not the same mesh or not the same kind of eigenfunctions
+    if(!file.good() || std::memcmp(magic, eigenBasisMagic, sizeof(magic)) != 0
+       || fileHash != hash || n != vertexNumber || fileMode != mode
+       || m <= 0) {
+      return -2;
+    }
+
+    // stored as double precision values, one eigenvector after the other
+    std::vector<double> eigenvalues(m);
+    std::vector<double> eigenvectors(n * m);
+    file.read(reinterpret_cast<char *>(eigenvalues.data()),
+              eigenvalues.size() * sizeof(double));
+    file.read(reinterpret_cast<char *>(eigenvectors.data()),
+              eigenvectors.size() * sizeof(double));
+    if(!file.good()) {
+      return -3;
+    }
+
+    basis.eigenvalues.resize(m);
+    basis.eigenvectors.resize(n, m);
+    for(std::int64_t j = 0; j < m; ++j) {
+      basis.eigenvalues(j) = eigenvalues[j];
+      for(std::int64_t i = 0; i < n; ++i) {
+        basis.eigenvectors(i, j) = eigenvectors[j * n + i];
+      }
+    }
+    basis.mode = mode;
+
+    return 0;
+  }
+
+  // write the eigenbasis, 0 upon success
+  template <typename T>
+  int saveEigenBasis(const std::string &fileName,
+                     const std::uint64_t hash,
+                     const ttk::EigenBasis<T> &basis) {
+
+    std::ofstream file(fileName, std::ios::binary);
+    if(!file.good()) {
+      return -1;
+    }
+
+    const std::int64_t n = basis.eigenvectors.rows();
+    const std::int64_t m = basis.eigenvectors.cols();
+    const std::int32_t mode = basis.mode;
+    file.write(eigenBasisMagic, sizeof(eigenBasisMagic));
+    file.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+    file.write(reinterpret_cast<const char *>(&n), sizeof(n));
+    file.write(reinterpret_cast<const char *>(&m), sizeof(m));
+    file.write(reinterpret_cast<const char *>(&mode), sizeof(mode));
+
+    std::vector<double> values(m);
+    for(std::int64_t j = 0; j < m; ++j) {
+      values[j] = basis.eigenvalues(j);
+    }
+    file.write(reinterpret_cast<const char *>(values.data()),
+               values.size() * sizeof(double));
+    values.resize(n);
+    for(std::int64_t j = 0; j < m; ++j) {
+      for(std::int64_t i = 0; i < n; ++i) {
+        values[i] = basis.eigenvectors(i, j);
+      }
+      file.write(reinterpret_cast<const char *>(values.data()),
+                 values.size() * sizeof(double));
+    }
+
+    return file.good() ? 0 : -2;
+  }
+
+} // namespace
+
+#else
+
+struct ttk::EigenField::Cache {};
+
 #endif // TTK_ENABLE_EIGEN && TTK_ENABLE_SPECTRA
 
 // main routine
@@ -32,8 +254,9 @@ int ttk::EigenField::execute() const {
   Eigen::setNbThreads(threadNumber_);
 #endif // TTK_ENABLE_OPENMP
 
-  using SpMat = Eigen::SparseMatrix<T>;
-  using DMat = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+  using SpMat = typename EigenBasis<T>::SpMat;
+  using DMat = typename EigenBasis<T>::DMat;
+  using Vec = typename EigenBasis<T>::Vec;
 
   {
     std::stringstream msg;
@@ -41,15 +264,21 @@ int ttk::EigenField::execute() const {
     dMsg(std::cout, msg.str(), timeMsg);
   }
 
-  // graph laplacian of current mesh
-  SpMat lap;
-  // compute graph laplacian using cotangent weights
-  Laplacian::cotanWeights<T>(lap, *triangulation_);
-  // lap is square
-  eigen_plain_assert(lap.cols() == lap.rows());
+  // reset the cache if the mesh has changed
+  const auto edgeNumber = triangulation_->getNumberOfEdges();
+  if(cache_ == nullptr || cache_->triangulation != triangulation_
+     || cache_->vertexNumber != vertexNumber_
+     || cache_->edgeNumber != edgeNumber) {
+    cache_ = std::make_shared<Cache>();
+    cache_->triangulation = triangulation_;
+    cache_->vertexNumber = vertexNumber_;
+    cache_->edgeNumber = edgeNumber;
+  }
+  auto &basis = cache_->basis(T{});
+  const int mode = static_cast<int>(solverMode_);
 
-  auto n = lap.cols();
-  auto m = eigenNumber_;
+  const Eigen::Index n = vertexNumber_;
+  Eigen::Index m = eigenNumber_;
   // threshold: minimal number of eigenpairs to get a converging solution
   const size_t minEigenNumber = 20;
 
@@ -59,36 +288,178 @@ int ttk::EigenField::execute() const {
   } else if(eigenNumber_ < minEigenNumber) {
     m = minEigenNumber;
   }
+  m = std::min(m, n - 1);
 
-  Spectra::SparseSymMatProd<T> op(lap);
-  Spectra::SymEigsSolver<T, Spectra::LARGEST_ALGE, decltype(op)> solver(
-    &op, m, 2 * m);
-
-  solver.init();
+  // eigenpairs from another solver mode cannot be reused
+  if(basis.mode != mode) {
+    basis.eigenvalues.resize(0);
+    basis.eigenvectors.resize(n, 0);
+    basis.mode = mode;
+  }
 
-  // number of eigenpairs correctly computed
-  int nconv = solver.compute();
+  // stored eigenbasis from a previous session
+  std::uint64_t hash{};
+  if(!eigenBasisFile_.empty()) {
+    hash = meshHash(*triangulation_);
+    if(basis.eigenvectors.cols() < m
+       && loadEigenBasis(eigenBasisFile_, hash, vertexNumber_, mode, basis)
+            == 0) {
+      std::stringstream msg;
+      msg << MODULE_S "Loaded " << basis.eigenvectors.cols()
+          << " eigenpairs from " << eigenBasisFile_ << std::endl;
+      dMsg(std::cout, msg.str(), infoMsg);
+    }
+  }
 
-  {
+  if(basis.eigenvectors.cols() >= m) {
     std::stringstream msg;
-    switch(solver.info()) {
-      case Spectra::COMPUTATION_INFO::NUMERICAL_ISSUE:
-        msg << MODULE_S "Numerical Issue!" << std::endl;
-        break;
-      case Spectra::COMPUTATION_INFO::NOT_CONVERGING:
-        msg << MODULE_S "No Convergence! (" << nconv << " out of "
-            << eigenNumber_ << " values computed)" << std::endl;
-        break;
-      case Spectra::COMPUTATION_INFO::NOT_COMPUTED:
-        msg << MODULE_S "Invalid Input!" << std::endl;
-        break;
-      default:
-        break;
-    }
+    msg << MODULE_S "Reusing " << basis.eigenvectors.cols()
+        << " cached eigenpairs" << std::endl;
     dMsg(std::cout, msg.str(), infoMsg);
+  } else {
+
+    if(basis.lap.size() == 0) {
+      // compute graph laplacian using cotangent weights
+      Laplacian::cotanWeights<T>(basis.lap, *triangulation_);
+      // lap is square
+      eigen_plain_assert(basis.lap.cols() == basis.lap.rows());
+    }
+
+    // number of eigenpairs correctly computed
+    Eigen::Index nconv{};
+    int info{};
+    Vec eigenvalues{};
+    DMat eigenvectors{};
+
+    if(solverMode_ == SolverMode::SHIFT_INVERT) {
+
+      if(!basis.factorized) {
+        Timer tf;
+        // the Laplacian is semi-definite (constant functions in its
+        // kernel): shift it away from its spectrum to get a definite matrix
+        basis.shift = -std::sqrt(std::numeric_limits<T>::epsilon())
+                      * basis.lap.diagonal().mean();
+        SpMat shifted = basis.lap;
+        for(Eigen::Index i = 0; i < n; ++i) {
+          shifted.coeffRef(i, i) -= basis.shift;
+        }
+        basis.factor.compute(shifted);
+        if(basis.factor.info() != Eigen::Success) {
+          std::stringstream msg;
+          msg << MODULE_S "Laplacian factorization failed!" << std::endl;
+          dMsg(std::cerr, msg.str(), fatalMsg);
+          return -1;
+        }
+        basis.factorized = true;
+
+        std::stringstream msg;
+        msg << MODULE_S "Laplacian factorized in " << tf.getElapsedTime()
+            << "s" << std::endl;
+        dMsg(std::cout, msg.str(), timeMsg);
+      }
+
+      // only compute the missing eigenpairs, the known ones are deflated
+      // Spectra requires 0 < nev < ncv <= n (n - known once deflated)
+      const Eigen::Index known = basis.eigenvectors.cols();
+      const Eigen::Index nev = std::min(m - known, n - known - 1);
+      const Eigen::Index ncv = std::min(
+        std::max(2 * nev, nev + Eigen::Index(minEigenNumber)), n - known);
+      if(nev < 1 || ncv <= nev || ncv > n) {
+        std::stringstream msg;
+        msg << MODULE_S "Invalid number of eigenpairs (" << nev
+            << " requested, " << known << " known, " << n << " vertices)!"
+            << std::endl;
+        dMsg(std::cerr, msg.str(), fatalMsg);
+        return -1;
+      }
+
+      DeflatedShiftSolve<T> op(basis.factor, basis.eigenvectors);
+      Spectra::SymEigsShiftSolver<T, Spectra::LARGEST_MAGN, decltype(op)>
+        solver(&op, nev, ncv, basis.shift);
+
+      solver.init();
+      // lowest frequencies first
+      nconv = solver.compute(1000, T(1e-10), Spectra::SMALLEST_MAGN);
+      info = solver.info();
+      if(nconv > 0) {
+        eigenvalues = solver.eigenvalues();
+        eigenvectors = solver.eigenvectors();
+      }
+
+    } else {
+
+      // Spectra requires 0 < nev < ncv <= n
+      const Eigen::Index ncv = std::min(2 * m, n);
+      if(m < 1 || ncv <= m) {
+        std::stringstream msg;
+        msg << MODULE_S "Invalid number of eigenpairs (" << m << " requested, "
+            << n << " vertices)!" << std::endl;
+        dMsg(std::cerr, msg.str(), fatalMsg);
+        return -1;
+      }
+
+      Spectra::SparseSymMatProd<T> op(basis.lap);
+      Spectra::SymEigsSolver<T, Spectra::LARGEST_ALGE, decltype(op)> solver(
+        &op, m, ncv);
+
+      solver.init();
+      nconv = solver.compute();
+      info = solver.info();
+      if(nconv > 0) {
+        eigenvalues = solver.eigenvalues();
+        eigenvectors = solver.eigenvectors();
+      }
+      // the whole spectrum part is recomputed
+      basis.eigenvalues.resize(0);
+      basis.eigenvectors.resize(n, 0);
+    }
+
+    {
+      std::stringstream msg;
+      switch(info) {
+        case Spectra::COMPUTATION_INFO::NUMERICAL_ISSUE:
+          msg << MODULE_S "Numerical Issue!" << std::endl;
+          break;
+        case Spectra::COMPUTATION_INFO::NOT_CONVERGING:
+          msg << MODULE_S "No Convergence! (" << nconv << " out of "
+              << eigenNumber_ << " values computed)" << std::endl;
+          break;
+        case Spectra::COMPUTATION_INFO::NOT_COMPUTED:
+          msg << MODULE_S "Invalid Input!" << std::endl;
+          break;
+        default:
+          break;
+      }
+      dMsg(std::cout, msg.str(), infoMsg);
+    }
+
+    // append the new eigenpairs to the cached ones
+    const Eigen::Index known = basis.eigenvectors.cols();
+    const Eigen::Index added = eigenvectors.cols();
+    basis.eigenvalues.conservativeResize(known + added);
+    basis.eigenvalues.tail(added) = eigenvalues;
+    basis.eigenvectors.conservativeResize(n, known + added);
+    basis.eigenvectors.rightCols(added) = eigenvectors;
+
+    {
+      std::stringstream msg;
+      msg << MODULE_S "Computed " << added << " eigenpairs (" << known
+          << " reused)" << std::endl;
+      dMsg(std::cout, msg.str(), infoMsg);
+    }
+
+    if(!eigenBasisFile_.empty() && added > 0
+       && saveEigenBasis(eigenBasisFile_, hash, basis) != 0) {
+      std::stringstream msg;
+      msg << MODULE_S "Could not write " << eigenBasisFile_ << std::endl;
+      dMsg(std::cerr, msg.str(), infoMsg);
+    }
   }
 
-  DMat eigenvectors = solver.eigenvectors();
+  const DMat &eigenvectors = basis.eigenvectors;
+  // eigenfunctions that did not converge are set to zero
+  const size_t availableNumber
+    = std::min<size_t>(eigenNumber_, eigenvectors.cols());
 
   auto outputEigenFunctions = static_cast<T *>(outputFieldPointer_);
 
@@ -98,7 +469,8 @@ int ttk::EigenField::execute() const {
   for(SimplexId i = 0; i < vertexNumber_; ++i) {
     for(size_t j = 0; j < eigenNumber_; ++j) {
       // cannot avoid copy here...
-      outputEigenFunctions[i * eigenNumber_ + j] = eigenvectors(i, j);
+      outputEigenFunctions[i * eigenNumber_ + j]
+        = j < availableNumber ? eigenvectors(i, j) : T{};
     }
   }
 
@@ -7,6 +7,16 @@
 /// \brief TTK processing package for computing eigenfunctions of a
 /// triangular mesh.
 ///
+/// The low-frequency eigenfunctions of the cotangent Laplacian can also
+/// be computed in (experimental) shift-invert mode (smallest-magnitude
+/// eigenvalues, using a sparse Cholesky factorization of the Laplacian
+/// that is kept between two executions). Computed eigenpairs are cached
+/// as well: asking for fewer eigenfunctions needs no computation and
+/// asking for more only computes the missing ones (the known
+/// eigenvectors being deflated from the operator). Eigenbases can also
+/// be saved to (and loaded from) a file to be reused across sessions on
+/// the same mesh.
+///
 /// \sa ttkEigenField.cpp % for a usage example.
 
 #pragma once
@@ -16,11 +26,22 @@
 #include <Triangulation.h>
 #include <Wrapper.h>
 
+#include <memory>
+#include <string>
+
 namespace ttk {
 
   class EigenField : public Debug {
 
   public:
+    /// Eigensolver modes.
+    enum class SolverMode {
+      /// largest algebraic eigenvalues (legacy)
+      LARGEST_ALGEBRAIC = 0,
+      /// smallest magnitude eigenvalues with a cached factorization
+      SHIFT_INVERT = 1,
+    };
+
     // default constructor
     EigenField() = default;
     // default destructor
@@ -35,6 +56,9 @@ namespace ttk {
     EigenField &operator=(EigenField &&) = default;
 
     inline void setupTriangulation(Triangulation *triangulation) {
+      if(triangulation != triangulation_) {
+        clearCache();
+      }
       triangulation_ = triangulation;
       if(triangulation_ != nullptr) {
         vertexNumber_ = triangulation_->getNumberOfVertices();
@@ -55,6 +79,20 @@ namespace ttk {
     inline void setComputeStatistics(bool value) {
       computeStatistics_ = value;
     }
+    inline void setSolverMode(const SolverMode mode) {
+      solverMode_ = mode;
+    }
+    /// Set the file used to store the computed eigenbasis (no file if
+    /// empty). An eigenbasis stored by a previous session for the same
+    /// mesh is loaded instead of being recomputed.
+    inline void setEigenBasisFile(const std::string &fileName) {
+      eigenBasisFile_ = fileName;
+    }
+    /// Release the cached Laplacian factorization and eigenpairs (should
+    /// be called if the mesh changes but not the triangulation pointer).
+    inline void clearCache() {
+      cache_.reset();
+    }
 
     template <typename T>
     int execute() const;
@@ -72,6 +110,14 @@ namespace ttk {
     unsigned int eigenNumber_{500};
     // if statistics should be computed
     bool computeStatistics_{false};
+    // eigensolver mode
+    SolverMode solverMode_{SolverMode::LARGEST_ALGEBRAIC};
+    // file storing the eigenbasis across sessions
+    std::string eigenBasisFile_{};
+
+    // Laplacian factorization and eigenpairs of the current mesh
+    struct Cache;
+    mutable std::shared_ptr<Cache> cache_{};
   };
 
 } // namespace ttk
@@ -1,8 +1,68 @@
 #include <ExplicitTriangulation.h>
 
+#include <cstdint>
+
+#if defined(TTK_ENABLE_OPENMP) && !defined(__clang__) && !defined(_MSC_VER)
+#include <parallel/algorithm>
+#endif
+
 using namespace std;
 using namespace ttk;
 
+namespace {
+
+  template <typename keyType>
+  void sortKeys(vector<keyType> &keys) {
+#if defined(TTK_ENABLE_OPENMP) && !defined(__clang__) && !defined(_MSC_VER)
+    __gnu_parallel::sort(keys.begin(), keys.end());
+#else
+    std::sort(keys.begin(), keys.end());
+#endif
+  }
+
+  // position along the 3D Hilbert curve of a point of integer coordinates
+  // (bits per axis), from Skilling, "Programming the Hilbert curve", AIP
+  // Conference Proceedings, 2004
+  uint64_t hilbertKey(uint32_t x[3], const int bits) {
+
+    const uint32_t m = 1U << (bits - 1);
+
+    // inverse undo
+    for(uint32_t q = m; q > 1; q >>= 1) {
+      const uint32_t p = q - 1;
+      for(int i = 0; i < 3; i++) {
+        if(x[i] & q) {
+          x[0] ^= p;
+        } else {
+          const uint32_t t = (x[0] ^ x[i]) & p;
+          x[0] ^= t;
+          x[i] ^= t;
+        }
+      }
+    }
+
+    // Gray encode
+    for(int i = 1; i < 3; i++)
+      x[i] ^= x[i - 1];
+    uint32_t t = 0;
+    for(uint32_t q = m; q > 1; q >>= 1) {
+      if(x[2] & q)
+        t ^= q - 1;
+    }
+    for(int i = 0; i < 3; i++)
+      x[i] ^= t;
+
+    // interleave the transposed coordinates
+    uint64_t key = 0;
+    for(int b = bits - 1; b >= 0; b--) {
+      for(int i = 0; i < 3; i++)
+        key = (key << 1) | ((x[i] >> b) & 1U);
+    }
+    return key;
+  }
+
+} // namespace
+
 ExplicitTriangulation::ExplicitTriangulation() {
 
   clear();
@@ -17,6 +77,12 @@ int ExplicitTriangulation::clear() {
   cellNumber_ = 0;
   doublePrecision_ = false;
 
+  reorderedPointSet_.clear();
+  reorderedDoublePointSet_.clear();
+  reorderedCellArray_.clear();
+  originalVertexIds_.clear();
+  originalCellIds_.clear();
+
   {
     stringstream msg;
     msg << "[ExplicitTriangulation] Triangulation cleared." << endl;
@@ -25,3 +91,315 @@ int ExplicitTriangulation::clear() {
 
   return AbstractTriangulation::clear();
 }
+
+int ExplicitTriangulation::reorder(const ReorderingMethod &method) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((!vertexNumber_) || (!pointSet_))
+    return -1;
+  if((!cellNumber_) || (!cellArray_))
+    return -2;
+#endif
+
+  if(method == ReorderingMethod::NONE)
+    return 0;
+
+  Timer t;
+
+  // vertex order (new identifier -> current identifier)
+  vector<SimplexId> vertexOrder{};
+  int ret = 0;
+  if(method == ReorderingMethod::SPACE_FILLING_CURVE)
+    ret = sortVerticesAlongHilbertCurve(vertexOrder);
+  else
+    ret = sortVerticesWithReverseCuthillMcKee(vertexOrder);
+  if(ret)
+    return ret;
+
+  vector<SimplexId> newVertexIds(vertexNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    newVertexIds[vertexOrder[i]] = i;
+
+  // cells sorted by minimum new vertex identifier (ties keep the input
+  // order)
+  const SimplexId cellVertexNumber = cellArray_[0];
+  const size_t stride = cellVertexNumber + 1;
+  vector<pair<SimplexId, SimplexId>> cellKeys(cellNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber_; i++) {
+    const LongSimplexId *cell = &cellArray_[stride * i + 1];
+    SimplexId key = newVertexIds[cell[0]];
+    for(SimplexId j = 1; j < cellVertexNumber; j++)
+      key = std::min(key, newVertexIds[cell[j]]);
+    cellKeys[i] = make_pair(key, i);
+  }
+
+  sortKeys(cellKeys);
+
+  // reordered copies of the input (the vertex order within each cell is
+  // kept)
+  vector<LongSimplexId> cellArray(stride * cellNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber_; i++) {
+    const LongSimplexId *cell = &cellArray_[stride * cellKeys[i].second];
+    cellArray[stride * i] = cell[0];
+    for(SimplexId j = 1; j <= cellVertexNumber; j++)
+      cellArray[stride * i + j] = newVertexIds[cell[j]];
+  }
+
+  vector<float> pointSet{};
+  vector<double> doublePointSet{};
+  if(doublePrecision_)
+    doublePointSet.resize(3 * vertexNumber_);
+  else
+    pointSet.resize(3 * vertexNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    const size_t j = vertexOrder[i];
+    for(int k = 0; k < 3; k++) {
+      if(doublePrecision_)
+        doublePointSet[3 * i + k] = ((const double *)pointSet_)[3 * j + k];
+      else
+        pointSet[3 * i + k] = ((const float *)pointSet_)[3 * j + k];
+    }
+  }
+
+  // input identifiers (composed with a previous reordering, if any)
+  vector<SimplexId> originalVertexIds(vertexNumber_);
+  vector<SimplexId> originalCellIds(cellNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    originalVertexIds[i] = getOriginalVertexId(vertexOrder[i]);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < cellNumber_; i++)
+    originalCellIds[i] = getOriginalCellId(cellKeys[i].second);
+
+  reorderedCellArray_.swap(cellArray);
+  reorderedPointSet_.swap(pointSet);
+  reorderedDoublePointSet_.swap(doublePointSet);
+  originalVertexIds_.swap(originalVertexIds);
+  originalCellIds_.swap(originalCellIds);
+
+  cellArray_ = reorderedCellArray_.data();
+  if(doublePrecision_)
+    pointSet_ = reorderedDoublePointSet_.data();
+  else
+    pointSet_ = reorderedPointSet_.data();
+
+  // the relations computed so far refer to the previous identifiers
+  AbstractTriangulation::clear();
+
+  {
+    stringstream msg;
+    msg << "[ExplicitTriangulation] Reordered " << vertexNumber_
+        << " vertices and " << cellNumber_ << " cells ("
+        << (method == ReorderingMethod::SPACE_FILLING_CURVE
+              ? "space-filling curve"
+              : "reverse Cuthill-McKee")
+        << ") in " << t.getElapsedTime() << " s. (" << threadNumber_
+        << " thread(s))." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+int ExplicitTriangulation::sortVerticesAlongHilbertCurve(
+  vector<SimplexId> &order) const {
+
+  // bounding box
+  float lo[3]{}, hi[3]{};
+  getVertexPoint(0, lo[0], lo[1], lo[2]);
+  getVertexPoint(0, hi[0], hi[1], hi[2]);
+  for(SimplexId i = 1; i < vertexNumber_; i++) {
+    float p[3]{};
+    getVertexPoint(i, p[0], p[1], p[2]);
+    for(int k = 0; k < 3; k++) {
+      lo[k] = std::min(lo[k], p[k]);
+      hi[k] = std::max(hi[k], p[k]);
+    }
+  }
+
+  // same scale on every axis to preserve the locality of the curve
+  float extent = 0;
+  for(int k = 0; k < 3; k++)
+    extent = std::max(extent, hi[k] - lo[k]);
+
+  const int bits = 21;
+  const double scale = extent > 0 ? ((1U << bits) - 1) / (double)extent : 0;
+
+  vector<pair<uint64_t, SimplexId>> keys(vertexNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    float p[3]{};
+    getVertexPoint(i, p[0], p[1], p[2]);
+    uint32_t x[3];
+    for(int k = 0; k < 3; k++)
+      x[k] = (uint32_t)((p[k] - lo[k]) * scale);
+    keys[i] = make_pair(hilbertKey(x, bits), i);
+  }
+
+  sortKeys(keys);
+
+  order.resize(vertexNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    order[i] = keys[i].second;
+
+  return 0;
+}
+
+int ExplicitTriangulation::sortVerticesWithReverseCuthillMcKee(
+  vector<SimplexId> &order) const {
+
+  const SimplexId cellVertexNumber = cellArray_[0];
+  const size_t stride = cellVertexNumber + 1;
+
+  // vertex adjacency graph (compressed rows, with duplicates at first)
+  vector<SimplexId> offsets(vertexNumber_ + 1, 0);
+  for(SimplexId i = 0; i < cellNumber_; i++) {
+    for(SimplexId j = 1; j <= cellVertexNumber; j++)
+      offsets[cellArray_[stride * i + j] + 1] += cellVertexNumber - 1;
+  }
+  for(SimplexId i = 0; i < vertexNumber_; i++)
+    offsets[i + 1] += offsets[i];
+
+  vector<SimplexId> adjacency(offsets[vertexNumber_]);
+  vector<SimplexId> cursor(offsets.begin(), offsets.end() - 1);
+  for(SimplexId i = 0; i < cellNumber_; i++) {
+    const LongSimplexId *cell = &cellArray_[stride * i + 1];
+    for(SimplexId j = 0; j < cellVertexNumber; j++) {
+      for(SimplexId k = 0; k < cellVertexNumber; k++) {
+        if(j != k)
+          adjacency[cursor[cell[j]]++] = cell[k];
+      }
+    }
+  }
+
+  // remove the duplicates, neighbors of v in
+  // [offsets[v], offsets[v] + degree[v])
+  vector<SimplexId> degree(vertexNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    auto begin = adjacency.begin() + offsets[i];
+    auto end = adjacency.begin() + offsets[i + 1];
+    std::sort(begin, end);
+    degree[i] = std::unique(begin, end) - begin;
+  }
+
+  // level structure rooted in a vertex: returns its depth and the vertex of
+  // minimum degree in its last level
+  vector<SimplexId> mark(vertexNumber_, -1);
+  SimplexId stamp = 0;
+  vector<SimplexId> queue{};
+  queue.reserve(vertexNumber_);
+
+  const auto levelStructure = [&](const SimplexId root, SimplexId &last) {
+    stamp++;
+    queue.clear();
+    queue.emplace_back(root);
+    mark[root] = stamp;
+
+    size_t levelBegin = 0;
+    SimplexId depth = 0;
+    while(true) {
+      const size_t levelEnd = queue.size();
+      for(size_t i = levelBegin; i < levelEnd; i++) {
+        const SimplexId v = queue[i];
+        for(SimplexId j = offsets[v]; j < offsets[v] + degree[v]; j++) {
+          const SimplexId u = adjacency[j];
+          if(mark[u] != stamp) {
+            mark[u] = stamp;
+            queue.emplace_back(u);
+          }
+        }
+      }
+      if(queue.size() == levelEnd)
+        break;
+      levelBegin = levelEnd;
+      depth++;
+    }
+
+    last = queue[levelBegin];
+    for(size_t i = levelBegin + 1; i < queue.size(); i++) {
+      if(degree[queue[i]] < degree[last])
+        last = queue[i];
+    }
+    return depth;
+  };
+
+  order.clear();
+  order.reserve(vertexNumber_);
+  vector<bool> visited(vertexNumber_, false);
+  vector<pair<SimplexId, SimplexId>> candidates{};
+
+  for(SimplexId v = 0; v < vertexNumber_; v++) {
+    if(visited[v])
+      continue;
+
+    // pseudo-peripheral root of the connected component (George and Liu)
+    SimplexId root = v, last = v;
+    SimplexId depth = levelStructure(root, last);
+    for(int i = 0; i < 8; i++) {
+      SimplexId next = last;
+      const SimplexId nextDepth = levelStructure(last, next);
+      if(nextDepth <= depth)
+        break;
+      root = last;
+      depth = nextDepth;
+      last = next;
+    }
+
+    // Cuthill-McKee: breadth-first traversal, neighbors by increasing
+    // degree
+    size_t head = order.size();
+    order.emplace_back(root);
+    visited[root] = true;
+    while(head < order.size()) {
+      const SimplexId w = order[head++];
+      candidates.clear();
+      for(SimplexId j = offsets[w]; j < offsets[w] + degree[w]; j++) {
+        const SimplexId u = adjacency[j];
+        if(!visited[u]) {
+          visited[u] = true;
+          candidates.emplace_back(degree[u], u);
+        }
+      }
+      std::sort(candidates.begin(), candidates.end());
+      for(const auto &c : candidates)
+        order.emplace_back(c.second);
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+
+  return 0;
+}
@@ -5,6 +5,12 @@
 ///
 /// \brief ExplicitTriangulation is a class that provides time efficient
 /// traversal methods on triangulations of piecewise linear manifolds.
+///
+/// The input vertices and cells can optionally be renumbered with reorder()
+/// to improve the memory locality of the traversals. In that case, the
+/// identifiers used by the traversal methods are the reordered ones and the
+/// data arrays should be mapped with reorderVertexData()/reorderCellData()
+/// (input) and restoreVertexData()/restoreCellData() (output).
 /// \sa Triangulation
 
 #ifndef _EXPLICITTRIANGULATION_H
@@ -17,11 +23,23 @@
 #include <TwoSkeleton.h>
 #include <ZeroSkeleton.h>
 
+#include <algorithm>
+
 namespace ttk {
 
   class ExplicitTriangulation : public AbstractTriangulation {
 
   public:
+    /// Vertex orderings available in reorder().
+    enum class ReorderingMethod {
+      /// input order
+      NONE = 0,
+      /// 3D Hilbert curve over the vertex coordinates
+      SPACE_FILLING_CURVE = 1,
+      /// reverse Cuthill-McKee on the vertex adjacency graph
+      REVERSE_CUTHILL_MCKEE = 2,
+    };
+
     ExplicitTriangulation();
 
     ~ExplicitTriangulation();
@@ -1061,6 +1079,80 @@ namespace ttk {
       return 0;
     }
 
+    /// Renumber the input vertices with the given method and sort the cells
+    /// by minimum (new) vertex identifier, so that the traversals access
+    /// neighboring simplices in nearby memory locations. The input points
+    /// and cells are copied (the input pointers are not modified) and the
+    /// permutations are retained to map the data arrays.
+    ///
+    /// This function should be called after setInputPoints() and
+    /// setInputCells() and before any pre-processing.
+    /// \return Returns 0 upon success, negative values otherwise.
+    int reorder(const ReorderingMethod &method);
+
+    inline bool isReordered() const {
+      return !originalVertexIds_.empty();
+    }
+
+    /// Input identifier of a (reordered) vertex.
+    inline SimplexId getOriginalVertexId(const SimplexId &vertexId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((vertexId < 0) || (vertexId >= vertexNumber_))
+        return -1;
+#endif
+      return originalVertexIds_.empty() ? vertexId
+                                        : originalVertexIds_[vertexId];
+    }
+
+    /// Input identifier of a (reordered) cell.
+    inline SimplexId getOriginalCellId(const SimplexId &cellId) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if((cellId < 0) || (cellId >= cellNumber_))
+        return -1;
+#endif
+      return originalCellIds_.empty() ? cellId : originalCellIds_[cellId];
+    }
+
+    /// Map a vertex data array from the input to the reordered vertex
+    /// identifiers.
+    template <class dataType>
+    inline int reorderVertexData(const dataType *input,
+                                 dataType *output,
+                                 const int &componentNumber = 1) const {
+      return permuteData(originalVertexIds_, vertexNumber_, input, output,
+                         componentNumber, false);
+    }
+
+    /// Map a vertex data array from the reordered to the input vertex
+    /// identifiers.
+    template <class dataType>
+    inline int restoreVertexData(const dataType *input,
+                                 dataType *output,
+                                 const int &componentNumber = 1) const {
+      return permuteData(originalVertexIds_, vertexNumber_, input, output,
+                         componentNumber, true);
+    }
+
+    /// Map a cell data array from the input to the reordered cell
+    /// identifiers.
+    template <class dataType>
+    inline int reorderCellData(const dataType *input,
+                               dataType *output,
+                               const int &componentNumber = 1) const {
+      return permuteData(originalCellIds_, cellNumber_, input, output,
+                         componentNumber, false);
+    }
+
+    /// Map a cell data array from the reordered to the input cell
+    /// identifiers.
+    template <class dataType>
+    inline int restoreCellData(const dataType *input,
+                               dataType *output,
+                               const int &componentNumber = 1) const {
+      return permuteData(originalCellIds_, cellNumber_, input, output,
+                         componentNumber, true);
+    }
+
     inline int setInputCells(const SimplexId &cellNumber,
                              const LongSimplexId *cellArray) {
 
@@ -1089,13 +1181,71 @@ namespace ttk {
   protected:
     int clear();
 
+    // output[i] = input[permutation[i]] (or the converse with inverse)
+    template <class dataType>
+    int permuteData(const std::vector<SimplexId> &permutation,
+                    const SimplexId &elementNumber,
+                    const dataType *input,
+                    dataType *output,
+                    const int &componentNumber,
+                    const bool &inverse) const;
+
+    // vertex orderings (new identifier -> input identifier)
+    int sortVerticesAlongHilbertCurve(std::vector<SimplexId> &order) const;
+    int sortVerticesWithReverseCuthillMcKee(
+      std::vector<SimplexId> &order) const;
+
     bool doublePrecision_;
     SimplexId cellNumber_, vertexNumber_;
     const void *pointSet_;
     const LongSimplexId *cellArray_;
+
+    // reordered copies of the input and input identifiers of the reordered
+    // vertices and cells (empty if not reordered)
+    std::vector<float> reorderedPointSet_;
+    std::vector<double> reorderedDoublePointSet_;
+    std::vector<LongSimplexId> reorderedCellArray_;
+    std::vector<SimplexId> originalVertexIds_, originalCellIds_;
   };
 } // namespace ttk
 
+template <class dataType>
+int ttk::ExplicitTriangulation::permuteData(
+  const std::vector<SimplexId> &permutation,
+  const SimplexId &elementNumber,
+  const dataType *input,
+  dataType *output,
+  const int &componentNumber,
+  const bool &inverse) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((!input) || (!output) || (componentNumber < 1))
+    return -1;
+#endif
+
+  const size_t c = componentNumber;
+
+  if(permutation.empty()) {
+    std::copy(input, input + c * elementNumber, output);
+    return 0;
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < elementNumber; i++) {
+    const size_t j = permutation[i];
+    for(size_t k = 0; k < c; k++) {
+      if(inverse)
+        output[c * j + k] = input[c * i + k];
+      else
+        output[c * i + k] = input[c * j + k];
+    }
+  }
+
+  return 0;
+}
+
 // if the package is not a template, comment the following line
 // #include                  <ExplicitTriangulation.cpp>
 
@@ -0,0 +1,367 @@
+#include <FastMarching.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+bool ttk::FastMarching::faceUpdate(const int vertexNumber,
+                                   const double edges[][3],
+                                   const double *const times,
+                                   double &res) {
+
+  // face points: e0 + D mu, with D = [e1 - e0, e2 - e0]
+  const int m = vertexNumber - 1;
+  double d[2][3]{};
+  double delta[2]{};
+  for(int j = 0; j < m; ++j) {
+    for(int k = 0; k < 3; ++k) {
+      d[j][k] = edges[j + 1][k] - edges[0][k];
+    }
+    delta[j] = times[j + 1] - times[0];
+  }
+
+  // Gram matrix G = D^T D, b = D^T e0
+  double g[2][2]{};
+  double b[2]{};
+  for(int i = 0; i < m; ++i) {
+    for(int j = 0; j < m; ++j) {
+      g[i][j] = Geometry::dotProduct(d[i], d[j]);
+    }
+    b[i] = Geometry::dotProduct(d[i], edges[0]);
+  }
+
+  // inverse of G
+  double gi[2][2]{};
+  if(m == 1) {
+    if(g[0][0] <= 0.0) {
+      return false;
+    }
+    gi[0][0] = 1.0 / g[0][0];
+  } else {
+    const double det = g[0][0] * g[1][1] - g[0][1] * g[1][0];
+    if(std::abs(det) <= 1e-12 * g[0][0] * g[1][1]) {
+      // degenerate face
+      return false;
+    }
+    gi[0][0] = g[1][1] / det;
+    gi[0][1] = -g[0][1] / det;
+    gi[1][0] = -g[1][0] / det;
+    gi[1][1] = g[0][0] / det;
+  }
+
+  // quadratic forms with G^-1
+  const auto form = [&](const double *const x, const double *const y) {
+    double val = 0.0;
+    for(int i = 0; i < m; ++i) {
+      for(int j = 0; j < m; ++j) {
+        val += x[i] * gi[i][j] * y[j];
+      }
+    }
+    return val;
+  };
+
+  // the wave front direction must be admissible (|grad T| = 1)
+  const double q = form(delta, delta);
+  if(q >= 1.0) {
+    return false;
+  }
+
+  // squared distance between the vertex and the face affine hull
+  const double perp2
+    = std::max(Geometry::dotProduct(edges[0], edges[0]) - form(b, b), 0.0);
+  // distance between the vertex and the optimal point
+  const double r = std::sqrt(perp2 / (1.0 - q));
+
+  // optimal point (barycentric coordinates mu_j, 1 - sum mu_j)
+  double mu[2]{};
+  double sum = 0.0;
+  for(int i = 0; i < m; ++i) {
+    for(int j = 0; j < m; ++j) {
+      mu[i] -= gi[i][j] * (delta[j] * r + b[j]);
+    }
+    if(mu[i] < 0.0) {
+      return false;
+    }
+    sum += mu[i];
+  }
+  if(sum > 1.0) {
+    return false;
+  }
+
+  res = times[0] + r;
+  for(int i = 0; i < m; ++i) {
+    res += delta[i] * mu[i];
+  }
+
+  return true;
+}
+
+namespace ttk {
+  namespace FastMarching {
+
+    // minimum arrival time at vertex through its star
+    template <typename T>
+    T localUpdate(const SimplexId vertexId,
+                  Triangulation &triangulation,
+                  const std::vector<T> &dists) {
+
+      const T inf = std::numeric_limits<T>::infinity();
+
+      std::array<float, 3> p{};
+      triangulation.getVertexPoint(vertexId, p[0], p[1], p[2]);
+
+      double best = static_cast<double>(dists[vertexId]);
+
+      // edge updates (Dijkstra-like)
+      const auto nneigh = triangulation.getVertexNeighborNumber(vertexId);
+      for(SimplexId i = 0; i < nneigh; i++) {
+        SimplexId neigh{};
+        triangulation.getVertexNeighbor(vertexId, i, neigh);
+        if(dists[neigh] == inf) {
+          continue;
+        }
+        std::array<float, 3> n{};
+        triangulation.getVertexPoint(neigh, n[0], n[1], n[2]);
+        best = std::min(best, static_cast<double>(dists[neigh])
+                                + Geometry::distance(p.data(), n.data()));
+      }
+
+      // triangle and tetrahedron updates
+      const auto nstar = triangulation.getVertexStarNumber(vertexId);
+      for(SimplexId i = 0; i < nstar; i++) {
+        SimplexId cellId{};
+        triangulation.getVertexStar(vertexId, i, cellId);
+        const auto nverts = triangulation.getCellVertexNumber(cellId);
+
+        // opposite face
+        int faceVertexNumber = 0;
+        SimplexId faceVertices[3]{};
+        double times[3]{};
+        double minTime = best;
+        bool reached = true;
+        for(SimplexId j = 0; j < nverts && faceVertexNumber < 3; j++) {
+          SimplexId v{};
+          triangulation.getCellVertex(cellId, j, v);
+          if(v == vertexId) {
+            continue;
+          }
+          if(dists[v] == inf) {
+            reached = false;
+            break;
+          }
+          faceVertices[faceVertexNumber] = v;
+          times[faceVertexNumber] = dists[v];
+          minTime = std::min(minTime, times[faceVertexNumber]);
+          faceVertexNumber++;
+        }
+        // the update through a face cannot be lower than its minimum time
+        if(!reached || faceVertexNumber < 2 || minTime >= best) {
+          continue;
+        }
+
+        double edges[3][3]{};
+        for(int j = 0; j < faceVertexNumber; ++j) {
+          float x{}, y{}, z{};
+          triangulation.getVertexPoint(faceVertices[j], x, y, z);
+          edges[j][0] = x - p[0];
+          edges[j][1] = y - p[1];
+          edges[j][2] = z - p[2];
+        }
+
+        double res{};
+        if(faceUpdate(faceVertexNumber, edges, times, res)) {
+          // minimum over the whole face, sub-faces included
+          best = std::min(best, res);
+        } else if(faceVertexNumber == 3) {
+          // edges of the opposite triangle
+          for(int j = 0; j < 3; ++j) {
+            const int k = (j + 1) % 3;
+            const double subEdges[2][3]
+              = {{edges[j][0], edges[j][1], edges[j][2]},
+                 {edges[k][0], edges[k][1], edges[k][2]}};
+            const double subTimes[2] = {times[j], times[k]};
+            if(faceUpdate(2, subEdges, subTimes, res)) {
+              best = std::min(best, res);
+            }
+          }
+        }
+      }
+
+      return static_cast<T>(best);
+    }
+
+  } // namespace FastMarching
+} // namespace ttk
+
+template <typename T>
+int ttk::FastMarching::shortestPath(const ttk::SimplexId source,
+                                    ttk::Triangulation &triangulation,
+                                    std::vector<T> &outputDists,
+                                    const std::vector<ttk::SimplexId> &bounds,
+                                    const std::vector<bool> &mask,
+                                    const int threadNumber) {
+
+  // total number of vertices in the mesh
+  const SimplexId vertexNumber = triangulation.getNumberOfVertices();
+  // is there a mask?
+  const bool isMask = !mask.empty();
+
+  // check mask size
+  if(isMask && mask.size() != static_cast<size_t>(vertexNumber)) {
+    return 1;
+  }
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(source < 0 || source >= vertexNumber) {
+    return 2;
+  }
+#endif // TTK_ENABLE_KAMIKAZE
+
+  const T inf = std::numeric_limits<T>::infinity();
+  // relative tolerance for the convergence of a vertex value
+  const T eps = 64 * std::numeric_limits<T>::epsilon();
+
+  // preprocess output vector
+  outputDists.clear();
+  outputDists.resize(vertexNumber, inf);
+  auto &dists = outputDists;
+
+  // vertex in the active list
+  std::vector<char> isActive(vertexNumber, 0);
+
+  // init pipeline: activate the source neighbors
+  dists[source] = T(0.0F);
+  std::vector<SimplexId> activeList{}, nextList{};
+  const auto nneigh = triangulation.getVertexNeighborNumber(source);
+  for(SimplexId i = 0; i < nneigh; i++) {
+    SimplexId neigh{};
+    triangulation.getVertexNeighbor(source, i, neigh);
+    if((isMask && !mask[neigh]) || isActive[neigh]) {
+      continue;
+    }
+    isActive[neigh] = 1;
+    activeList.emplace_back(neigh);
+  }
+
+  std::vector<T> newDists{};
+  std::vector<char> hasConverged{};
+  std::vector<std::vector<std::pair<SimplexId, T>>> activated(threadNumber);
+
+  while(!activeList.empty()) {
+    const SimplexId activeNumber = activeList.size();
+    newDists.resize(activeNumber);
+    hasConverged.resize(activeNumber);
+
+    // 1. update the active vertices (Jacobi iteration)
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic, 64) num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < activeNumber; ++i) {
+      newDists[i] = localUpdate(activeList[i], triangulation, dists);
+    }
+
+    // 2. store the new values, minimum value on the front
+    T frontMin = inf;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber) reduction(min : frontMin)
+#endif // TTK_ENABLE_OPENMP
+    for(SimplexId i = 0; i < activeNumber; ++i) {
+      const auto v = activeList[i];
+      hasConverged[i] = dists[v] - newDists[i] <= eps * newDists[i];
+      dists[v] = newDists[i];
+      frontMin = std::min(frontMin, newDists[i]);
+    }
+
+    // stop once every bound is out of the front and behind it
+    if(!bounds.empty()) {
+      bool done = true;
+      for(const auto b : bounds) {
+        if(dists[b] == inf || isActive[b] || dists[b] > frontMin) {
+          done = false;
+          break;
+        }
+      }
+      if(done) {
+        break;
+      }
+    }
+
+    // 3. converged vertices leave the list and activate their neighbors
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber)
+#endif // TTK_ENABLE_OPENMP
+    {
+      int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+      threadId = omp_get_thread_num();
+#endif // TTK_ENABLE_OPENMP
+      auto &candidates = activated[threadId];
+      candidates.clear();
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+      for(SimplexId i = 0; i < activeNumber; ++i) {
+        if(!hasConverged[i]) {
+          continue;
+        }
+        const auto v = activeList[i];
+        const auto nn = triangulation.getVertexNeighborNumber(v);
+        for(SimplexId j = 0; j < nn; j++) {
+          SimplexId neigh{};
+          triangulation.getVertexNeighbor(v, j, neigh);
+          // only downstream neighbors can be improved by v
+          if(isActive[neigh] || dists[neigh] <= dists[v]
+             || (isMask && !mask[neigh])) {
+            continue;
+          }
+          const T dist = localUpdate(neigh, triangulation, dists);
+          if(dist < dists[neigh]) {
+            candidates.emplace_back(neigh, dist);
+          }
+        }
+      }
+    }
+
+    // next active list
+    nextList.clear();
+    for(SimplexId i = 0; i < activeNumber; ++i) {
+      if(hasConverged[i]) {
+        isActive[activeList[i]] = 0;
+      } else {
+        nextList.emplace_back(activeList[i]);
+      }
+    }
+    for(const auto &candidates : activated) {
+      for(const auto &c : candidates) {
+        // a vertex can be activated by several of its neighbors
+        if(c.second < dists[c.first]) {
+          dists[c.first] = c.second;
+        }
+        if(!isActive[c.first]) {
+          isActive[c.first] = 1;
+          nextList.emplace_back(c.first);
+        }
+      }
+    }
+    activeList.swap(nextList);
+  }
+
+  return 0;
+}
+
+// explicit intantiations for floating-point types
+template int ttk::FastMarching::shortestPath<float>(
+  const ttk::SimplexId source,
+  ttk::Triangulation &triangulation,
+  std::vector<float> &outputDists,
+  const std::vector<ttk::SimplexId> &bounds,
+  const std::vector<bool> &mask,
+  const int threadNumber);
+template int ttk::FastMarching::shortestPath<double>(
+  const ttk::SimplexId source,
+  ttk::Triangulation &triangulation,
+  std::vector<double> &outputDists,
+  const std::vector<ttk::SimplexId> &bounds,
+  const std::vector<bool> &mask,
+  const int threadNumber);
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Geometry.h>
+#include <Triangulation.h>
+#include <Wrapper.h>
+
+#include <vector>
+
+namespace ttk {
+  namespace FastMarching {
+
+    /**
+     * @brief Compute the geodesic distance from source with a parallel
+     * fast marching eikonal solver
+     *
+     * Contrary to Dijkstra, which only follows mesh edges, the wave
+     * front also propagates through the interior of the triangles (on
+     * surfaces) and tetrahedra (on volumes) so that distances are not
+     * biased by the mesh edge directions. Each vertex value is the
+     * minimum of the local simplex updates over its star (the edge
+     * updates being included, the distances are never greater than the
+     * Dijkstra ones).
+     *
+     * The solver uses the Fast Iterative Method: all the vertices of the
+     * active list are updated in parallel at each iteration, converged
+     * vertices leave the list and activate their neighbors if their
+     * value decreases.
+     *
+     * The triangulation should be preprocessed with
+     * preprocessVertexNeighbors() and preprocessVertexStars().
+     *
+     * "A Fast Iterative Method for Eikonal Equations" \n
+     * Won-Ki Jeong, Ross T. Whitaker \n
+     * SIAM Journal on Scientific Computing, 2008.
+     *
+     * @param[in] source Source vertex
+     * @param[in] triangulation Access to vertex neighbors and stars
+     * @param[out] outputDists Distances to source for every mesh vertex
+     * @param[in] bounds Stop the propagation once the distances to all
+     * these vertices are final
+     * @param[in] mask Vector masking the triangulation
+     * @param[in] threadNumber Number of threads used by the solver
+     *
+     * @return 0 in case of success
+     */
+    template <typename T>
+    int shortestPath(const SimplexId source,
+                     Triangulation &triangulation,
+                     std::vector<T> &outputDists,
+                     const std::vector<SimplexId> &bounds
+                     = std::vector<SimplexId>(),
+                     const std::vector<bool> &mask = std::vector<bool>(),
+                     const int threadNumber = 1);
+
+    /**
+     * @brief Minimal arrival time at a vertex through a simplex face
+     *
+     * Minimize the interpolated arrival time on the face (up to three
+     * vertices) plus the distance to the updated vertex. Only the
+     * interior critical point of the face is considered, the sub-faces
+     * should be tested separately.
+     *
+     * @param[in] vertexNumber Number of face vertices (2 or 3)
+     * @param[in] edges Face vertex coordinates relative to the updated
+     * vertex
+     * @param[in] times Arrival times at the face vertices
+     * @param[out] res Arrival time at the updated vertex
+     *
+     * @return true if the minimum lies inside the face
+     */
+    bool faceUpdate(const int vertexNumber,
+                    const double edges[][3],
+                    const double *const times,
+                    double &res);
+
+  } // namespace FastMarching
+} // namespace ttk
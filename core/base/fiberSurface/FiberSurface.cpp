@@ -95,6 +95,13 @@ FiberSurface::FiberSurface() {
   globalVertexList_ = NULL;
   triangulation_ = NULL;
 
+  edgeCaching_ = false;
+  fieldVersion_ = 0;
+  cachedFieldVersion_ = 0;
+  cachedUField_ = NULL;
+  cachedVField_ = NULL;
+  cachedTriangulation_ = NULL;
+
   edgeImplicitEncoding_[0] = 0;
   edgeImplicitEncoding_[1] = 1;
 
@@ -710,6 +717,71 @@ int FiberSurface::createNewIntersectionTriangle(
   return 0;
 }
 
+int FiberSurface::fetchCachedEdges(vector<SimplexId> &uncachedEdges) {
+
+  uncachedEdges.clear();
+
+  if(!edgeCaching_) {
+    for(SimplexId i = 0; i < polygonEdgeNumber_; i++)
+      uncachedEdges.push_back(i);
+    return 0;
+  }
+
+  // the cached sheets are only valid for the field they have been computed on
+  if((fieldVersion_ != cachedFieldVersion_) || (uField_ != cachedUField_)
+     || (vField_ != cachedVField_)
+     || (triangulation_ != cachedTriangulation_)) {
+
+    if(edgeCache_.size()) {
+      stringstream msg;
+      msg << "[FiberSurface] Input field changed, flushing the edge cache..."
+          << endl;
+      dMsg(cout, msg.str(), detailedInfoMsg);
+    }
+
+    edgeCache_.clear();
+    cachedFieldVersion_ = fieldVersion_;
+    cachedUField_ = uField_;
+    cachedVField_ = vField_;
+    cachedTriangulation_ = triangulation_;
+  }
+
+  vector<pair<SimplexId, const PolygonEdgeSheet *>> cachedEdges;
+
+  for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
+    map<RangeEdge, PolygonEdgeSheet>::const_iterator it
+      = edgeCache_.find((*polygon_)[i]);
+    if(it != edgeCache_.end()) {
+      cachedEdges.push_back(
+        pair<SimplexId, const PolygonEdgeSheet *>(i, &(it->second)));
+    } else {
+      uncachedEdges.push_back(i);
+    }
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < (SimplexId)cachedEdges.size(); i++) {
+
+    SimplexId polygonEdgeId = cachedEdges[i].first;
+
+    (*polygonEdgeVertexLists_[polygonEdgeId])
+      = cachedEdges[i].second->vertexList_;
+    (*polygonEdgeTriangleLists_[polygonEdgeId])
+      = cachedEdges[i].second->triangleList_;
+
+    // the edge may have been re-indexed in the polygon
+    for(SimplexId j = 0;
+        j < (SimplexId)polygonEdgeTriangleLists_[polygonEdgeId]->size(); j++) {
+      (*polygonEdgeTriangleLists_[polygonEdgeId])[j].polygonEdgeId_
+        = polygonEdgeId;
+    }
+  }
+
+  return 0;
+}
+
 int FiberSurface::flipEdges() const {
 
   Timer t;
@@ -1606,6 +1678,29 @@ int FiberSurface::mergeVertices(const double &distanceThreshold) const {
   return 0;
 }
 
+int FiberSurface::updateEdgeCache(const vector<SimplexId> &computedEdges) {
+
+  if(!edgeCaching_)
+    return 0;
+
+  // evict the edges which are no longer part of the polygon
+  map<RangeEdge, PolygonEdgeSheet>::iterator it = edgeCache_.begin();
+  while(it != edgeCache_.end()) {
+    if(find(polygon_->begin(), polygon_->end(), it->first) == polygon_->end())
+      it = edgeCache_.erase(it);
+    else
+      it++;
+  }
+
+  for(SimplexId i = 0; i < (SimplexId)computedEdges.size(); i++) {
+    PolygonEdgeSheet &sheet = edgeCache_[(*polygon_)[computedEdges[i]]];
+    sheet.vertexList_ = *(polygonEdgeVertexLists_[computedEdges[i]]);
+    sheet.triangleList_ = *(polygonEdgeTriangleLists_[computedEdges[i]]);
+  }
+
+  return 0;
+}
+
 int FiberSurface::snapToBasePoint(const vector<vector<double>> &basePoints,
                                   const vector<pair<double, double>> &uv,
                                   const vector<double> &t,
@@ -44,7 +44,9 @@
 #endif
 #endif
 
+#include <map>
 #include <queue>
+#include <unordered_set>
 
 // base code includes
 #include <Geometry.h>
@@ -121,8 +123,15 @@ namespace ttk {
                         const bool &edgeFlips = false,
                         const bool &intersectionRemesh = false);
 
+    /// Release all the cached polygon edge sheets.
+    inline int flushEdgeCache() {
+      edgeCache_.clear();
+      return 0;
+    }
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
     inline int flushOctree() {
+      threadedTetLists_.clear();
       return octree_.flush();
     }
 #endif
@@ -133,6 +142,27 @@ namespace ttk {
                                   const std::pair<double, double> &rangePoint1,
                                   const SimplexId &polygonEdgeId = 0) const;
 
+    /// Enable or disable the caching of the per polygon edge sheets.
+    /// When enabled, the sheet of a polygon edge is only re-extracted if its
+    /// range end points or the field version (see setFieldVersion()) changed
+    /// since the last call to computeSurface(). This makes interactive
+    /// edits of the range polygon (which typically modify only two polygon
+    /// edges) only pay for the modified edges.
+    inline int setEdgeCaching(const bool &onOff) {
+      edgeCaching_ = onOff;
+      if(!edgeCaching_)
+        edgeCache_.clear();
+      return 0;
+    }
+
+    /// Set the version of the input bivariate field (for instance a
+    /// modification time stamp). Any change of version invalidates the
+    /// cached polygon edge sheets.
+    inline int setFieldVersion(const unsigned long long &version) {
+      fieldVersion_ = version;
+      return 0;
+    }
+
     inline int setGlobalVertexList(std::vector<Vertex> *globalList) {
       globalVertexList_ = globalList;
       return 0;
@@ -146,6 +176,16 @@ namespace ttk {
       return 0;
     }
 
+#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
+    /// Set the path of a file where the range driven octree is saved after
+    /// its construction, and from which it is loaded (if it has been computed
+    /// for the same input) instead of being re-built.
+    inline int setOctreeFileName(const std::string &fileName) {
+      octreeFileName_ = fileName;
+      return 0;
+    }
+#endif
+
     inline int setPointMerging(const bool &onOff) {
       pointSnapping_ = onOff;
       return 0;
@@ -231,6 +271,16 @@ namespace ttk {
     }
 
   protected:
+    typedef std::pair<std::pair<double, double>, std::pair<double, double>>
+      RangeEdge;
+
+    class PolygonEdgeSheet {
+
+    public:
+      std::vector<Vertex> vertexList_;
+      std::vector<Triangle> triangleList_;
+    };
+
     typedef struct _intersectionTriangle {
       SimplexId caseId_;
       // use negative values for new triangles
@@ -390,6 +440,8 @@ namespace ttk {
       std::vector<std::vector<IntersectionTriangle>> &tetIntersections,
       const std::pair<double, double> *intersection = NULL) const;
 
+    int fetchCachedEdges(std::vector<SimplexId> &uncachedEdges);
+
     int flipEdges() const;
 
     int
@@ -480,12 +532,14 @@ namespace ttk {
 
     int snapVertexBarycentrics(const double &distanceThreshold) const;
 
+    int updateEdgeCache(const std::vector<SimplexId> &computedEdges);
+
     int snapVertexBarycentrics(
       const SimplexId &tetId,
       const std::vector<std::pair<SimplexId, SimplexId>> &triangles,
       const double &distanceThreshold) const;
 
-    bool pointSnapping_;
+    bool edgeCaching_, pointSnapping_;
 
     SimplexId pointNumber_, tetNumber_, polygonEdgeNumber_;
     const void *uField_, *vField_;
@@ -505,8 +559,18 @@ namespace ttk {
 
     Triangulation *triangulation_;
 
+    // polygon edge sheet cache, keyed by the range end points of the edges
+    // and valid for the field (version) it has been computed on.
+    unsigned long long fieldVersion_, cachedFieldVersion_;
+    const void *cachedUField_, *cachedVField_;
+    const Triangulation *cachedTriangulation_;
+    std::map<RangeEdge, PolygonEdgeSheet> edgeCache_;
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
+    std::string octreeFileName_;
     RangeDrivenOctree octree_;
+    // per-thread range query results, re-used from one query to the next
+    mutable std::vector<std::vector<SimplexId>> threadedTetLists_;
 #endif
   };
 } // namespace ttk
@@ -520,6 +584,9 @@ inline int ttk::FiberSurface::buildOctree() {
   if(!vField_)
     return -2;
 
+  if((int)threadedTetLists_.size() < threadNumber_)
+    threadedTetLists_.resize(threadNumber_);
+
   if(octree_.empty()) {
 
     octree_.setDebugLevel(debugLevel_);
@@ -534,7 +601,15 @@ inline int ttk::FiberSurface::buildOctree() {
     }
     octree_.setRange(uField_, vField_);
 
-    octree_.build<dataTypeU, dataTypeV>();
+    // try to re-use an octree previously computed for this field
+    if((octreeFileName_.empty())
+       || (octree_.load<dataTypeU, dataTypeV>(octreeFileName_))) {
+
+      octree_.build<dataTypeU, dataTypeV>();
+
+      if(!octreeFileName_.empty())
+        octree_.save<dataTypeU, dataTypeV>(octreeFileName_);
+    }
   }
 
   return 0;
@@ -1494,7 +1569,11 @@ inline int ttk::FiberSurface::computeContour(
     return -8;
 #endif
 
-  std::vector<bool> visitedTets(triangulation_->getNumberOfCells(), false);
+  // contours are local to their seeds: track the visited tetrahedra in a
+  // sparse set rather than in a mesh-sized array, which would dominate the
+  // cost of small contours (this is called concurrently for each saddle
+  // jacobi edge by ReebSpace).
+  std::unordered_set<SimplexId> visitedTets;
   std::queue<SimplexId> tetQueue;
 
   // init the queue
@@ -1509,7 +1588,7 @@ inline int ttk::FiberSurface::computeContour(
     SimplexId tetId = tetQueue.front();
     tetQueue.pop();
 
-    if(!visitedTets[tetId]) {
+    if(visitedTets.insert(tetId).second) {
 
       createdVertices = processTetrahedron<dataTypeU, dataTypeV>(
         tetId, rangePoint0, rangePoint1, polygonEdgeId);
@@ -1524,12 +1603,10 @@ inline int ttk::FiberSurface::computeContour(
           SimplexId neighborId = -1;
           triangulation_->getCellNeighbor(tetId, i, neighborId);
 
-          if(!visitedTets[neighborId])
+          if(!visitedTets.count(neighborId))
             tetQueue.push(neighborId);
         }
       }
-
-      visitedTets[tetId] = true;
     }
 
   } while(tetQueue.size());
@@ -1685,25 +1762,34 @@ inline int ttk::FiberSurface::computeSurface() {
 
   Timer t;
 
+  // only extract the sheets of the polygon edges which are not in the cache
+  std::vector<SimplexId> edgeList;
+  fetchCachedEdges(edgeList);
+
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
   if(!octree_.empty()) {
 
+    if((int)threadedTetLists_.size() < threadNumber_)
+      threadedTetLists_.resize(threadNumber_);
+
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-    for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
+    for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
 
       computeSurfaceWithOctree<dataTypeU, dataTypeV>(
-        (*polygon_)[i].first, (*polygon_)[i].second, i);
+        (*polygon_)[edgeList[i]].first, (*polygon_)[edgeList[i]].second,
+        edgeList[i]);
     }
   } else {
     // regular extraction (the octree has not been computed)
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-    for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
+    for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
       computeSurface<dataTypeU, dataTypeV>(
-        (*polygon_)[i].first, (*polygon_)[i].second, i);
+        (*polygon_)[edgeList[i]].first, (*polygon_)[edgeList[i]].second,
+        edgeList[i]);
     }
   }
 
@@ -1711,20 +1797,27 @@ inline int ttk::FiberSurface::computeSurface() {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < polygonEdgeNumber_; i++) {
+  for(SimplexId i = 0; i < (SimplexId)edgeList.size(); i++) {
 
     computeSurface<dataTypeU, dataTypeV>(
-      (*polygon_)[i].first, (*polygon_)[i].second, i);
+      (*polygon_)[edgeList[i]].first, (*polygon_)[edgeList[i]].second,
+      edgeList[i]);
   }
 #endif
 
+  // must be done before finalize(), which re-indexes and releases the
+  // per polygon edge lists
+  updateEdgeCache(edgeList);
+
   finalize<dataTypeU, dataTypeV>(pointSnapping_, false, false, false);
 
   {
     std::stringstream msg;
     msg << "[FiberSurface] FiberSurface extracted in " << t.getElapsedTime()
         << " s. (" << globalVertexList_->size() << " vertices, "
-        << threadNumber_ << " thread(s))" << std::endl;
+        << polygonEdgeNumber_ - edgeList.size() << "/" << polygonEdgeNumber_
+        << " cached edge(s), " << threadNumber_ << " thread(s))"
+        << std::endl;
     dMsg(std::cout, msg.str(), timeMsg);
   }
 
@@ -1755,7 +1848,17 @@ inline int ttk::FiberSurface::computeSurfaceWithOctree(
     return -7;
 #endif
 
-  std::vector<SimplexId> tetList;
+  // re-use the query buffer of the calling thread (polygon edges are
+  // processed in parallel)
+  int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+  threadId = omp_get_thread_num();
+#endif
+  std::vector<SimplexId> localTetList;
+  std::vector<SimplexId> &tetList
+    = threadId < (int)threadedTetLists_.size() ? threadedTetLists_[threadId]
+                                                 : localTetList;
+  tetList.clear();
   octree_.rangeSegmentQuery(rangePoint0, rangePoint1, tetList);
 
 #ifdef TTK_ENABLE_OPENMP
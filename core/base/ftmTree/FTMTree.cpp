@@ -17,7 +17,9 @@ using namespace std;
 using namespace ttk;
 using namespace ftm;
 
-FTMTree::FTMTree() : FTMTree_CT(new Params, nullptr, new Scalars) {
+FTMTree::FTMTree()
+  : FTMTree_CT(new Params, nullptr, new Scalars),
+    fieldParallelismThreshold_(1000000) {
 }
 
 FTMTree::~FTMTree() {
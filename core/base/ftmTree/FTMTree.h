@@ -20,6 +20,8 @@
 #include <Triangulation.h>
 #include <Wrapper.h>
 
+#include <functional>
+
 #include "FTMDataTypes.h"
 #include "FTMTree_CT.h"
 
@@ -48,6 +50,29 @@ namespace ttk {
       // Need triangulation, scalars and all params set before call
       template <typename scalarType, typename idType>
       void build(void);
+
+      // Build the trees of a batch of scalar fields defined on the same
+      // triangulation. The tree structures (and their memory) are re-used
+      // from one field to the next, and each tree is handed to `callback'
+      // (with the index of its field) before the next field is processed.
+      // `offsets' holds either one offset field shared by the whole batch
+      // or one offset field per scalar field.
+      // Small meshes (or batches with at least as many fields as threads)
+      // are processed with one field per thread, in which case `callback'
+      // is called concurrently on distinct trees.
+      // Need triangulation and all params set before call
+      template <typename scalarType, typename idType>
+      int buildBatch(
+        const std::vector<scalarType *> &fields,
+        const std::vector<idType *> &offsets,
+        const std::function<void(const size_t, FTMTree &)> &callback);
+
+      inline void setFieldParallelismThreshold(const SimplexId threshold) {
+        fieldParallelismThreshold_ = threshold;
+      }
+
+    protected:
+      SimplexId fieldParallelismThreshold_;
     };
 
 #include "FTMTree_Template.h"
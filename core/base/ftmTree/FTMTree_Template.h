@@ -204,4 +204,76 @@ void ttk::ftm::FTMTree::build(void) {
   }
 }
 
+template <typename scalarType, typename idType>
+int ttk::ftm::FTMTree::buildBatch(
+  const std::vector<scalarType *> &fields,
+  const std::vector<idType *> &offsets,
+  const std::function<void(const size_t, FTMTree &)> &callback) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!mesh_)
+    return -1;
+  if(offsets.size() != 1 && offsets.size() != fields.size())
+    return -2;
+#endif
+
+  DebugTimer batchTime;
+
+  const SimplexId fieldNumber = fields.size();
+  const SimplexId vertexNumber = mesh_->getNumberOfVertices();
+  const bool fieldParallelism
+    = (threadNumber_ > 1) && (fieldNumber > 1)
+      && ((fieldNumber >= threadNumber_)
+          || (vertexNumber < fieldParallelismThreshold_));
+
+  if(fieldParallelism) {
+#ifdef TTK_ENABLE_OPENMP
+    const int workerNumber = std::min<SimplexId>(threadNumber_, fieldNumber);
+#pragma omp parallel num_threads(workerNumber)
+#endif
+    {
+      // one sequential tree per thread, re-used for all its fields
+      FTMTree worker;
+      *worker.params_ = *params_;
+      worker.setupTriangulation(mesh_, false);
+      worker.setThreadNumber(1);
+      worker.setDebugLevel(std::min(debugLevel_, (int)timeMsg));
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for(SimplexId i = 0; i < fieldNumber; i++) {
+        worker.setVertexScalars(fields[i]);
+        worker.setVertexSoSoffsets(offsets[offsets.size() == 1 ? 0 : i]);
+        worker.build<scalarType, idType>();
+        callback(i, worker);
+      }
+    }
+  } else {
+    void *values = scalars_->values;
+    void *sos = scalars_->offsets;
+
+    for(SimplexId i = 0; i < fieldNumber; i++) {
+      setVertexScalars(fields[i]);
+      setVertexSoSoffsets(offsets[offsets.size() == 1 ? 0 : i]);
+      build<scalarType, idType>();
+      callback(i, *this);
+    }
+
+    scalars_->values = values;
+    scalars_->offsets = sos;
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[FTM] Batch of " << fieldNumber << " field(s) processed in "
+        << batchTime.getElapsedTime() << " s. (" << threadNumber_
+        << " thread(s), " << (fieldParallelism ? "field" : "vertex")
+        << "-level parallelism)." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
 #endif /* end of include guard: FTMTREE_TPL_H */
@@ -0,0 +1,116 @@
+#include <GridStencil.h>
+
+#define MODULE_S "[GridStencil] "
+
+int ttk::GridStencil::setupTriangulation(Triangulation *const triangulation) {
+
+  dimensions_[0] = dimensions_[1] = dimensions_[2] = 0;
+
+  std::vector<int> gridDimensions;
+  if(triangulation == nullptr || triangulation->getGridDimensions(gridDimensions)
+     || triangulation->hasPeriodicBoundaries()
+     || triangulation->getDimensionality() < 2) {
+    return -1;
+  }
+
+  // remove the axes of size 1: the vertex identifiers remain unchanged
+  SimplexId dimensions[3] = {1, 1, 1};
+  int axisNumber = 0;
+  for(int k = 0; k < 3; k++) {
+    if(gridDimensions[k] > 1)
+      dimensions[axisNumber++] = gridDimensions[k];
+  }
+
+  triangulation->preprocessVertexNeighbors();
+  triangulation->preprocessVertexStars();
+
+  Timer t;
+
+  // the stencils are extracted from one representative vertex of each
+  // position class
+  for(int cz = 0; cz < 3; cz++) {
+    for(int cy = 0; cy < 3; cy++) {
+      for(int cx = 0; cx < 3; cx++) {
+        const int c[3] = {cx, cy, cz};
+        SimplexId p[3];
+        bool isValid = true;
+        for(int k = 0; k < 3; k++) {
+          p[k] = c[k] == 0 ? 0 : (c[k] == 1 ? 1 : dimensions[k] - 1);
+          // the class does not exist on this axis
+          if((c[k] == 1 && dimensions[k] < 3)
+             || (c[k] == 2 && dimensions[k] < 2))
+            isValid = false;
+        }
+        Stencil &stencil = stencils_[cx + 3 * cy + 9 * cz];
+        stencil = Stencil{};
+        if(!isValid)
+          continue;
+
+        const SimplexId vertexId
+          = (p[2] * dimensions[1] + p[1]) * dimensions[0] + p[0];
+
+        const SimplexId neighborNumber
+          = triangulation->getVertexNeighborNumber(vertexId);
+#ifndef TTK_ENABLE_KAMIKAZE
+        if(neighborNumber > (SimplexId)stencil.shifts.size()) {
+          dMsg(std::cerr, MODULE_S "Error: unexpected vertex valence.\n",
+               fatalMsg);
+          return -2;
+        }
+#endif
+        stencil.neighborNumber = neighborNumber;
+
+        std::array<SimplexId, 14> neighbors{};
+        for(SimplexId k = 0; k < neighborNumber; k++) {
+          triangulation->getVertexNeighbor(vertexId, k, neighbors[k]);
+          stencil.shifts[k] = neighbors[k] - vertexId;
+        }
+
+        // link edges: pairs of neighbors sharing a cell of the star
+        const auto localId = [&](const SimplexId v) {
+          for(SimplexId k = 0; k < neighborNumber; k++) {
+            if(neighbors[k] == v)
+              return (int)k;
+          }
+          return -1;
+        };
+        const SimplexId starNumber
+          = triangulation->getVertexStarNumber(vertexId);
+        for(SimplexId i = 0; i < starNumber; i++) {
+          SimplexId cellId = -1;
+          triangulation->getVertexStar(vertexId, i, cellId);
+          const SimplexId cellSize = triangulation->getCellVertexNumber(cellId);
+          for(SimplexId j = 0; j < cellSize; j++) {
+            SimplexId v0 = -1;
+            triangulation->getCellVertex(cellId, j, v0);
+            const int k0 = localId(v0);
+            if(k0 == -1)
+              continue;
+            for(SimplexId l = j + 1; l < cellSize; l++) {
+              SimplexId v1 = -1;
+              triangulation->getCellVertex(cellId, l, v1);
+              const int k1 = localId(v1);
+              if(k1 == -1)
+                continue;
+              stencil.adjacency[k0] |= 1 << k1;
+              stencil.adjacency[k1] |= 1 << k0;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for(int k = 0; k < 3; k++)
+    dimensions_[k] = dimensions[k];
+
+  {
+    std::stringstream msg;
+    msg << MODULE_S "Stencils of the " << dimensions_[0] << "x"
+        << dimensions_[1] << "x" << dimensions_[2] << " grid extracted in "
+        << t.getElapsedTime() << " s." << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 0;
+}
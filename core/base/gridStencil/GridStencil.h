@@ -0,0 +1,287 @@
+/// \ingroup base
+/// \class ttk::GridStencil
+///
+/// \brief TTK stencil kernels for scalar fields defined on regular grids.
+///
+/// On a non-periodic regular grid (ttk::ImplicitTriangulation), the vertex
+/// neighbors only depend on the position of the vertex relatively to the
+/// grid boundary (first, interior or last on each axis). The 27 resulting
+/// stencils (neighbor identifier shifts and link connectivity) are extracted
+/// once from the triangulation, in the local neighbor order of
+/// Triangulation::getVertexNeighbor().
+///
+/// computeSteepestNeighbors() then produces, in a single pass over the
+/// scalar field:
+///   - the steepest descending and ascending neighbor of each vertex (lowest
+///   and highest neighbor in the simulation of simplicity order, -1 for the
+///   minima and the maxima respectively),
+///   - the lower and upper neighbor masks of each vertex (bit k is set if
+///   the k-th neighbor of the vertex is lower, respectively upper).
+///
+/// Each row of the grid is split into at most three runs sharing the same
+/// stencil, which are processed one neighbor at a time with branch-free,
+/// unit-stride loops over the run. These loops are vectorized by the
+/// compiler for the instruction set targeted by the build (e.g. AVX2 or
+/// AVX-512 with -march=native, SSE2 otherwise), with no intrinsics.
+///
+/// The masks can then be consumed by the topological modules, for instance
+/// getLinkComponentNumber() gives the number of connected components of the
+/// lower (or upper) link of a vertex from its mask.
+///
+/// \sa ttk::ScalarFieldCriticalPoints
+/// \sa ttk::ScalarFieldSmoother
+
+#pragma once
+
+// base code includes
+#include <Triangulation.h>
+#include <Wrapper.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace ttk {
+
+  class GridStencil : public Debug {
+
+  public:
+    /// Bit mask over the neighbors of a vertex (at most 14 neighbors).
+    using NeighborMask = unsigned short;
+
+    /// Extract the stencils of a regular grid.
+    /// \param triangulation Input triangulation.
+    /// \return 0 upon success, negative values if the triangulation is not
+    /// a non-periodic regular grid of dimension 2 or 3 (the caller should
+    /// then use the generic triangulation API).
+    int setupTriangulation(Triangulation *const triangulation);
+
+    /// Compute the steepest neighbors and the neighbor masks of all the
+    /// vertices in a single pass. Any output may be a null pointer.
+    /// \param scalars Input scalar field.
+    /// \param offsets Input vertex offsets (simulation of simplicity).
+    /// \param descendingNeighbors Output lowest lower neighbor (-1 for the
+    /// minima).
+    /// \param ascendingNeighbors Output highest upper neighbor (-1 for the
+    /// maxima).
+    /// \param lowerMasks Output lower neighbor masks.
+    /// \param upperMasks Output upper neighbor masks.
+    /// \return 0 upon success, negative values otherwise.
+    template <typename dataType, typename idType>
+    int computeSteepestNeighbors(const dataType *const scalars,
+                                 const idType *const offsets,
+                                 SimplexId *const descendingNeighbors,
+                                 SimplexId *const ascendingNeighbors,
+                                 NeighborMask *const lowerMasks,
+                                 NeighborMask *const upperMasks) const;
+
+    /// Get the number of connected components of the part of the link of a
+    /// vertex spanned by a neighbor mask (e.g. its lower or upper link).
+    /// \param vertexId Input vertex.
+    /// \param mask Input neighbor mask.
+    /// \return The number of connected components.
+    inline int getLinkComponentNumber(const SimplexId vertexId,
+                                      const NeighborMask mask) const {
+      const Stencil &stencil = stencils_[getStencilId(vertexId)];
+
+      int componentNumber = 0;
+      NeighborMask remaining = mask;
+      while(remaining) {
+        // flood the component of the first remaining neighbor
+        NeighborMask component = remaining & (~remaining + 1);
+        NeighborMask front = component;
+        while(front) {
+          NeighborMask next = 0;
+          for(int k = 0; k < stencil.neighborNumber; k++) {
+            if(front & (1 << k))
+              next |= stencil.adjacency[k];
+          }
+          front = next & remaining & ~component;
+          component |= front;
+        }
+        remaining &= ~component;
+        componentNumber++;
+      }
+
+      return componentNumber;
+    }
+
+    /// Get the number of neighbors of a vertex.
+    inline int getNeighborNumber(const SimplexId vertexId) const {
+      return stencils_[getStencilId(vertexId)].neighborNumber;
+    }
+
+    /// Get the identifier shift of the k-th neighbor of a vertex.
+    inline SimplexId getNeighborShift(const SimplexId vertexId,
+                                      const int k) const {
+      return stencils_[getStencilId(vertexId)].shifts[k];
+    }
+
+  protected:
+    struct Stencil {
+      int neighborNumber{};
+      // neighborId = vertexId + shifts[k]
+      std::array<SimplexId, 14> shifts{};
+      // adjacency[k]: neighbors linked to the k-th neighbor in the link
+      std::array<NeighborMask, 14> adjacency{};
+    };
+
+    /// Position class of a coordinate on an axis (0: first, 1: interior,
+    /// 2: last).
+    static inline int getAxisClass(const SimplexId i, const SimplexId n) {
+      return i == 0 ? 0 : (i == n - 1 ? 2 : 1);
+    }
+
+    inline int getStencilId(const SimplexId vertexId) const {
+      const SimplexId x = vertexId % dimensions_[0];
+      const SimplexId y = (vertexId / dimensions_[0]) % dimensions_[1];
+      const SimplexId z = vertexId / (dimensions_[0] * dimensions_[1]);
+      return getAxisClass(x, dimensions_[0])
+             + 3 * getAxisClass(y, dimensions_[1])
+             + 9 * getAxisClass(z, dimensions_[2]);
+    }
+
+    /// Compare a run of vertices to their k-th neighbor.
+    /// The pointers do not alias, which lets the compiler vectorize the
+    /// branch-free loop.
+    template <typename dataType, typename idType>
+    static void updateRun(const dataType *__restrict f,
+                          const idType *__restrict o,
+                          const dataType *__restrict fn,
+                          const idType *__restrict on,
+                          const SimplexId runSize,
+                          const SimplexId firstNeighborId,
+                          const NeighborMask bit,
+                          dataType *__restrict lowValues,
+                          idType *__restrict lowOffsets,
+                          SimplexId *__restrict lowIds,
+                          dataType *__restrict highValues,
+                          idType *__restrict highOffsets,
+                          SimplexId *__restrict highIds,
+                          NeighborMask *__restrict lowerMasks,
+                          NeighborMask *__restrict upperMasks) {
+
+      for(SimplexId x = 0; x < runSize; x++) {
+        const dataType fk = fn[x];
+        const idType ok = on[x];
+        const bool isLower = (fk < f[x]) | ((fk == f[x]) & (ok < o[x]));
+        lowerMasks[x] |= isLower ? bit : 0;
+        upperMasks[x] |= isLower ? 0 : bit;
+
+        // the lowest (resp. highest) neighbor is necessarily lower (resp.
+        // upper)
+        const dataType lv = lowValues[x];
+        const idType lo = lowOffsets[x];
+        const bool isLowest = (fk < lv) | ((fk == lv) & (ok < lo));
+        lowValues[x] = isLowest ? fk : lv;
+        lowOffsets[x] = isLowest ? ok : lo;
+        lowIds[x] = isLowest ? firstNeighborId + x : lowIds[x];
+
+        const dataType hv = highValues[x];
+        const idType ho = highOffsets[x];
+        const bool isHighest = (fk > hv) | ((fk == hv) & (ok > ho));
+        highValues[x] = isHighest ? fk : hv;
+        highOffsets[x] = isHighest ? ok : ho;
+        highIds[x] = isHighest ? firstNeighborId + x : highIds[x];
+      }
+    }
+
+    // grid dimensions, axes of size 1 removed
+    SimplexId dimensions_[3]{};
+    std::array<Stencil, 27> stencils_{};
+  };
+} // namespace ttk
+
+template <typename dataType, typename idType>
+int ttk::GridStencil::computeSteepestNeighbors(
+  const dataType *const scalars,
+  const idType *const offsets,
+  SimplexId *const descendingNeighbors,
+  SimplexId *const ascendingNeighbors,
+  NeighborMask *const lowerMasks,
+  NeighborMask *const upperMasks) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(dimensions_[0] == 0)
+    return -1;
+  if(scalars == nullptr || offsets == nullptr)
+    return -2;
+#endif
+
+  Timer t;
+
+  const SimplexId nx = dimensions_[0];
+  const SimplexId ny = dimensions_[1];
+  const SimplexId nz = dimensions_[2];
+  const SimplexId rowNumber = ny * nz;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    // row buffers (lowest and highest neighbor found so far, masks)
+    std::vector<dataType> lowValues(nx), highValues(nx);
+    std::vector<idType> lowOffsets(nx), highOffsets(nx);
+    std::vector<SimplexId> lowIds(nx), highIds(nx);
+    std::vector<NeighborMask> lower(nx), upper(nx);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for(SimplexId r = 0; r < rowNumber; r++) {
+      const SimplexId y = r % ny;
+      const SimplexId z = r / ny;
+      const SimplexId rowStart = r * nx;
+      const dataType *const f = scalars + rowStart;
+      const idType *const o = offsets + rowStart;
+      const int rowStencilId
+        = 3 * getAxisClass(y, ny) + 9 * getAxisClass(z, nz);
+
+      for(SimplexId x = 0; x < nx; x++) {
+        lowValues[x] = highValues[x] = f[x];
+        lowOffsets[x] = highOffsets[x] = o[x];
+        lowIds[x] = highIds[x] = -1;
+        lower[x] = upper[x] = 0;
+      }
+
+      // runs of vertices sharing the same stencil: first, interior, last
+      const SimplexId runBegins[3] = {0, 1, nx - 1};
+      const SimplexId runEnds[3] = {1, nx - 1, nx};
+      for(int c = 0; c < 3; c++) {
+        const SimplexId begin = runBegins[c];
+        const SimplexId end = runEnds[c];
+        if(begin >= end)
+          continue;
+        const Stencil &stencil = stencils_[c + rowStencilId];
+
+        for(int k = 0; k < stencil.neighborNumber; k++) {
+          const SimplexId shift = stencil.shifts[k];
+          updateRun(f + begin, o + begin, f + begin + shift, o + begin + shift,
+                    end - begin, rowStart + begin + shift, 1 << k,
+                    &lowValues[begin], &lowOffsets[begin], &lowIds[begin],
+                    &highValues[begin], &highOffsets[begin], &highIds[begin],
+                    &lower[begin], &upper[begin]);
+        }
+      }
+
+      if(descendingNeighbors != nullptr)
+        std::copy(lowIds.begin(), lowIds.end(), descendingNeighbors + rowStart);
+      if(ascendingNeighbors != nullptr)
+        std::copy(highIds.begin(), highIds.end(), ascendingNeighbors + rowStart);
+      if(lowerMasks != nullptr)
+        std::copy(lower.begin(), lower.end(), lowerMasks + rowStart);
+      if(upperMasks != nullptr)
+        std::copy(upper.begin(), upper.end(), upperMasks + rowStart);
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[GridStencil] Steepest neighbors of " << nx * ny * nz
+        << " vertices computed in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " thread(s))." << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
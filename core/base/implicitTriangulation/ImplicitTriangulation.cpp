@@ -554,6 +554,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexNeighbors() {
   if(!vertexNeighborList_.size()) {
     Timer t;
     vertexNeighborList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexNeighborList_[i].resize(getVertexNeighborNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexNeighborList_[i].size(); ++j)
@@ -563,7 +566,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexNeighbors() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Vertex neighbors built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -723,6 +727,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexEdges() {
     Timer t;
 
     vertexEdgeList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexEdgeList_[i].resize(getVertexEdgeNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexEdgeList_[i].size(); ++j)
@@ -732,7 +739,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexEdges() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Vertex edges built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -915,6 +923,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexTriangles() {
     Timer t;
 
     vertexTriangleList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexTriangleList_[i].resize(getVertexTriangleNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexTriangleList_[i].size(); ++j)
@@ -924,7 +935,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexTriangles() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Vertex triangles built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1057,6 +1069,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexLinks() {
     Timer t;
 
     vertexLinkList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexLinkList_[i].resize(getVertexLinkNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexLinkList_[i].size(); ++j)
@@ -1066,7 +1081,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexLinks() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Vertex links built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1299,6 +1315,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexStars() {
   if(!vertexStarList_.size()) {
     Timer t;
     vertexStarList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexStarList_[i].resize(getVertexStarNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexStarList_[i].size(); ++j)
@@ -1308,7 +1327,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getVertexStars() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Vertex stars built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1569,6 +1589,9 @@ const vector<pair<SimplexId, SimplexId>> *ImplicitTriangulation::getEdges() {
     Timer t;
 
     edgeList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       SimplexId id0, id1;
       getEdgeVertex(i, 0, id0);
@@ -1580,8 +1603,8 @@ const vector<pair<SimplexId, SimplexId>> *ImplicitTriangulation::getEdges() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Edge-list built in " << t.getElapsedTime()
-          << " s. (" << edgeList_.size() << " edges, (" << 1 << " thread(s))"
-          << endl;
+          << " s. (" << edgeList_.size() << " edges, (" << threadNumber_
+          << " thread(s))" << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1913,6 +1936,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeTriangles() {
     Timer t;
 
     edgeTriangleList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       edgeTriangleList_[i].resize(getEdgeTriangleNumber(i));
       for(SimplexId j = 0; j < (SimplexId)edgeTriangleList_[i].size(); ++j)
@@ -1922,7 +1948,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeTriangles() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Triangle edges built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1998,6 +2025,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeLinks() {
     Timer t;
 
     edgeLinkList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       edgeLinkList_[i].resize(getEdgeLinkNumber(i));
       for(SimplexId j = 0; j < (SimplexId)edgeLinkList_[i].size(); ++j)
@@ -2007,7 +2037,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeLinks() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] List of edge links built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -2227,6 +2258,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeStars() {
     Timer t;
 
     edgeStarList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       edgeStarList_[i].resize(getEdgeStarNumber(i));
       for(SimplexId j = 0; j < (SimplexId)edgeStarList_[i].size(); ++j)
@@ -2236,7 +2270,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getEdgeStars() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] List of edge stars built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -2448,6 +2483,9 @@ int ImplicitTriangulation::getTriangleEdge(const SimplexId &triangleId,
 int ImplicitTriangulation::getTriangleEdges(
   vector<vector<SimplexId>> &edges) const {
   edges.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < triangleNumber_; ++i) {
     edges[i].resize(3);
     for(int j = 0; j < 3; ++j)
@@ -2466,7 +2504,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleEdges() {
       stringstream msg;
       msg << "[ImplicitTriangulation] Triangle edges (" << triangleNumber_
           << " triangle(s), " << edgeNumber_ << " edge(s)) computed in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -2479,6 +2518,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangles() {
     Timer t;
 
     triangleList_.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < triangleNumber_; ++i) {
       triangleList_[i].resize(3);
       for(int j = 0; j < 3; ++j)
@@ -2488,8 +2530,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangles() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Triangle list (" << triangleNumber_
-          << " triangles) computed in " << t.getElapsedTime() << " s. (" << 1
-          << " thread(s))." << endl;
+          << " triangles) computed in " << t.getElapsedTime() << " s. ("
+          << threadNumber_ << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -2555,6 +2597,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleLinks() {
     Timer t;
 
     triangleLinkList_.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < triangleNumber_; ++i) {
       triangleLinkList_[i].resize(getTriangleLinkNumber(i));
       for(SimplexId j = 0; j < (SimplexId)triangleLinkList_[i].size(); ++j)
@@ -2564,7 +2609,7 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleLinks() {
     {
       stringstream msg;
       msg << "[TriangulationVTI] Triangle links built in " << t.getElapsedTime()
-          << " s. (" << 1 << " thread(s))." << endl;
+          << " s. (" << threadNumber_ << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -2674,6 +2719,9 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleStars() {
     Timer t;
 
     triangleStarList_.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < triangleNumber_; ++i) {
       triangleStarList_[i].resize(getTriangleStarNumber(i));
       for(SimplexId j = 0; j < (SimplexId)triangleStarList_[i].size(); ++j)
@@ -2683,7 +2731,7 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getTriangleStars() {
     {
       stringstream msg;
       msg << "[TriangulationVTI] Triangle stars built in " << t.getElapsedTime()
-          << " s. (" << 1 << " thread(s))." << endl;
+          << " s. (" << threadNumber_ << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -2815,6 +2863,9 @@ int ImplicitTriangulation::getTriangleNeighbor(const SimplexId &triangleId,
 int ImplicitTriangulation::getTriangleNeighbors(
   vector<vector<SimplexId>> &neighbors) {
   neighbors.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < triangleNumber_; ++i) {
     neighbors[i].resize(getTriangleNeighborNumber(i));
     for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
@@ -2909,6 +2960,9 @@ int ImplicitTriangulation::getTetrahedronEdge(const SimplexId &tetId,
 int ImplicitTriangulation::getTetrahedronEdges(
   vector<vector<SimplexId>> &edges) const {
   edges.resize(tetrahedronNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
     edges[i].resize(6);
     for(int j = 0; j < 6; ++j)
@@ -2963,6 +3017,9 @@ int ImplicitTriangulation::getTetrahedronTriangle(const SimplexId &tetId,
 int ImplicitTriangulation::getTetrahedronTriangles(
   vector<vector<SimplexId>> &triangles) const {
   triangles.resize(tetrahedronNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
     triangles[i].resize(4);
     for(int j = 0; j < 4; ++j)
@@ -3083,6 +3140,9 @@ int ImplicitTriangulation::getTetrahedronNeighbor(const SimplexId &tetId,
 int ImplicitTriangulation::getTetrahedronNeighbors(
   vector<vector<SimplexId>> &neighbors) {
   neighbors.resize(tetrahedronNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
     neighbors[i].resize(getTetrahedronNeighborNumber(i));
     for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
@@ -3144,7 +3204,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getCellEdges() {
       stringstream msg;
       msg << "[ImplicitTriangulation] Cell edges (" << getNumberOfCells()
           << " cell(s), " << edgeNumber_ << "edge(s)) computed in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -3172,7 +3233,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getCellTriangles() {
       stringstream msg;
       msg << "[ImplicitTriangulation] Cell triangles (" << cellNumber_
           << " cell(s), " << triangleNumber_ << "edge(s)) computed in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -3234,7 +3296,8 @@ const vector<vector<SimplexId>> *ImplicitTriangulation::getCellNeighbors() {
     {
       stringstream msg;
       msg << "[ImplicitTriangulation] Cell neighbors (" << getNumberOfCells()
-          << " cells) computed in " << t.getElapsedTime() << " s. (" << 1
+          << " cells) computed in " << t.getElapsedTime() << " s. ("
+          << threadNumber_
           << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
@@ -49,6 +49,24 @@ namespace ttk {
 
     int execute(std::vector<std::pair<SimplexId, char>> &jacobiSet);
 
+    /// Classify all the edges of the triangulation, without synchronization
+    /// between threads.
+    /// \param edgeTypes Output type of each edge (-2: regular, 0: minimum,
+    /// 1: saddle, 2: maximum, -1: multi-saddle).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int computeEdgeTypes(std::vector<char> &edgeTypes);
+
+    /// Compact the non-regular edges of a per-edge type array into a list of
+    /// Jacobi edges, in increasing edge identifier order (parallel prefix
+    /// sum).
+    /// \param edgeTypes Type of each edge (see computeEdgeTypes()).
+    /// \param jacobiSet Output list of Jacobi edges (edge identifier and
+    /// type).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int compactEdgeTypes(
+      const std::vector<char> &edgeTypes,
+      std::vector<std::pair<SimplexId, char>> &jacobiSet) const;
+
     char getCriticalType(const SimplexId &edgeId);
 
     int perturbate(const dataTypeU &uEpsilon = pow(10, -DBL_DIG),
@@ -122,6 +140,15 @@ namespace ttk {
   protected:
     int executeLegacy(std::vector<std::pair<SimplexId, char>> &jacobiSet);
 
+    // the link of the edge is computed on the fly from its star, in buffers
+    // re-used from one edge to the next.
+    char getCriticalType(const SimplexId &edgeId,
+                         std::vector<SimplexId> &linkVertices,
+                         std::vector<char> &linkSides,
+                         std::vector<SimplexId> &linkComponents) const;
+
+    int initSosOffsets();
+
     SimplexId vertexNumber_;
     const SimplexId *tetList_;
     const void *uField_, *vField_;
@@ -1,5 +1,7 @@
 #include <JacobiSet.h>
 
+#include <algorithm>
+
 template <class dataTypeU, class dataTypeV>
 ttk::JacobiSet<dataTypeU, dataTypeV>::JacobiSet() {
 
@@ -186,12 +188,68 @@ int ttk::JacobiSet<dataTypeU, dataTypeV>::execute(
     }
     return -1;
   }
-  if(!uField_)
-    return -2;
-  if(!vField_)
-    return -3;
 #endif
 
+  jacobiSet.clear();
+
+  std::vector<char> edgeTypes;
+
+  int ret = computeEdgeTypes(edgeTypes);
+  if(ret)
+    return ret;
+
+  compactEdgeTypes(edgeTypes, jacobiSet);
+
+  SimplexId edgeNumber = edgeTypes.size();
+
+  if(debugLevel_ >= Debug::infoMsg) {
+    SimplexId minimumNumber = 0, saddleNumber = 0, maximumNumber = 0,
+              monkeySaddleNumber = 0;
+
+    for(SimplexId i = 0; i < (SimplexId)jacobiSet.size(); i++) {
+      switch(jacobiSet[i].second) {
+        case 0:
+          minimumNumber++;
+          break;
+        case 1:
+          saddleNumber++;
+          break;
+        case 2:
+          maximumNumber++;
+          break;
+        case -1:
+          monkeySaddleNumber++;
+          break;
+      }
+    }
+
+    {
+      std::stringstream msg;
+      msg << "[JacobiSet] Minimum edges: " << minimumNumber << std::endl;
+      msg << "[JacobiSet] Saddle edges: " << saddleNumber << std::endl;
+      msg << "[JacobiSet] Maximum edges: " << maximumNumber << std::endl;
+      msg << "[JacobiSet] Multi-saddle edges: " << monkeySaddleNumber
+          << std::endl;
+      dMsg(std::cout, msg.str(), Debug::infoMsg);
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[JacobiSet] Data-set (" << edgeNumber << " edges) processed in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    msg << "[JacobiSet] Jacobi edge rate: "
+        << 100 * (jacobiSet.size() / ((double)edgeNumber)) << "%" << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+template <class dataTypeU, class dataTypeV>
+int ttk::JacobiSet<dataTypeU, dataTypeV>::initSosOffsets() {
+
   SimplexId vertexNumber = triangulation_->getNumberOfVertices();
 
   if(!sosOffsetsU_) {
@@ -220,78 +278,109 @@ int ttk::JacobiSet<dataTypeU, dataTypeV>::execute(
     }
   }
 
-  jacobiSet.clear();
+  return 0;
+}
+
+template <class dataTypeU, class dataTypeV>
+int ttk::JacobiSet<dataTypeU, dataTypeV>::computeEdgeTypes(
+  std::vector<char> &edgeTypes) {
+
+  Timer t;
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((!triangulation_) || (triangulation_->isEmpty()))
+    return -1;
+  if(!uField_)
+    return -2;
+  if(!vField_)
+    return -3;
+#endif
+
+  initSosOffsets();
 
   SimplexId edgeNumber = triangulation_->getNumberOfEdges();
 
-  std::vector<std::vector<std::pair<SimplexId, char>>> threadedCriticalTypes(
-    threadNumber_);
+  edgeTypes.resize(edgeNumber);
 
+  // each thread writes the types of its own edges: no synchronization.
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel num_threads(threadNumber_)
 #endif
-  for(SimplexId i = 0; i < edgeNumber; i++) {
-
-    char type = getCriticalType(i);
+  {
+    std::vector<SimplexId> linkVertices, linkComponents;
+    std::vector<char> linkSides;
 
-    if(type != -2) {
-      // -2: regular vertex
-      ThreadId threadId = 0;
 #ifdef TTK_ENABLE_OPENMP
-      threadId = omp_get_thread_num();
+#pragma omp for schedule(static)
 #endif
-      threadedCriticalTypes[threadId].push_back(
-        std::pair<SimplexId, char>(i, type));
+    for(SimplexId i = 0; i < edgeNumber; i++) {
+      edgeTypes[i]
+        = getCriticalType(i, linkVertices, linkSides, linkComponents);
     }
   }
 
-  // now merge the threaded lists
-  for(SimplexId i = 0; i < threadNumber_; i++) {
-    for(SimplexId j = 0; j < (SimplexId)threadedCriticalTypes[i].size(); j++) {
-      jacobiSet.push_back(threadedCriticalTypes[i][j]);
-    }
+  {
+    std::stringstream msg;
+    msg << "[JacobiSet] Edges (" << edgeNumber << ") classified in "
+        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+        << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
   }
 
-  if(debugLevel_ >= Debug::infoMsg) {
-    SimplexId minimumNumber = 0, saddleNumber = 0, maximumNumber = 0,
-              monkeySaddleNumber = 0;
+  return 0;
+}
 
-    for(SimplexId i = 0; i < (SimplexId)jacobiSet.size(); i++) {
-      switch(jacobiSet[i].second) {
-        case 0:
-          minimumNumber++;
-          break;
-        case 1:
-          saddleNumber++;
-          break;
-        case 2:
-          maximumNumber++;
-          break;
-        case -1:
-          monkeySaddleNumber++;
-          break;
-      }
+template <class dataTypeU, class dataTypeV>
+int ttk::JacobiSet<dataTypeU, dataTypeV>::compactEdgeTypes(
+  const std::vector<char> &edgeTypes,
+  std::vector<std::pair<SimplexId, char>> &jacobiSet) const {
+
+  const SimplexId edgeNumber = edgeTypes.size();
+
+  // number of Jacobi edges in the chunk of each thread
+  std::vector<SimplexId> threadOffsets(threadNumber_ + 1, 0);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+    ThreadId threadId = 0, threadNumber = 1;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+    threadNumber = omp_get_num_threads();
+#endif
+
+    const SimplexId begin
+      = ((LongSimplexId)edgeNumber * threadId) / threadNumber;
+    const SimplexId end
+      = ((LongSimplexId)edgeNumber * (threadId + 1)) / threadNumber;
+
+    SimplexId jacobiNumber = 0;
+    for(SimplexId i = begin; i < end; i++) {
+      if(edgeTypes[i] != -2)
+        jacobiNumber++;
     }
+    threadOffsets[threadId + 1] = jacobiNumber;
 
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp barrier
+#pragma omp single
+#endif
     {
-      std::stringstream msg;
-      msg << "[JacobiSet] Minimum edges: " << minimumNumber << std::endl;
-      msg << "[JacobiSet] Saddle edges: " << saddleNumber << std::endl;
-      msg << "[JacobiSet] Maximum edges: " << maximumNumber << std::endl;
-      msg << "[JacobiSet] Multi-saddle edges: " << monkeySaddleNumber
-          << std::endl;
-      dMsg(std::cout, msg.str(), Debug::infoMsg);
+      for(ThreadId i = 0; i < threadNumber; i++) {
+        threadOffsets[i + 1] += threadOffsets[i];
+      }
+      jacobiSet.resize(threadOffsets[threadNumber]);
     }
-  }
 
-  {
-    std::stringstream msg;
-    msg << "[JacobiSet] Data-set (" << edgeNumber << " edges) processed in "
-        << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
-        << std::endl;
-    msg << "[JacobiSet] Jacobi edge rate: "
-        << 100 * (jacobiSet.size() / ((double)edgeNumber)) << "%" << std::endl;
-    dMsg(std::cout, msg.str(), timeMsg);
+    SimplexId jacobiId = threadOffsets[threadId];
+    for(SimplexId i = begin; i < end; i++) {
+      if(edgeTypes[i] != -2) {
+        // -2: regular edge
+        jacobiSet[jacobiId] = std::pair<SimplexId, char>(i, edgeTypes[i]);
+        jacobiId++;
+      }
+    }
   }
 
   return 0;
@@ -497,6 +586,19 @@ template <class dataTypeU, class dataTypeV>
 char ttk::JacobiSet<dataTypeU, dataTypeV>::getCriticalType(
   const SimplexId &edgeId) {
 
+  std::vector<SimplexId> linkVertices, linkComponents;
+  std::vector<char> linkSides;
+
+  return getCriticalType(edgeId, linkVertices, linkSides, linkComponents);
+}
+
+template <class dataTypeU, class dataTypeV>
+char ttk::JacobiSet<dataTypeU, dataTypeV>::getCriticalType(
+  const SimplexId &edgeId,
+  std::vector<SimplexId> &linkVertices,
+  std::vector<char> &linkSides,
+  std::vector<SimplexId> &linkComponents) const {
+
   dataTypeU *uField = (dataTypeU *)uField_;
   dataTypeV *vField = (dataTypeV *)vField_;
 
@@ -521,9 +623,12 @@ char ttk::JacobiSet<dataTypeU, dataTypeV>::getCriticalType(
   rangeNormal[1] = rangeEdge[0];
 
   SimplexId starNumber = triangulation_->getEdgeStarNumber(edgeId);
-  std::vector<SimplexId> lowerNeighbors, upperNeighbors;
 
-  SimplexId neighborNumber = 0;
+  // link vertices and their side (0: lower, 1: upper, -1: inconsistent)
+  linkVertices.clear();
+  linkSides.clear();
+
+  SimplexId lowerNumber = 0, upperNumber = 0;
 
   for(SimplexId i = 0; i < starNumber; i++) {
 
@@ -538,207 +643,143 @@ char ttk::JacobiSet<dataTypeU, dataTypeV>::getCriticalType(
       if((vertexId != -1) && (vertexId != vertexId0)
          && (vertexId != vertexId1)) {
         // new neighbor
-        bool isIn = false;
-        for(SimplexId k = 0; k < (SimplexId)lowerNeighbors.size(); k++) {
-          if(vertexId == lowerNeighbors[k]) {
-            isIn = true;
-            break;
-          }
+        if(std::find(linkVertices.begin(), linkVertices.end(), vertexId)
+           != linkVertices.end())
+          continue;
+
+        // compute the actual distance field
+        // A) compute the distance field
+        double projectedVertex[2];
+        projectedVertex[0] = uField[vertexId];
+        projectedVertex[1] = vField[vertexId];
+
+        double vertexRangeEdge[2];
+        vertexRangeEdge[0] = projectedVertex[0] - projectedPivotVertex[0];
+        vertexRangeEdge[1] = projectedVertex[1] - projectedPivotVertex[1];
+
+        // signed distance: linear function of the dot product
+        double distance = vertexRangeEdge[0] * rangeNormal[0]
+                          + vertexRangeEdge[1] * rangeNormal[1];
+
+        if(distance == 0) {
+          // degenerate
+          // compute the distance field out of the offset positions
+          double offsetProjectedPivotVertex[2];
+          offsetProjectedPivotVertex[0] = (*sosOffsetsU_)[vertexId0];
+          offsetProjectedPivotVertex[1]
+            = (*sosOffsetsV_)[vertexId0] * (*sosOffsetsV_)[vertexId0];
+
+          double offsetProjectedOtherVertex[2];
+          offsetProjectedOtherVertex[0] = (*sosOffsetsU_)[vertexId1];
+          offsetProjectedOtherVertex[1]
+            = (*sosOffsetsV_)[vertexId1] * (*sosOffsetsV_)[vertexId1];
+
+          double offsetRangeEdge[2];
+          offsetRangeEdge[0]
+            = offsetProjectedOtherVertex[0] - offsetProjectedPivotVertex[0];
+          offsetRangeEdge[1]
+            = offsetProjectedOtherVertex[1] - offsetProjectedPivotVertex[1];
+
+          double offsetRangeNormal[2];
+          offsetRangeNormal[0] = -offsetRangeEdge[1];
+          offsetRangeNormal[1] = offsetRangeEdge[0];
+
+          projectedVertex[0] = (*sosOffsetsU_)[vertexId];
+          projectedVertex[1]
+            = (*sosOffsetsV_)[vertexId] * (*sosOffsetsV_)[vertexId];
+
+          vertexRangeEdge[0]
+            = projectedVertex[0] - offsetProjectedPivotVertex[0];
+          vertexRangeEdge[1]
+            = projectedVertex[1] - offsetProjectedPivotVertex[1];
+
+          distance = vertexRangeEdge[0] * offsetRangeNormal[0]
+                     + vertexRangeEdge[1] * offsetRangeNormal[1];
         }
 
-        if(!isIn) {
-          for(SimplexId k = 0; k < (SimplexId)upperNeighbors.size(); k++) {
-            if(vertexId == upperNeighbors[k]) {
-              isIn = true;
-              break;
-            }
-          }
-        }
-
-        if(!isIn) {
-          // compute the actual distance field
-          // A) compute the distance field
-          double projectedVertex[2];
-          projectedVertex[0] = uField[vertexId];
-          projectedVertex[1] = vField[vertexId];
-
-          double vertexRangeEdge[2];
-          vertexRangeEdge[0] = projectedVertex[0] - projectedPivotVertex[0];
-          vertexRangeEdge[1] = projectedVertex[1] - projectedPivotVertex[1];
-
-          // signed distance: linear function of the dot product
-          double distance = vertexRangeEdge[0] * rangeNormal[0]
-                            + vertexRangeEdge[1] * rangeNormal[1];
-
-          neighborNumber++;
-
-          if(distance < 0) {
-            lowerNeighbors.push_back(vertexId);
-          } else if(distance > 0) {
-            upperNeighbors.push_back(vertexId);
-          } else {
-            // degenerate
-            // compute the distance field out of the offset positions
-            double offsetProjectedPivotVertex[2];
-            offsetProjectedPivotVertex[0] = (*sosOffsetsU_)[vertexId0];
-            offsetProjectedPivotVertex[1]
-              = (*sosOffsetsV_)[vertexId0] * (*sosOffsetsV_)[vertexId0];
-
-            double offsetProjectedOtherVertex[2];
-            offsetProjectedOtherVertex[0] = (*sosOffsetsU_)[vertexId1];
-            offsetProjectedOtherVertex[1]
-              = (*sosOffsetsV_)[vertexId1] * (*sosOffsetsV_)[vertexId1];
-
-            double offsetRangeEdge[2];
-            offsetRangeEdge[0]
-              = offsetProjectedOtherVertex[0] - offsetProjectedPivotVertex[0];
-            offsetRangeEdge[1]
-              = offsetProjectedOtherVertex[1] - offsetProjectedPivotVertex[1];
-
-            double offsetRangeNormal[2];
-            offsetRangeNormal[0] = -offsetRangeEdge[1];
-            offsetRangeNormal[1] = offsetRangeEdge[0];
-
-            projectedVertex[0] = (*sosOffsetsU_)[vertexId];
-            projectedVertex[1]
-              = (*sosOffsetsV_)[vertexId] * (*sosOffsetsV_)[vertexId];
-
-            vertexRangeEdge[0]
-              = projectedVertex[0] - offsetProjectedPivotVertex[0];
-            vertexRangeEdge[1]
-              = projectedVertex[1] - offsetProjectedPivotVertex[1];
-
-            distance = vertexRangeEdge[0] * offsetRangeNormal[0]
-                       + vertexRangeEdge[1] * offsetRangeNormal[1];
-
-            if(distance < 0) {
-              lowerNeighbors.push_back(vertexId);
-            } else if(distance > 0) {
-              upperNeighbors.push_back(vertexId);
-            } else {
-              std::stringstream msg;
-              msg << "[JacobiSet] "
-                  << "Inconsistent (non-bijective?) offsets for vertex #"
-                  << vertexId << std::endl;
-              dMsg(std::cerr, msg.str(), Debug::infoMsg);
-            }
-          }
+        linkVertices.push_back(vertexId);
+
+        if(distance < 0) {
+          linkSides.push_back(0);
+          lowerNumber++;
+        } else if(distance > 0) {
+          linkSides.push_back(1);
+          upperNumber++;
+        } else {
+          linkSides.push_back(-1);
+          std::stringstream msg;
+          msg << "[JacobiSet] "
+              << "Inconsistent (non-bijective?) offsets for vertex #"
+              << vertexId << std::endl;
+          dMsg(std::cerr, msg.str(), Debug::infoMsg);
         }
       }
     }
   }
 
   // at this point, we know if each vertex of the edge link is higher or not.
-  if((SimplexId)(lowerNeighbors.size() + upperNeighbors.size())
-     != neighborNumber) {
+  if(lowerNumber + upperNumber != (SimplexId)linkVertices.size()) {
     // Inconsistent offsets (cf above error message)
     return -2;
   }
 
-  if(lowerNeighbors.empty()) {
+  if(!lowerNumber) {
     // minimum
     return 0;
   }
-  if(upperNeighbors.empty()) {
+  if(!upperNumber) {
     // maximum
     return 2;
   }
 
-  // let's check the connectivity now
-  std::vector<UnionFind> lowerSeeds(lowerNeighbors.size());
-  std::vector<UnionFind *> lowerList(lowerNeighbors.size());
-  std::vector<UnionFind> upperSeeds(upperNeighbors.size());
-  std::vector<UnionFind *> upperList(upperNeighbors.size());
-
-  for(SimplexId i = 0; i < (SimplexId)lowerSeeds.size(); i++) {
-    lowerList[i] = &(lowerSeeds[i]);
-  }
-  for(SimplexId i = 0; i < (SimplexId)upperSeeds.size(); i++) {
-    upperList[i] = &(upperSeeds[i]);
+  // let's check the connectivity now: union-find on the link vertices,
+  // connected by the link edges (one per tet) between vertices of the same
+  // side.
+  linkComponents.resize(linkVertices.size());
+  for(SimplexId i = 0; i < (SimplexId)linkComponents.size(); i++) {
+    linkComponents[i] = i;
   }
 
+  SimplexId componentNumber = linkVertices.size();
+
   for(SimplexId i = 0; i < starNumber; i++) {
 
     SimplexId tetId = -1;
     triangulation_->getEdgeStar(edgeId, i, tetId);
 
-    SimplexId vertexNumber = triangulation_->getCellVertexNumber(tetId);
-    for(SimplexId j = 0; j < vertexNumber; j++) {
-      SimplexId edgeVertexId0 = -1;
-      triangulation_->getCellVertex(tetId, j, edgeVertexId0);
-      if((edgeVertexId0 != vertexId0) && (edgeVertexId0 != vertexId1)) {
-        for(SimplexId k = j + 1; k < vertexNumber; k++) {
-          SimplexId edgeVertexId1 = -1;
-          triangulation_->getCellVertex(tetId, k, edgeVertexId1);
-          if((edgeVertexId1 != vertexId0) && (edgeVertexId1 != vertexId1)) {
-            // processing the edge (edgeVertexId0, edgeVertexId1)
-
-            // we need to find out if they're lower or not
-            bool lower0 = false;
-            for(SimplexId l = 0; l < (SimplexId)lowerNeighbors.size(); l++) {
-              if(lowerNeighbors[l] == edgeVertexId0) {
-                lower0 = true;
-                break;
-              }
-            }
-            bool lower1 = false;
-            for(SimplexId l = 0; l < (SimplexId)lowerNeighbors.size(); l++) {
-              if(lowerNeighbors[l] == edgeVertexId1) {
-                lower1 = true;
-                break;
-              }
-            }
-
-            std::vector<SimplexId> *neighbors = &lowerNeighbors;
-            std::vector<UnionFind *> *seeds = &lowerList;
+    SimplexId linkEdge[2] = {-1, -1};
+    int linkEdgeVertexNumber = 0;
 
-            if(!lower0) {
-              neighbors = &upperNeighbors;
-              seeds = &upperList;
-            }
-
-            if(lower0 == lower1) {
-              // connect their union-find sets!
-              SimplexId lowerId0 = -1, lowerId1 = -1;
-              for(SimplexId l = 0; l < (SimplexId)neighbors->size(); l++) {
-                if((*neighbors)[l] == edgeVertexId0) {
-                  lowerId0 = l;
-                }
-                if((*neighbors)[l] == edgeVertexId1) {
-                  lowerId1 = l;
-                }
-              }
-
-              if((lowerId0 != -1) && (lowerId1 != -1)) {
-                (*seeds)[lowerId0]
-                  = makeUnion((*seeds)[lowerId0], (*seeds)[lowerId1]);
-                (*seeds)[lowerId1] = (*seeds)[lowerId0];
-              }
-            }
+    SimplexId vertexNumber = triangulation_->getCellVertexNumber(tetId);
+    for(SimplexId j = 0; (j < vertexNumber) && (linkEdgeVertexNumber < 2);
+        j++) {
+      SimplexId vertexId = -1;
+      triangulation_->getCellVertex(tetId, j, vertexId);
+      if((vertexId != vertexId0) && (vertexId != vertexId1)) {
+        linkEdge[linkEdgeVertexNumber] = std::find(linkVertices.begin(),
+                                                   linkVertices.end(), vertexId)
+                                         - linkVertices.begin();
+        linkEdgeVertexNumber++;
+      }
+    }
 
-            break;
-          }
-        }
+    if((linkEdgeVertexNumber == 2)
+       && (linkSides[linkEdge[0]] == linkSides[linkEdge[1]])) {
+      // connect their union-find sets!
+      SimplexId root0 = linkEdge[0], root1 = linkEdge[1];
+      while(linkComponents[root0] != root0)
+        root0 = linkComponents[root0];
+      while(linkComponents[root1] != root1)
+        root1 = linkComponents[root1];
+      if(root0 != root1) {
+        linkComponents[root1] = root0;
+        componentNumber--;
       }
     }
   }
 
-  // update the UF if necessary
-  for(SimplexId i = 0; i < (SimplexId)lowerList.size(); i++)
-    lowerList[i] = lowerList[i]->find();
-  for(SimplexId i = 0; i < (SimplexId)upperList.size(); i++)
-    upperList[i] = upperList[i]->find();
-
-  std::vector<UnionFind *>::iterator it;
-  sort(lowerList.begin(), lowerList.end());
-  it = unique(lowerList.begin(), lowerList.end());
-  lowerList.resize(distance(lowerList.begin(), it));
-
-  sort(upperList.begin(), upperList.end());
-  it = unique(upperList.begin(), upperList.end());
-  upperList.resize(distance(upperList.begin(), it));
-
-  if((upperList.size() == 1) && (lowerList.size() == 1))
+  // one lower and one upper component
+  if(componentNumber == 2)
     return -2;
 
   return 1;
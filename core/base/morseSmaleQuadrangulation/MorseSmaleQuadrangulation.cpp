@@ -1,10 +1,11 @@
-#include <BarycentricSubdivision.h>
 #include <Dijkstra.h>
 #include <Geometry.h>
 #include <MorseSmaleQuadrangulation.h>
 
 #include <array>
 #include <cmath>
+#include <functional>
+#include <limits>
 #include <numeric>
 #include <queue>
 
@@ -20,31 +21,152 @@ struct Quad {
 };
 
 int ttk::MorseSmaleQuadrangulation::detectCellSeps() {
-  BarycentricSubdivision bs{};
-  Triangulation newT{};
 
-  bs.setupTriangulation(triangulation_);
-  bs.setOutputTriangulation(&newT);
-  bs.setInputPoints(inputPoints_);
-  bs.execute();
+  // The barycentric subdivision of the input triangulation is implicit:
+  // its simplices are indexed using the relations of the input
+  // triangulation (preprocessed in setupTriangulation) and no
+  // subdivised triangulation is built.
+  //
+  // Subdivision vertices: input vertices, then edge middles
+  // (verticesNumber_ + edge id), then triangle barycenters
+  // (verticesNumber_ + nEdges + triangle id).
+  //
+  // Sub-triangle 6 * t + 2 * k + l lies in triangle t, between edge
+  // number k of t and vertex number l of this edge.
+  //
+  // Sub-edges:
+  // - 2 * e + l between edge e middle and its vertex number l,
+  // - 2 * nEdges + 3 * t + k between triangle t barycenter and its edge
+  //   number k middle,
+  // - 2 * nEdges + 3 * nTriangles + 3 * t + j between triangle t
+  //   barycenter and its vertex number j.
+
+  const SimplexId nEdges = triangulation_->getNumberOfEdges();
+  const SimplexId nTriangles = triangulation_->getNumberOfTriangles();
+
+  // local index of an edge in a triangle, -1 if not found
+  auto triangleEdgeIndex
+    = [&](const SimplexId t, const SimplexId e) -> SimplexId {
+    for(SimplexId k = 0; k < 3; ++k) {
+      SimplexId ek{};
+      triangulation_->getTriangleEdge(t, k, ek);
+      if(ek == e) {
+        return k;
+      }
+    }
+    return -1;
+  };
 
-  newT.preprocessVertexNeighbors();
-  newT.preprocessVertexEdges();
-  newT.preprocessVertexTriangles();
-  newT.preprocessEdgeTriangles();
-  newT.preprocessTriangleEdges();
+  // local index of a vertex in an edge, -1 if not found
+  auto edgeVertexIndex
+    = [&](const SimplexId e, const SimplexId v) -> SimplexId {
+    for(SimplexId l = 0; l < 2; ++l) {
+      SimplexId vl{};
+      triangulation_->getEdgeVertex(e, l, vl);
+      if(vl == v) {
+        return l;
+      }
+    }
+    return -1;
+  };
 
-  auto nEdges = triangulation_->getNumberOfEdges();
+  // local index of a vertex in a triangle, -1 if not found
+  auto triangleVertexIndex
+    = [&](const SimplexId t, const SimplexId v) -> SimplexId {
+    for(SimplexId j = 0; j < 3; ++j) {
+      SimplexId vj{};
+      triangulation_->getTriangleVertex(t, j, vj);
+      if(vj == v) {
+        return j;
+      }
+    }
+    return -1;
+  };
 
-  // store separatrix index on subdivised triangulation edges
-  std::vector<SimplexId> edgeOnSep(newT.getNumberOfEdges(), -1);
-  // count the number of critical points encountered
-  size_t critPoints{0};
-  if(sepMask_[0] == 0) {
-    critPoints++;
-  }
+  // sub-edge between two subdivision vertices, -1 if not adjacent
+  auto subEdge = [&](SimplexId a, SimplexId b) -> SimplexId {
+    if(a > b) {
+      std::swap(a, b);
+    }
+    const SimplexId edgesBeg = verticesNumber_;
+    const SimplexId trianglesBeg = verticesNumber_ + nEdges;
+    if(a < 0 || b >= trianglesBeg + nTriangles) {
+      return -1;
+    }
+    if(a < edgesBeg && b >= edgesBeg && b < trianglesBeg) {
+      const auto e = b - edgesBeg;
+      const auto l = edgeVertexIndex(e, a);
+      return l == -1 ? -1 : 2 * e + l;
+    }
+    if(a >= edgesBeg && a < trianglesBeg && b >= trianglesBeg) {
+      const auto t = b - trianglesBeg;
+      const auto k = triangleEdgeIndex(t, a - edgesBeg);
+      return k == -1 ? -1 : 2 * nEdges + 3 * t + k;
+    }
+    if(a < edgesBeg && b >= trianglesBeg) {
+      const auto t = b - trianglesBeg;
+      const auto j = triangleVertexIndex(t, a);
+      return j == -1 ? -1 : 2 * nEdges + 3 * nTriangles + 3 * t + j;
+    }
+    return -1;
+  };
+
+  // the three sub-edges of a sub-triangle
+  auto getTriangleEdges
+    = [&](const SimplexId tr, std::array<SimplexId, 3> &edges) {
+        const SimplexId t = tr / 6;
+        const SimplexId k = (tr % 6) / 2;
+        const SimplexId l = tr % 2;
+        SimplexId e{}, v{};
+        triangulation_->getTriangleEdge(t, k, e);
+        triangulation_->getEdgeVertex(e, l, v);
+        edges[0] = 2 * e + l;
+        edges[1] = 2 * nEdges + 3 * t + k;
+        edges[2] = 2 * nEdges + 3 * nTriangles + 3 * t
+                   + triangleVertexIndex(t, v);
+      };
+
+  // sub-triangles sharing the sub-edge number m of a sub-triangle
+  auto getTriangleNeighbors = [&](const SimplexId tr, const int m,
+                                  std::vector<SimplexId> &neighs) {
+    neighs.clear();
+    const SimplexId t = tr / 6;
+    const SimplexId k = (tr % 6) / 2;
+    const SimplexId l = tr % 2;
+    SimplexId e{}, v{};
+    triangulation_->getTriangleEdge(t, k, e);
+    triangulation_->getEdgeVertex(e, l, v);
+    if(m == 0) {
+      // across the edge middle - vertex sub-edge: other triangles of e
+      const auto ne = triangulation_->getEdgeTriangleNumber(e);
+      for(SimplexId i = 0; i < ne; ++i) {
+        SimplexId tn{};
+        triangulation_->getEdgeTriangle(e, i, tn);
+        if(tn != t) {
+          neighs.emplace_back(6 * tn + 2 * triangleEdgeIndex(tn, e) + l);
+        }
+      }
+    } else if(m == 1) {
+      // across the barycenter - edge middle sub-edge
+      neighs.emplace_back(6 * t + 2 * k + 1 - l);
+    } else {
+      // across the barycenter - vertex sub-edge: other edge of t around v
+      for(SimplexId kn = 0; kn < 3; ++kn) {
+        if(kn == k) {
+          continue;
+        }
+        SimplexId en{};
+        triangulation_->getTriangleEdge(t, kn, en);
+        const auto ln = edgeVertexIndex(en, v);
+        if(ln != -1) {
+          neighs.emplace_back(6 * t + 2 * kn + ln);
+          break;
+        }
+      }
+    }
+  };
 
-  // id of critical point in new triangulation
+  // id of critical point in the subdivision
   auto critPointId = [&](const SimplexId a) -> SimplexId {
     if(sepCellDims_[a] == 0) {
       return sepCellIds_[a];
@@ -58,78 +180,70 @@ int ttk::MorseSmaleQuadrangulation::detectCellSeps() {
     return -1;
   };
 
-  // init first vertex id
-  SimplexId prev{critPointId(0)};
-
-  // put separatrices indices onto edges
-  // begin loop at one to get the first edge
+  // separatrix id of every separatrix point (-1 for separatrix
+  // beginnings)
+  std::vector<SimplexId> pointSepId(separatriceNumber_, -1);
+  // count the number of critical points encountered
+  size_t critPoints{0};
+  if(sepMask_[0] == 0) {
+    critPoints++;
+  }
   for(SimplexId i = 1; i < separatriceNumber_; ++i) {
-
-    // for computing the separatrix id
     if(sepMask_[i] == 0) {
       critPoints++;
       // beginning of a new separatrix
       if(critPoints % 2 == 1) {
-        prev = critPointId(i);
         continue;
       }
     }
-
     // current separatrix id is critPoints // 2
-    auto currSepId
-      = (critPoints % 2 == 0) ? critPoints / 2 - 1 : critPoints / 2;
+    pointSepId[i] = (critPoints % 2 == 0) ? critPoints / 2 - 1 : critPoints / 2;
+  }
 
-    // current point
-    SimplexId curr{critPointId(i)};
+  // sub-edge between every separatrix point and the previous one
+  std::vector<SimplexId> pointEdge(separatriceNumber_, -1);
 
-    // get edge id
-    auto ne = newT.getVertexEdgeNumber(curr);
-    for(SimplexId j = 0; j < ne; ++j) {
-      SimplexId e{};
-      newT.getVertexEdge(curr, j, e);
-      SimplexId e0{}, e1{};
-      newT.getEdgeVertex(e, 0, e0);
-      newT.getEdgeVertex(e, 1, e1);
-
-      if((e0 == prev && e1 == curr) || (e1 == prev && e0 == curr)) {
-        edgeOnSep[e] = currSepId;
-        break;
-      }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
+  for(SimplexId i = 1; i < separatriceNumber_; ++i) {
+    if(pointSepId[i] != -1) {
+      pointEdge[i] = subEdge(critPointId(i - 1), critPointId(i));
     }
-
-    prev = curr;
   }
 
-  // store saddle points id in the subdivised triangulation
-  std::set<SimplexId> saddlesId{};
+  // store separatrix index on subdivised triangulation edges
+  std::vector<SimplexId> edgeOnSep(2 * nEdges + 6 * nTriangles, -1);
+  // input vertices on separatrices
+  std::vector<bool> vertOnSep(verticesNumber_, false);
 
-  for(SimplexId i = 0; i < criticalPointsNumber_; ++i) {
-    // keep only saddle points
-    if(criticalPointsType_[i] != 1) {
+  // in separatrices order (the last separatrix passing through an edge
+  // holds it)
+  for(SimplexId i = 1; i < separatriceNumber_; ++i) {
+    if(pointEdge[i] == -1) {
       continue;
     }
-    saddlesId.emplace(verticesNumber_ + criticalPointsCellIds_[i]);
+    edgeOnSep[pointEdge[i]] = pointSepId[i];
+    for(const auto v : {critPointId(i - 1), critPointId(i)}) {
+      if(v < verticesNumber_) {
+        vertOnSep[v] = true;
+      }
+    }
   }
 
-  auto getTriangleEdges
-    = [&](const SimplexId tr, SimplexId &e0, SimplexId &e1, SimplexId &e2) {
-        newT.getTriangleEdge(tr, 0, e0);
-        newT.getTriangleEdge(tr, 1, e1);
-        newT.getTriangleEdge(tr, 2, e2);
-      };
-
   // get the indices of the two separatrices around a triangle
   // (having a saddle point as vertex)
   auto sepIdAroundTriangle = [&](const SimplexId tr) {
-    SimplexId e0{}, e1{}, e2{};
-    getTriangleEdges(tr, e0, e1, e2);
+    std::array<SimplexId, 3> edges{};
+    getTriangleEdges(tr, edges);
+    const auto e0 = edges[0], e1 = edges[1], e2 = edges[2];
 
     std::set<SimplexId> sepId{};
     if(edgeOnSep[e0] != -1 && edgeOnSep[e1] != -1) {
       sepId.emplace(edgeOnSep[e0]);
       sepId.emplace(edgeOnSep[e1]);
     } else if(edgeOnSep[e1] != -1 && edgeOnSep[e2] != -1) {
-      sepId.emplace(edgeOnSep[e0]);
+      sepId.emplace(edgeOnSep[e1]);
       sepId.emplace(edgeOnSep[e2]);
     } else if(edgeOnSep[e0] != -1 && edgeOnSep[e2] != -1) {
       sepId.emplace(edgeOnSep[e0]);
@@ -138,152 +252,134 @@ int ttk::MorseSmaleQuadrangulation::detectCellSeps() {
     return sepId;
   };
 
-  auto hasTriangleSaddle = [&](const SimplexId tr) {
-    SimplexId a, b, c;
-    newT.getTriangleVertex(tr, 0, a);
-    newT.getTriangleVertex(tr, 1, b);
-    newT.getTriangleVertex(tr, 2, c);
-    return (saddlesId.find(a) != saddlesId.end()
-            || saddlesId.find(b) != saddlesId.end()
-            || saddlesId.find(c) != saddlesId.end());
-  };
-
-  // propagate from triangles around saddle
-  std::vector<SimplexId> processed(newT.getNumberOfTriangles(), -1);
-
-  // store the saddles id
-  std::vector<SimplexId> saddles{};
+  // triangles around saddle points (the BFS seeds)
+  std::vector<SimplexId> seeds{};
 
   for(SimplexId i = 0; i < criticalPointsNumber_; ++i) {
     // keep only saddle points
-    if(criticalPointsType_[i] == 1) {
-      saddles.emplace_back(verticesNumber_ + criticalPointsCellIds_[i]);
+    if(criticalPointsType_[i] != 1) {
+      continue;
     }
-  }
-
-  // look around the saddle points
-  for(size_t i = 0; i < saddles.size(); ++i) {
-    SimplexId saddle = saddles[i];
-
-    auto sadtri = newT.getVertexTriangleNumber(saddle);
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif // TTK_ENABLE_OPENMP
+    const auto saddle = criticalPointsCellIds_[i];
+    const auto sadtri = triangulation_->getEdgeTriangleNumber(saddle);
     for(SimplexId j = 0; j < sadtri; ++j) {
-      std::queue<SimplexId> toProcess{};
-      SimplexId tr;
-      newT.getVertexTriangle(saddle, j, tr);
-
-      std::set<SimplexId> sepIdBeg = sepIdAroundTriangle(tr);
-      // current iteration id
-      SimplexId iter = i * sadtri + j;
-
-      toProcess.push(tr);
+      SimplexId t{};
+      triangulation_->getEdgeTriangle(saddle, j, t);
+      const auto k = triangleEdgeIndex(t, saddle);
+      seeds.emplace_back(6 * t + 2 * k);
+      seeds.emplace_back(6 * t + 2 * k + 1);
+    }
+  }
 
-      while(!toProcess.empty()) {
-        auto curr = toProcess.front();
-        toProcess.pop();
+  // propagate from triangles around saddle: every triangle gets the
+  // index of the first seed reaching it, without crossing separatrices
+  std::vector<SimplexId> processed(6 * nTriangles, -1);
+  std::queue<SimplexId> toProcess{};
+  std::vector<SimplexId> neighs{};
 
-        // mark current triangle, skip already processed
-#ifdef TTK_ENABLE_OPENMP
-        if(processed[curr] == -1 || processed[curr] > iter) {
-#pragma omp atomic write
-          processed[curr] = iter;
-        }
-        // skip if curr marked by thread
-        else if(processed[curr] == iter) {
+  for(size_t i = 0; i < seeds.size(); ++i) {
+    // seed already reached from a previous one
+    if(processed[seeds[i]] != -1) {
+      continue;
+    }
+    processed[seeds[i]] = i;
+    toProcess.push(seeds[i]);
+
+    while(!toProcess.empty()) {
+      const auto curr = toProcess.front();
+      toProcess.pop();
+
+      // look for neighboring triangles
+      std::array<SimplexId, 3> edges{};
+      getTriangleEdges(curr, edges);
+      for(int m = 0; m < 3; ++m) {
+        // do not cross separatrices
+        if(edgeOnSep[edges[m]] != -1) {
           continue;
         }
-        // stop BFS if thread with higher iteration id has reached curr
-        else if(processed[curr] < iter) {
-          break;
-        }
-#else
-        if(processed[curr] != -1) {
-          continue;
+        getTriangleNeighbors(curr, m, neighs);
+        for(const auto neigh : neighs) {
+          // push only non processed triangles
+          if(processed[neigh] == -1) {
+            processed[neigh] = i;
+            toProcess.push(neigh);
+          }
         }
-        processed[curr] = 0;
-#endif // TTK_ENABLE_OPENMP
-
-        // check for saddle at vertices
-        bool hasSaddle = hasTriangleSaddle(curr);
+      }
+    }
+  }
 
-        // check for separatrices on edges
-        auto sepIdEnd = sepIdAroundTriangle(curr);
+  // per-thread cells (id, separatrices)
+  std::vector<std::vector<std::pair<SimplexId, std::vector<size_t>>>>
+    threadCells(threadNumber_);
 
-        if(hasSaddle && sepIdEnd.size() == 2) {
-          // check that seps are different from beginning
-          std::vector<size_t> cellSeps{};
-          std::set_union(sepIdBeg.begin(), sepIdBeg.end(), sepIdEnd.begin(),
-                         sepIdEnd.end(), std::back_inserter(cellSeps));
-          if(cellSeps.size() > 2) {
-            // found it
+  // the triangles having a saddle point as vertex are the seeds
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp critical
+#pragma omp parallel num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-            {
-              // keep indices in sync
-              quadSeps_.emplace_back(cellSeps);
-              cellId_.emplace_back(iter);
-            }
-          }
-        }
+  {
+    int threadId = 0;
+#ifdef TTK_ENABLE_OPENMP
+    threadId = omp_get_thread_num();
+#endif // TTK_ENABLE_OPENMP
+    auto &cells = threadCells[threadId];
 
-        // mark vertices from the original mesh with cell id
-        for(SimplexId k = 0; k < 3; ++k) {
-          SimplexId vert{};
-          newT.getTriangleVertex(curr, k, vert);
-          if(vert >= verticesNumber_) {
-            continue;
-          }
-          bool vertOnSep = false;
-          for(SimplexId l = 0; l < newT.getVertexEdgeNumber(vert); ++l) {
-            SimplexId e{};
-            newT.getVertexEdge(vert, l, e);
-            if(edgeOnSep[e] != -1) {
-              vertOnSep = true;
-              break;
-            }
-          }
-          if(!vertOnSep) {
+    // static schedule: seeds are dispatched by contiguous chunks in
+    // thread order
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp atomic write
+#pragma omp for schedule(static)
 #endif // TTK_ENABLE_OPENMP
-            morseSeg_[vert] = iter;
-          }
-        }
+    for(size_t i = 0; i < seeds.size(); ++i) {
+      // check for separatrices on edges
+      const auto sepIdEnd = sepIdAroundTriangle(seeds[i]);
+      if(sepIdEnd.size() != 2) {
+        continue;
+      }
+      // cell id: seed from which this triangle has been reached
+      const auto iter = processed[seeds[i]];
+      const auto sepIdBeg = sepIdAroundTriangle(seeds[iter]);
+      // check that seps are different from beginning
+      std::vector<size_t> cellSeps{};
+      std::set_union(sepIdBeg.begin(), sepIdBeg.end(), sepIdEnd.begin(),
+                     sepIdEnd.end(), std::back_inserter(cellSeps));
+      if(cellSeps.size() > 2) {
+        // found it
+        cells.emplace_back(iter, std::move(cellSeps));
+      }
+    }
+  }
 
-        // look for neighboring triangles
-        std::array<SimplexId, 3> edges{};
-        getTriangleEdges(curr, edges[0], edges[1], edges[2]);
-        for(const auto e : edges) {
-          // do not cross separatrices
-          if(edgeOnSep[e] != -1) {
-            continue;
-          }
-          for(SimplexId k = 0; k < newT.getEdgeTriangleNumber(e); ++k) {
-            SimplexId neigh{};
-            newT.getEdgeTriangle(e, k, neigh);
-            // push only non processed triangles
-            if(processed[neigh] == -1) {
-              toProcess.push(neigh);
-            }
+  // merge in seeds order, keep indices in sync
+  for(auto &cells : threadCells) {
+    for(auto &c : cells) {
+      quadSeps_.emplace_back(std::move(c.second));
+      cellId_.emplace_back(c.first);
+    }
+  }
+
+  // mark vertices from the original mesh with cell id
 #ifdef TTK_ENABLE_OPENMP
-            // push if neigh marked during a previous iteration
-            else if(processed[neigh] > iter) {
-              toProcess.push(neigh);
-            }
-            // stop pushing neighbors if curr marked in a newer iteration
-            else if(processed[neigh] < iter) {
-              break;
-            }
+#pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-          }
-        }
+  for(SimplexId i = 0; i < verticesNumber_; ++i) {
+    if(vertOnSep[i] || triangulation_->getVertexTriangleNumber(i) == 0) {
+      continue;
+    }
+    // the sub-triangles around a vertex out of the separatrices belong
+    // to the same cell
+    SimplexId t{};
+    triangulation_->getVertexTriangle(i, 0, t);
+    for(SimplexId k = 0; k < 3; ++k) {
+      SimplexId e{};
+      triangulation_->getTriangleEdge(t, k, e);
+      const auto l = edgeVertexIndex(e, i);
+      if(l != -1) {
+        morseSeg_[i] = processed[6 * t + 2 * k + l];
+        break;
       }
     }
   }
+
   return 0;
 }
 
@@ -466,6 +562,27 @@ int ttk::MorseSmaleQuadrangulation::subdiviseDegenerateQuads(
   auto quads = reinterpret_cast<std::vector<Quad> *>(&outputCells_);
   auto qsubd = reinterpret_cast<std::vector<Quad> *>(&outputSubd);
 
+  // reused by every (local) Dijkstra query
+  std::array<Dijkstra::Workspace<float>, 6> workspaces{};
+
+  auto inf = std::numeric_limits<float>::infinity();
+
+  // vertex minimizing cost among those reached by the search in
+  // workspace (0 if none, as for the whole mesh)
+  auto minimize = [&](const Dijkstra::Workspace<float> &workspace,
+                      const std::function<float(const SimplexId)> &cost) {
+    SimplexId res{};
+    float minCost = inf;
+    for(const auto j : workspace.getReachedVertices()) {
+      const auto c = cost(j);
+      if(c < minCost || (c == minCost && j < res)) {
+        minCost = c;
+        res = j;
+      }
+    }
+    return res;
+  };
+
   for(size_t i = 0; i < quads->size(); ++i) {
     auto q = quads->at(i);
     auto seps = quadSeps_[i];
@@ -509,25 +626,11 @@ int ttk::MorseSmaleQuadrangulation::subdiviseDegenerateQuads(
 
     std::vector<SimplexId> boundi{criticalPointsIdentifier_[q.i]};
     std::vector<SimplexId> boundk{criticalPointsIdentifier_[q.k]};
-    std::array<std::vector<float>, 6> outputDists{};
 
     Dijkstra::shortestPath(
-      criticalPointsIdentifier_[q.i], *triangulation_, outputDists[0], boundk);
+      criticalPointsIdentifier_[q.i], *triangulation_, workspaces[0], boundk);
     Dijkstra::shortestPath(
-      criticalPointsIdentifier_[q.k], *triangulation_, outputDists[1], boundi);
-
-    auto inf = std::numeric_limits<float>::infinity();
-    std::vector<float> sum(outputDists[0].size(), inf);
-
-    for(size_t j = 0; j < sum.size(); ++j) {
-      auto m = outputDists[0][j];
-      auto n = outputDists[1][j];
-      if(m == inf || n == inf) {
-        continue;
-      }
-      // cost to minimize
-      sum[j] = m + n + std::abs(m - n);
-    }
+      criticalPointsIdentifier_[q.k], *triangulation_, workspaces[1], boundi);
 
     auto insertNewPoint
       = [&](const SimplexId a, const size_t idx, const SimplexId type) {
@@ -542,7 +645,15 @@ int ttk::MorseSmaleQuadrangulation::subdiviseDegenerateQuads(
           return outputPointsIds_.size() - 1;
         };
 
-    auto v0 = std::min_element(sum.begin(), sum.end()) - sum.begin();
+    auto v0 = minimize(workspaces[0], [&](const SimplexId j) {
+      auto m = workspaces[0].getDistance(j);
+      auto n = workspaces[1].getDistance(j);
+      if(m == inf || n == inf) {
+        return inf;
+      }
+      // cost to minimize
+      return m + n + std::abs(m - n);
+    });
     auto v0Pos = static_cast<long long>(insertNewPoint(v0, i, 3));
 
     // find two other points
@@ -557,40 +668,28 @@ int ttk::MorseSmaleQuadrangulation::subdiviseDegenerateQuads(
     auto m1 = outputPointsIds_[m1Pos];
 
     Dijkstra::shortestPath(criticalPointsIdentifier_[vert1Sep], *triangulation_,
-                           outputDists[2], bounds);
-    Dijkstra::shortestPath(v0, *triangulation_, outputDists[3], bounds);
-    Dijkstra::shortestPath(m0, *triangulation_, outputDists[4], bounds);
-    Dijkstra::shortestPath(m1, *triangulation_, outputDists[5], bounds);
-
-    std::fill(sum.begin(), sum.end(), inf);
-
-    for(size_t j = 0; j < sum.size(); ++j) {
-      auto m = outputDists[2][j];
-      auto n = outputDists[3][j];
-      auto o = outputDists[4][j];
+                           workspaces[2], bounds);
+    Dijkstra::shortestPath(v0, *triangulation_, workspaces[3], bounds);
+    Dijkstra::shortestPath(m0, *triangulation_, workspaces[4], bounds);
+    Dijkstra::shortestPath(m1, *triangulation_, workspaces[5], bounds);
+
+    auto cost = [&](const SimplexId j, const size_t k) {
+      auto m = workspaces[2].getDistance(j);
+      auto n = workspaces[3].getDistance(j);
+      auto o = workspaces[k].getDistance(j);
       if(m == inf || n == inf || o == inf) {
-        continue;
+        return inf;
       }
       // cost to minimize
-      sum[j] = m + n + o + std::abs(m - n) + std::abs(m - o) + std::abs(n - o);
-    }
+      return m + n + o + std::abs(m - n) + std::abs(m - o) + std::abs(n - o);
+    };
 
-    auto v1 = std::min_element(sum.begin(), sum.end()) - sum.begin();
+    auto v1 = minimize(
+      workspaces[2], [&](const SimplexId j) { return cost(j, 4); });
     auto v1Pos = static_cast<long long>(insertNewPoint(v1, i, 4));
-    std::fill(sum.begin(), sum.end(), inf);
-
-    for(size_t j = 0; j < sum.size(); ++j) {
-      auto m = outputDists[2][j];
-      auto n = outputDists[3][j];
-      auto o = outputDists[5][j];
-      if(m == inf || n == inf || o == inf) {
-        continue;
-      }
-      // cost to minimize
-      sum[j] = m + n + o + std::abs(m - n) + std::abs(m - o) + std::abs(n - o);
-    }
 
-    auto v2 = std::min_element(sum.begin(), sum.end()) - sum.begin();
+    auto v2 = minimize(
+      workspaces[2], [&](const SimplexId j) { return cost(j, 5); });
     auto v2Pos = static_cast<long long>(insertNewPoint(v2, i, 4));
 
     qsubd->emplace_back(Quad{4, vert2Seps, m0Pos, v1Pos, v0Pos});
@@ -617,7 +716,8 @@ int ttk::MorseSmaleQuadrangulation::subdivise() {
   // for each output quad, its barycenter position in outputPoints_
   std::vector<size_t> cellBary(outputCells_.size());
 
-  std::array<std::vector<float>, 4> outputDists{};
+  // reused by every (local) Dijkstra query
+  std::array<Dijkstra::Workspace<float>, 4> workspaces{};
 
   // hold quad subdivision
   decltype(outputCells_) outputSubd{};
@@ -673,13 +773,13 @@ int ttk::MorseSmaleQuadrangulation::subdivise() {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-    for(size_t j = 0; j < outputDists.size(); ++j) {
+    for(size_t j = 0; j < workspaces.size(); ++j) {
       Dijkstra::shortestPath(midsNearestVertex[j], *triangulation_,
-                             outputDists.at(j), std::vector<SimplexId>(), mask);
+                             workspaces[j], std::vector<SimplexId>(), mask);
     }
 
     auto inf = std::numeric_limits<float>::infinity();
-    std::vector<float> sum(outputDists[0].size(), inf);
+    std::vector<float> sum(workspaces[0].getVertexNumber(), inf);
 
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
@@ -689,10 +789,10 @@ int ttk::MorseSmaleQuadrangulation::subdivise() {
       if(morseSeg_[j] != cellId_[i]) {
         continue;
       }
-      auto m = outputDists[0][j];
-      auto n = outputDists[1][j];
-      auto o = outputDists[2][j];
-      auto p = outputDists[3][j];
+      auto m = workspaces[0].getDistance(j);
+      auto n = workspaces[1].getDistance(j);
+      auto o = workspaces[2].getDistance(j);
+      auto p = workspaces[3].getDistance(j);
       if(m == inf || n == inf || o == inf || p == inf) {
         continue;
       }
@@ -63,6 +63,11 @@ namespace ttk {
         triangulation_->preprocessVertexNeighbors();
         triangulation_->preprocessVertexTriangles();
         triangulation_->preprocessBoundaryVertices();
+        // implicit barycentric subdivision in detectCellSeps()
+        triangulation_->preprocessEdges();
+        triangulation_->preprocessTriangles();
+        triangulation_->preprocessTriangleEdges();
+        triangulation_->preprocessEdgeTriangles();
       }
       verticesNumber_ = triangulation_->getNumberOfVertices();
     }
@@ -129,7 +134,9 @@ namespace ttk {
      *
      * Perform a breadth-first search from saddle points on a
      * barycentric subdivision of the triangulation to detect the four
-     * separatrices around the current cell
+     * separatrices around the current cell. The subdivision is not
+     * built: its simplices are indexed from the input triangulation
+     * relations.
      *
      * @return 0
      */
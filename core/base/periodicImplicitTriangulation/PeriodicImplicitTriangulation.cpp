@@ -329,6 +329,9 @@ const vector<vector<SimplexId>> *
   if(!vertexNeighborList_.size()) {
     Timer t;
     vertexNeighborList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexNeighborList_[i].resize(getVertexNeighborNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexNeighborList_[i].size(); ++j)
@@ -338,7 +341,8 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Vertex neighbors built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -414,6 +418,9 @@ const vector<vector<SimplexId>> *
     Timer t;
 
     vertexEdgeList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexEdgeList_[i].resize(getVertexEdgeNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexEdgeList_[i].size(); ++j)
@@ -423,7 +430,8 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Vertex edges built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -471,6 +479,9 @@ const vector<vector<SimplexId>> *
     Timer t;
 
     vertexTriangleList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexTriangleList_[i].resize(getVertexTriangleNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexTriangleList_[i].size(); ++j)
@@ -480,7 +491,8 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Vertex triangles built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -522,6 +534,9 @@ const vector<vector<SimplexId>> *
     Timer t;
 
     vertexLinkList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexLinkList_[i].resize(getVertexLinkNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexLinkList_[i].size(); ++j)
@@ -531,7 +546,8 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Vertex links built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -583,6 +599,9 @@ const vector<vector<SimplexId>> *
   if(!vertexStarList_.size()) {
     Timer t;
     vertexStarList_.resize(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < vertexNumber_; ++i) {
       vertexStarList_[i].resize(getVertexStarNumber(i));
       for(SimplexId j = 0; j < (SimplexId)vertexStarList_[i].size(); ++j)
@@ -592,7 +611,8 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Vertex stars built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -927,6 +947,9 @@ const vector<pair<SimplexId, SimplexId>> *
     Timer t;
 
     edgeList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       SimplexId id0, id1;
       getEdgeVertex(i, 0, id0);
@@ -939,7 +962,7 @@ const vector<pair<SimplexId, SimplexId>> *
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Edge-list built in "
           << t.getElapsedTime() << " s. (" << edgeList_.size() << " edges, ("
-          << 1 << " thread(s))" << endl;
+          << threadNumber_ << " thread(s))" << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1067,6 +1090,9 @@ const vector<vector<SimplexId>> *
     Timer t;
 
     edgeTriangleList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       edgeTriangleList_[i].resize(getEdgeTriangleNumber(i));
       for(SimplexId j = 0; j < (SimplexId)edgeTriangleList_[i].size(); ++j)
@@ -1076,7 +1102,8 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Triangle edges built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1152,6 +1179,9 @@ const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getEdgeLinks() {
     Timer t;
 
     edgeLinkList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       edgeLinkList_[i].resize(getEdgeLinkNumber(i));
       for(SimplexId j = 0; j < (SimplexId)edgeLinkList_[i].size(); ++j)
@@ -1161,7 +1191,8 @@ const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getEdgeLinks() {
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] List of edge links built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1275,6 +1306,9 @@ const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getEdgeStars() {
     Timer t;
 
     edgeStarList_.resize(edgeNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < edgeNumber_; ++i) {
       edgeStarList_[i].resize(getEdgeStarNumber(i));
       for(SimplexId j = 0; j < (SimplexId)edgeStarList_[i].size(); ++j)
@@ -1284,7 +1318,8 @@ const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getEdgeStars() {
     {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] List of edge stars built in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1511,6 +1546,9 @@ int PeriodicImplicitTriangulation::getTriangleEdge(const SimplexId &triangleId,
 int PeriodicImplicitTriangulation::getTriangleEdges(
   vector<vector<SimplexId>> &edges) const {
   edges.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < triangleNumber_; ++i) {
     edges[i].resize(3);
     for(int j = 0; j < 3; ++j)
@@ -1530,7 +1568,8 @@ const vector<vector<SimplexId>> *
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Triangle edges ("
           << triangleNumber_ << " triangle(s), " << edgeNumber_
-          << " edge(s)) computed in " << t.getElapsedTime() << " s. (" << 1
+          << " edge(s)) computed in " << t.getElapsedTime() << " s. ("
+          << threadNumber_
           << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
@@ -1544,6 +1583,9 @@ const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getTriangles() {
     Timer t;
 
     triangleList_.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < triangleNumber_; ++i) {
       triangleList_[i].resize(3);
       for(int j = 0; j < 3; ++j)
@@ -1554,7 +1596,7 @@ const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getTriangles() {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Triangle list ("
           << triangleNumber_ << " triangles) computed in " << t.getElapsedTime()
-          << " s. (" << 1 << " thread(s))." << endl;
+          << " s. (" << threadNumber_ << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1621,6 +1663,9 @@ const vector<vector<SimplexId>> *
     Timer t;
 
     triangleLinkList_.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < triangleNumber_; ++i) {
       triangleLinkList_[i].resize(getTriangleLinkNumber(i));
       for(SimplexId j = 0; j < (SimplexId)triangleLinkList_[i].size(); ++j)
@@ -1630,7 +1675,7 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[TriangulationVTI] Triangle links built in " << t.getElapsedTime()
-          << " s. (" << 1 << " thread(s))." << endl;
+          << " s. (" << threadNumber_ << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1702,6 +1747,9 @@ const vector<vector<SimplexId>> *
     Timer t;
 
     triangleStarList_.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
     for(SimplexId i = 0; i < triangleNumber_; ++i) {
       triangleStarList_[i].resize(getTriangleStarNumber(i));
       for(SimplexId j = 0; j < (SimplexId)triangleStarList_[i].size(); ++j)
@@ -1711,7 +1759,7 @@ const vector<vector<SimplexId>> *
     {
       stringstream msg;
       msg << "[TriangulationVTI] Triangle stars built in " << t.getElapsedTime()
-          << " s. (" << 1 << " thread(s))." << endl;
+          << " s. (" << threadNumber_ << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -1858,6 +1906,9 @@ int PeriodicImplicitTriangulation::getTriangleNeighbor(
 int PeriodicImplicitTriangulation::getTriangleNeighbors(
   vector<vector<SimplexId>> &neighbors) {
   neighbors.resize(triangleNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < triangleNumber_; ++i) {
     neighbors[i].resize(getTriangleNeighborNumber(i));
     for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
@@ -1951,6 +2002,9 @@ int PeriodicImplicitTriangulation::getTetrahedronEdge(const SimplexId &tetId,
 int PeriodicImplicitTriangulation::getTetrahedronEdges(
   vector<vector<SimplexId>> &edges) const {
   edges.resize(tetrahedronNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
     edges[i].resize(6);
     for(int j = 0; j < 6; ++j)
@@ -2006,6 +2060,9 @@ int PeriodicImplicitTriangulation::getTetrahedronTriangle(
 int PeriodicImplicitTriangulation::getTetrahedronTriangles(
   vector<vector<SimplexId>> &triangles) const {
   triangles.resize(tetrahedronNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
     triangles[i].resize(4);
     for(int j = 0; j < 4; ++j)
@@ -2074,6 +2131,9 @@ int PeriodicImplicitTriangulation::getTetrahedronNeighbor(
 int PeriodicImplicitTriangulation::getTetrahedronNeighbors(
   vector<vector<SimplexId>> &neighbors) {
   neighbors.resize(tetrahedronNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif // TTK_ENABLE_OPENMP
   for(SimplexId i = 0; i < tetrahedronNumber_; ++i) {
     neighbors[i].resize(getTetrahedronNeighborNumber(i));
     for(SimplexId j = 0; j < (SimplexId)neighbors[i].size(); ++j)
@@ -2135,7 +2195,8 @@ const vector<vector<SimplexId>> *PeriodicImplicitTriangulation::getCellEdges() {
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Cell edges ("
           << getNumberOfCells() << " cell(s), " << edgeNumber_
-          << "edge(s)) computed in " << t.getElapsedTime() << " s. (" << 1
+          << "edge(s)) computed in " << t.getElapsedTime() << " s. ("
+          << threadNumber_
           << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
@@ -2166,7 +2227,8 @@ const vector<vector<SimplexId>> *
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Cell triangles (" << cellNumber_
           << " cell(s), " << triangleNumber_ << "edge(s)) computed in "
-          << t.getElapsedTime() << " s. (" << 1 << " thread(s))." << endl;
+          << t.getElapsedTime() << " s. (" << threadNumber_ << " thread(s))."
+          << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -2233,7 +2295,7 @@ const vector<vector<SimplexId>> *
       stringstream msg;
       msg << "[PeriodicImplicitTriangulation] Cell neighbors ("
           << getNumberOfCells() << " cells) computed in " << t.getElapsedTime()
-          << " s. (" << 1 << " thread(s))." << endl;
+          << " s. (" << threadNumber_ << " thread(s))." << endl;
       dMsg(cout, msg.str(), timeMsg);
     }
   }
@@ -8,7 +8,8 @@ using namespace ftm;
 PersistenceDiagram::PersistenceDiagram()
   : ComputeSaddleConnectors{},
 
-    triangulation_{}, inputScalars_{}, CTDiagram_{} {
+    triangulation_{}, inputScalars_{}, CTDiagram_{},
+    fieldParallelismThreshold_{1000000} {
 }
 
 PersistenceDiagram::~PersistenceDiagram() {
@@ -83,6 +83,23 @@ namespace ttk {
     template <class scalarType, typename idType>
     int execute() const;
 
+    /// Compute the persistence diagrams of a batch of scalar fields defined
+    /// on the same triangulation (for instance the components of a
+    /// multi-component array). The contour tree structures are re-used from
+    /// one field to the next. Small meshes (or batches with at least as many
+    /// fields as threads) are processed with one field per thread, large
+    /// meshes one field at a time with all the threads.
+    /// \param scalars Pointers to the scalar values of each field.
+    /// \param offsets Pointers to the vertex offsets, either one shared by
+    /// all the fields or one per field.
+    /// \param diagrams Pointers to the output diagram of each field (same
+    /// type as the one passed to setOutputCTDiagram()).
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class scalarType, typename idType>
+    int executeBatch(const std::vector<void *> &scalars,
+                     const std::vector<void *> &offsets,
+                     const std::vector<void *> &diagrams) const;
+
     inline int
       setDMTPairs(std::vector<std::tuple<dcg::Cell, dcg::Cell>> *data) {
       dmt_pairs = data;
@@ -115,7 +132,24 @@ namespace ttk {
       return 0;
     }
 
+    /// Set the number of vertices below which the fields of a batch are
+    /// distributed among the threads (one field per thread).
+    inline int setFieldParallelismThreshold(const SimplexId threshold) {
+      fieldParallelismThreshold_ = threshold;
+      return 0;
+    }
+
   protected:
+    template <class scalarType, typename idType>
+    int computeDiagram(ftm::FTMTreePP &contourTree,
+                       MorseSmaleComplex3D &morseSmaleComplex,
+                       std::vector<SimplexId> &voffsets,
+                       void *inputScalars,
+                       void *inputOffsets,
+                       void *outputDiagram,
+                       const int threadNumber,
+                       const int debugLevel) const;
+
     std::vector<std::tuple<dcg::Cell, dcg::Cell>> *dmt_pairs;
 
     bool ComputeSaddleConnectors;
@@ -124,6 +158,7 @@ namespace ttk {
     void *inputScalars_;
     void *inputOffsets_;
     void *CTDiagram_;
+    SimplexId fieldParallelismThreshold_;
   };
 } // namespace ttk
 
@@ -208,29 +243,128 @@ int ttk::PersistenceDiagram::computeCTPersistenceDiagram(
 template <typename scalarType, typename idType>
 int ttk::PersistenceDiagram::execute() const {
 
+  ftm::FTMTreePP contourTree;
+  contourTree.setupTriangulation(triangulation_, false);
+  MorseSmaleComplex3D morseSmaleComplex;
+  if(triangulation_->getDimensionality() == 3 and ComputeSaddleConnectors)
+    morseSmaleComplex.setupTriangulation(triangulation_);
+  std::vector<ttk::SimplexId> voffsets;
+
+  return computeDiagram<scalarType, idType>(
+    contourTree, morseSmaleComplex, voffsets, inputScalars_, inputOffsets_,
+    CTDiagram_, threadNumber_, debugLevel_);
+}
+
+template <typename scalarType, typename idType>
+int ttk::PersistenceDiagram::executeBatch(
+  const std::vector<void *> &scalars,
+  const std::vector<void *> &offsets,
+  const std::vector<void *> &diagrams) const {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!triangulation_)
+    return -1;
+  if(offsets.size() != 1 && offsets.size() != scalars.size())
+    return -2;
+  if(diagrams.size() != scalars.size())
+    return -3;
+#endif
+
+  Timer t;
+
+  const SimplexId fieldNumber = scalars.size();
+  const bool fieldParallelism
+    = (threadNumber_ > 1) && (fieldNumber > 1)
+      && ((fieldNumber >= threadNumber_)
+          || (triangulation_->getNumberOfVertices()
+              < fieldParallelismThreshold_));
+  const int workerThreadNumber = fieldParallelism ? 1 : threadNumber_;
+  const int workerDebugLevel
+    = fieldParallelism ? std::min(debugLevel_, (int)timeMsg) : debugLevel_;
+
+  const int workerNumber
+    = fieldParallelism ? std::min<SimplexId>(threadNumber_, fieldNumber) : 1;
+
+  // the saddle connectors lazily build triangulation structures: the
+  // Morse-Smale complexes of the workers are set up sequentially, so that
+  // the workers only read the triangulation
+  std::vector<MorseSmaleComplex3D> morseSmaleComplexes(workerNumber);
+  if(triangulation_->getDimensionality() == 3 and ComputeSaddleConnectors) {
+    for(auto &morseSmaleComplex : morseSmaleComplexes)
+      morseSmaleComplex.setupTriangulation(triangulation_);
+  }
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(workerNumber)
+#endif
+  {
+    // one contour tree per worker, re-used for all its fields
+    ftm::FTMTreePP contourTree;
+    contourTree.setupTriangulation(triangulation_, false);
+    std::vector<ttk::SimplexId> voffsets;
+#ifdef TTK_ENABLE_OPENMP
+    MorseSmaleComplex3D &morseSmaleComplex
+      = morseSmaleComplexes[omp_get_thread_num()];
+#else
+    MorseSmaleComplex3D &morseSmaleComplex = morseSmaleComplexes[0];
+#endif
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+    for(SimplexId i = 0; i < fieldNumber; i++) {
+      computeDiagram<scalarType, idType>(
+        contourTree, morseSmaleComplex, voffsets, scalars[i],
+        offsets[offsets.size() == 1 ? 0 : i], diagrams[i], workerThreadNumber,
+        workerDebugLevel);
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[PersistenceDiagram] Batch of " << fieldNumber
+        << " field(s) processed in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " thread(s), "
+        << (fieldParallelism ? "field" : "vertex") << "-level parallelism)."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
+template <typename scalarType, typename idType>
+int ttk::PersistenceDiagram::computeDiagram(
+  ftm::FTMTreePP &contourTree,
+  MorseSmaleComplex3D &morseSmaleComplex,
+  std::vector<SimplexId> &voffsets,
+  void *inputScalars,
+  void *inputOffsets,
+  void *outputDiagram,
+  const int threadNumber,
+  const int debugLevel) const {
+
   // get data
   std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
                          ttk::CriticalType, scalarType, ttk::SimplexId>>
     &CTDiagram = *static_cast<
       std::vector<std::tuple<ttk::SimplexId, ttk::CriticalType, ttk::SimplexId,
                              ttk::CriticalType, scalarType, ttk::SimplexId>> *>(
-      CTDiagram_);
-  scalarType *scalars = static_cast<scalarType *>(inputScalars_);
-  SimplexId *offsets = static_cast<SimplexId *>(inputOffsets_);
+      outputDiagram);
+  scalarType *scalars = static_cast<scalarType *>(inputScalars);
+  SimplexId *offsets = static_cast<SimplexId *>(inputOffsets);
 
   const ttk::SimplexId numberOfVertices = triangulation_->getNumberOfVertices();
   // convert offsets into a valid format for contour forests
-  std::vector<ttk::SimplexId> voffsets(numberOfVertices);
+  voffsets.resize(numberOfVertices);
   std::copy(offsets, offsets + numberOfVertices, voffsets.begin());
 
   // get contour tree
-  ftm::FTMTreePP contourTree;
-  contourTree.setupTriangulation(triangulation_, false);
-  contourTree.setVertexScalars(inputScalars_);
+  contourTree.setVertexScalars(inputScalars);
   contourTree.setTreeType(ftm::TreeType::Join_Split);
   contourTree.setVertexSoSoffsets(voffsets.data());
-  contourTree.setThreadNumber(threadNumber_);
-  contourTree.setDebugLevel(debugLevel_);
+  contourTree.setThreadNumber(threadNumber);
+  contourTree.setDebugLevel(debugLevel);
   contourTree.setSegmentation(false);
   contourTree.build<scalarType, idType>();
 
@@ -274,12 +408,11 @@ int ttk::PersistenceDiagram::execute() const {
     pl_saddleSaddlePairs;
   const int dimensionality = triangulation_->getDimensionality();
   if(dimensionality == 3 and ComputeSaddleConnectors) {
-    MorseSmaleComplex3D morseSmaleComplex;
-    morseSmaleComplex.setDebugLevel(debugLevel_);
-    morseSmaleComplex.setThreadNumber(threadNumber_);
-    morseSmaleComplex.setupTriangulation(triangulation_);
-    morseSmaleComplex.setInputScalarField(inputScalars_);
-    morseSmaleComplex.setInputOffsets(inputOffsets_);
+    // the triangulation is set up by the caller
+    morseSmaleComplex.setDebugLevel(debugLevel);
+    morseSmaleComplex.setThreadNumber(threadNumber);
+    morseSmaleComplex.setInputScalarField(inputScalars);
+    morseSmaleComplex.setInputOffsets(inputOffsets);
     morseSmaleComplex.computePersistencePairs<scalarType, idType>(
       JTPairs, STPairs, pl_saddleSaddlePairs);
   }
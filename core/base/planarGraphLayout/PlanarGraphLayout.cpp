@@ -63,3 +63,264 @@ int ttk::PlanarGraphLayout::computeDotLayout(
   return 0;
 #endif
 }
+
+// Compute Layered Layout
+int ttk::PlanarGraphLayout::computeLayeredLayout(
+  // Input
+  const size_t &nLayers,
+  const vector<size_t> &nodeLayers,
+  const vector<size_t> &adjacencyOffsets,
+  const vector<size_t> &adjacency,
+  const vector<char> &adjacencyStraight,
+  const vector<float> &heights,
+  const int &threadNumber,
+
+  // Output
+  vector<float> &y) const {
+
+  // same default as dot (nodesep of 0.25 inch)
+  const float nodeSeparation = 0.25;
+  const int maxOrderIterations = 24;
+  const int maxPlacementIterations = 16;
+
+  const size_t nNodes = nodeLayers.size();
+
+  // ---------------------------------------------------------
+  // Initial order: breadth-first discovery order, so that
+  // connected nodes start close to each other
+  // ---------------------------------------------------------
+  vector<vector<size_t>> layerNodes(nLayers);
+  {
+    vector<char> visited(nNodes, 0);
+    vector<size_t> queue;
+    queue.reserve(nNodes);
+    for(size_t seed = 0; seed < nNodes; seed++) {
+      if(visited[seed])
+        continue;
+      visited[seed] = 1;
+      queue.clear();
+      queue.push_back(seed);
+      for(size_t q = 0; q < queue.size(); q++) {
+        size_t u = queue[q];
+        layerNodes[nodeLayers[u]].push_back(u);
+        for(size_t a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1]; a++) {
+          size_t v = adjacency[a];
+          if(!visited[v]) {
+            visited[v] = 1;
+            queue.push_back(v);
+          }
+        }
+      }
+    }
+  }
+
+  vector<size_t> positions(nNodes);
+  for(auto &nodes : layerNodes)
+    for(size_t i = 0; i < nodes.size(); i++)
+      positions[nodes[i]] = i;
+
+  // ---------------------------------------------------------
+  // Crossing reduction (barycenters on the adjacent layers)
+  // ---------------------------------------------------------
+  // number of crossings between the edges of layers l and l+1
+  auto countCrossings = [&](const size_t l, vector<pair<size_t, size_t>> &edges,
+                            vector<size_t> &tree) {
+    edges.clear();
+    for(auto &u : layerNodes[l])
+      for(size_t a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1]; a++)
+        if(nodeLayers[adjacency[a]] == l + 1)
+          edges.emplace_back(positions[u], positions[adjacency[a]]);
+    sort(edges.begin(), edges.end());
+
+    // count inversions of the second coordinates (Fenwick tree)
+    const size_t n = layerNodes[l + 1].size();
+    tree.assign(n + 1, 0);
+    size_t crossings = 0;
+    for(size_t e = 0; e < edges.size(); e++) {
+      size_t notGreater = 0;
+      for(size_t i = edges[e].second + 1; i > 0; i -= i & (~i + 1))
+        notGreater += tree[i];
+      crossings += e - notGreater;
+      for(size_t i = edges[e].second + 1; i <= n; i += i & (~i + 1))
+        tree[i]++;
+    }
+    return crossings;
+  };
+
+  const size_t nLayerPairs = nLayers > 0 ? nLayers - 1 : 0;
+  auto totalCrossings = [&]() {
+    size_t crossings = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber) reduction(+ : crossings)
+#endif
+    {
+      vector<pair<size_t, size_t>> edges;
+      vector<size_t> tree;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for(size_t l = 0; l < nLayerPairs; l++)
+        crossings += countCrossings(l, edges, tree);
+    }
+    return crossings;
+  };
+
+  size_t bestCrossings = totalCrossings();
+  vector<vector<size_t>> bestLayerNodes = layerNodes;
+  {
+    int iterationsWithoutImprovement = 0;
+    vector<float> barycenters(nNodes);
+
+    for(int it = 0; it < maxOrderIterations && bestCrossings > 0
+                    && iterationsWithoutImprovement < 4;
+        it++) {
+
+      // layers of the same parity only depend on layers of the other
+      // parity: process them concurrently
+      for(size_t parity = 0; parity < 2; parity++) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber)
+#endif
+        for(size_t l = parity; l < nLayers; l += 2) {
+          auto &nodes = layerNodes[l];
+          for(auto &u : nodes) {
+            float sum = 0;
+            size_t count = 0;
+            for(size_t a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1];
+                a++) {
+              size_t v = adjacency[a];
+              if(nodeLayers[v] + 1 == l || nodeLayers[v] == l + 1) {
+                sum += positions[v];
+                count++;
+              }
+            }
+            barycenters[u] = count ? sum / count : positions[u];
+          }
+
+          stable_sort(nodes.begin(), nodes.end(),
+                      [&](const size_t &a, const size_t &b) {
+                        return barycenters[a] < barycenters[b];
+                      });
+          for(size_t i = 0; i < nodes.size(); i++)
+            positions[nodes[i]] = i;
+        }
+      }
+
+      size_t crossings = totalCrossings();
+      if(crossings < bestCrossings) {
+        bestCrossings = crossings;
+        bestLayerNodes = layerNodes;
+        iterationsWithoutImprovement = 0;
+      } else {
+        iterationsWithoutImprovement++;
+      }
+    }
+  }
+  layerNodes.swap(bestLayerNodes);
+  for(auto &nodes : layerNodes)
+    for(size_t i = 0; i < nodes.size(); i++)
+      positions[nodes[i]] = i;
+
+  // ---------------------------------------------------------
+  // Coordinate assignment
+  // ---------------------------------------------------------
+  // Each layer is placed as close as possible (least squares) to the
+  // y of its neighbors (or of its straight branch neighbor) while
+  // preserving the order and the node separation, which is an
+  // isotonic regression solved with pool-adjacent-violators.
+  y.resize(nNodes);
+  vector<float> offsets(nNodes);
+  for(auto &nodes : layerNodes) {
+    float offset = 0;
+    for(size_t i = 0; i < nodes.size(); i++) {
+      if(i > 0)
+        offset += (heights[nodes[i - 1]] + heights[nodes[i]]) * 0.5
+                  + nodeSeparation;
+      offsets[nodes[i]] = offset;
+    }
+    // center the initial stack
+    for(auto &u : nodes)
+      y[u] = offsets[u] - offset * 0.5;
+  }
+
+  for(int it = 0; it < maxPlacementIterations; it++) {
+    for(size_t parity = 0; parity < 2; parity++) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber)
+#endif
+      {
+        vector<float> blockValues, targets;
+        vector<size_t> blockSizes;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for(size_t l = parity; l < nLayers; l += 2) {
+          auto &nodes = layerNodes[l];
+          const size_t n = nodes.size();
+          if(n == 0)
+            continue;
+
+          // targets in the offset-free space
+          targets.resize(n);
+          for(size_t i = 0; i < n; i++) {
+            size_t u = nodes[i];
+            float sum = 0;
+            size_t count = 0;
+            bool straight = false;
+            for(size_t a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1];
+                a++) {
+              size_t v = adjacency[a];
+              // only neighbors on layers of the other parity (fixed)
+              if((nodeLayers[v] + l) % 2 == 0)
+                continue;
+              if(adjacencyStraight[a]) {
+                if(!straight) {
+                  straight = true;
+                  sum = 0;
+                  count = 0;
+                }
+              } else if(straight) {
+                continue;
+              }
+              sum += y[v];
+              count++;
+            }
+            targets[i] = (count ? sum / count : y[u]) - offsets[u];
+          }
+
+          // pool adjacent violators
+          blockValues.clear();
+          blockSizes.clear();
+          for(size_t i = 0; i < n; i++) {
+            blockValues.push_back(targets[i]);
+            blockSizes.push_back(1);
+            while(blockValues.size() > 1
+                  && blockValues[blockValues.size() - 2] > blockValues.back()) {
+              size_t s1 = blockSizes.back();
+              float v1 = blockValues.back();
+              blockValues.pop_back();
+              blockSizes.pop_back();
+              size_t s0 = blockSizes.back();
+              blockValues.back() = (blockValues.back() * s0 + v1 * s1) / (s0 + s1);
+              blockSizes.back() = s0 + s1;
+            }
+          }
+          size_t i = 0;
+          for(size_t b = 0; b < blockValues.size(); b++)
+            for(size_t k = 0; k < blockSizes[b]; k++, i++)
+              y[nodes[i]] = blockValues[b] + offsets[nodes[i]];
+        }
+      }
+    }
+  }
+
+  {
+    stringstream msg;
+    msg << "[ttkPlanarGraphLayout] Layered layout: " << bestCrossings
+        << " crossing(s)." << endl;
+    dMsg(cout, msg.str(), advancedInfoMsg);
+  }
+
+  return 1;
+}
@@ -16,6 +16,15 @@
 /// nested based on the level hierarchy. This makes it possible to draw nested
 /// graphs where each level is a layer of the resulting graph.
 ///
+/// The layout of each level is either computed natively (default) or with
+/// Graphviz. The native engine is a layered (Sugiyama-style) layout that
+/// directly uses the input arrays: sequences define the layers (a longest path
+/// layering is used otherwise), a barycentric heuristic reduces the edge
+/// crossings (layers of the same parity are processed in parallel), and the
+/// vertical coordinates are computed by an order-preserving least squares
+/// placement that keeps the branches straight. Levels are laid out in
+/// parallel.
+///
 /// \b Related \b publication: \n
 /// 'Nested Tracking Graphs'
 /// Jonas Lukasczyk, Gunther Weber, Ross Maciejewski, Christoph Garth, and Heike
@@ -25,6 +34,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 
 // base code includes
@@ -37,9 +47,16 @@ namespace ttk {
   class PlanarGraphLayout : public Debug {
 
   public:
-    PlanarGraphLayout(){};
+    enum class Engine { Native = 0, Graphviz = 1 };
+
+    PlanarGraphLayout() : engine_{Engine::Native} {};
     ~PlanarGraphLayout(){};
 
+    inline int setInputEngine(const Engine engine) {
+      engine_ = engine;
+      return 0;
+    }
+
     template <typename topoType, typename idType, typename sequenceType>
     int execute(
       // Input
@@ -102,6 +119,41 @@ namespace ttk {
 
       // Output
       float *layout) const;
+
+    template <typename topoType, typename idType, typename sequenceType>
+    int computeNativeLayout(
+      // Input
+      const sequenceType *pointSequences,
+      const float *sizes,
+      const idType *branches,
+      const topoType *topology,
+      const vector<size_t> &nodeIndicies,
+      const vector<size_t> &edgeIndicies,
+      const map<sequenceType, size_t> &sequenceValueToIndexMap,
+      const int &threadNumber,
+
+      // Scratch (global to local node index, shared by all levels)
+      vector<size_t> &localIndicies,
+
+      // Output
+      float *layout) const;
+
+    // Compute the order and the y coordinate of the nodes of a layered graph
+    int computeLayeredLayout(
+      // Input
+      const size_t &nLayers,
+      const vector<size_t> &nodeLayers,
+      const vector<size_t> &adjacencyOffsets,
+      const vector<size_t> &adjacency,
+      const vector<char> &adjacencyStraight,
+      const vector<float> &heights,
+      const int &threadNumber,
+
+      // Output
+      vector<float> &y) const;
+
+  protected:
+    Engine engine_;
   };
 } // namespace ttk
 
@@ -267,6 +319,146 @@ int ttk::PlanarGraphLayout::computeDotString(
   return 1;
 }
 
+// =============================================================================
+// Compute Native Layout
+// =============================================================================
+template <typename topoType, typename idType, typename sequenceType>
+int ttk::PlanarGraphLayout::computeNativeLayout(
+  // Input
+  const sequenceType *pointSequences,
+  const float *sizes,
+  const idType *branches,
+  const topoType *topology,
+  const vector<size_t> &nodeIndicies,
+  const vector<size_t> &edgeIndicies,
+  const map<sequenceType, size_t> &sequenceValueToIndexMap,
+  const int &threadNumber,
+
+  // Scratch
+  vector<size_t> &localIndicies,
+
+  // Output
+  float *layout) const {
+
+  Timer t;
+
+  // same defaults as the generated dot strings (node width of 1 inch,
+  // ranksep of 0.5 inch)
+  const float rankStep = 1.5;
+
+  const size_t nNodes = nodeIndicies.size();
+  if(nNodes == 0)
+    return 1;
+
+  for(size_t u = 0; u < nNodes; u++)
+    localIndicies[nodeIndicies[u]] = u;
+
+  // -------------------------------------------------------------------------
+  // Adjacency (undirected, CSR)
+  // -------------------------------------------------------------------------
+  vector<size_t> adjacencyOffsets(nNodes + 1, 0);
+  for(auto &edgeIndex : edgeIndicies) {
+    size_t temp = edgeIndex * 3;
+    adjacencyOffsets[localIndicies[topology[temp + 1]] + 1]++;
+    adjacencyOffsets[localIndicies[topology[temp + 2]] + 1]++;
+  }
+  for(size_t u = 0; u < nNodes; u++)
+    adjacencyOffsets[u + 1] += adjacencyOffsets[u];
+
+  vector<size_t> adjacency(adjacencyOffsets[nNodes]);
+  vector<char> adjacencyStraight(adjacencyOffsets[nNodes], 0);
+  {
+    vector<size_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for(auto &edgeIndex : edgeIndicies) {
+      size_t temp = edgeIndex * 3;
+      auto &i0 = topology[temp + 1];
+      auto &i1 = topology[temp + 2];
+      size_t u = localIndicies[i0];
+      size_t v = localIndicies[i1];
+      char straight = branches != nullptr && branches[i0] == branches[i1];
+      adjacencyStraight[cursor[u]] = straight;
+      adjacency[cursor[u]++] = v;
+      adjacencyStraight[cursor[v]] = straight;
+      adjacency[cursor[v]++] = u;
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Layers
+  // -------------------------------------------------------------------------
+  vector<size_t> nodeLayers(nNodes, 0);
+  size_t nLayers = 1;
+  if(pointSequences != nullptr) {
+    // sequence = layer (global indices, to align the levels)
+    nLayers = sequenceValueToIndexMap.size();
+    for(size_t u = 0; u < nNodes; u++)
+      nodeLayers[u]
+        = sequenceValueToIndexMap.find(pointSequences[nodeIndicies[u]])
+            ->second;
+  } else {
+    // longest path layering along the edge directions
+    vector<size_t> inDegree(nNodes, 0);
+    vector<vector<size_t>> successors(nNodes);
+    for(auto &edgeIndex : edgeIndicies) {
+      size_t temp = edgeIndex * 3;
+      size_t u = localIndicies[topology[temp + 1]];
+      size_t v = localIndicies[topology[temp + 2]];
+      successors[u].push_back(v);
+      inDegree[v]++;
+    }
+    vector<size_t> queue;
+    queue.reserve(nNodes);
+    for(size_t u = 0; u < nNodes; u++)
+      if(inDegree[u] == 0)
+        queue.push_back(u);
+    for(size_t q = 0; q < queue.size(); q++) {
+      size_t u = queue[q];
+      for(auto &v : successors[u]) {
+        nodeLayers[v] = max(nodeLayers[v], nodeLayers[u] + 1);
+        if(--inDegree[v] == 0)
+          queue.push_back(v);
+      }
+    }
+    // nodes on cycles (not reached) keep the layer of their predecessors
+    for(size_t u = 0; u < nNodes; u++)
+      nLayers = max(nLayers, nodeLayers[u] + 1);
+  }
+
+  // -------------------------------------------------------------------------
+  // Node heights
+  // -------------------------------------------------------------------------
+  vector<float> heights(nNodes, 1);
+  if(sizes != nullptr)
+    for(size_t u = 0; u < nNodes; u++)
+      heights[u] = sizes[nodeIndicies[u]];
+
+  // -------------------------------------------------------------------------
+  // Order and coordinates
+  // -------------------------------------------------------------------------
+  vector<float> y;
+  int status = this->computeLayeredLayout(
+    nLayers, nodeLayers, adjacencyOffsets, adjacency, adjacencyStraight,
+    heights, threadNumber, y);
+  if(status != 1)
+    return 0;
+
+  for(size_t u = 0; u < nNodes; u++) {
+    size_t offset = nodeIndicies[u] * 2;
+    layout[offset] = nodeLayers[u] * rankStep;
+    layout[offset + 1] = y[u];
+  }
+
+  {
+    stringstream msg;
+    msg << "[ttkPlanarGraphLayout] Native layout (" << nNodes << " nodes, "
+        << nLayers << " layers) computed in " << t.getElapsedTime() << " s."
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 1;
+}
+
 // =============================================================================
 // Compute Slots
 // =============================================================================
@@ -436,7 +628,53 @@ int ttk::PlanarGraphLayout::execute(
   // -------------------------------------------------------------------------
   // Compute initial layout for each level
   // -------------------------------------------------------------------------
-  for(idType l = 0; l < nLevels; l++) {
+  if(engine_ == Engine::Native) {
+    // levels are independent: distribute them among the threads, or give all
+    // the threads to the layout of a single level
+    const int levelThreadNumber = nLevels > 1 ? 1 : threadNumber_;
+    vector<size_t> localIndicies(nPoints);
+    int status = 1;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+    for(size_t l = 0; l < (size_t)nLevels; l++) {
+      vector<size_t> nodeIndicies;
+      vector<size_t> edgeIndicies;
+
+      int levelStatus = this->extractLevel<topoType, idType>(
+        // Input
+        (idType)l, levels, topology, nPoints, nEdges,
+
+        // Output
+        nodeIndicies, edgeIndicies);
+
+      if(levelStatus == 1)
+        levelStatus
+          = this->computeNativeLayout<topoType, idType, sequenceType>(
+            // Input
+            pointSequences, sizes, branches, topology, nodeIndicies,
+            edgeIndicies, sequenceValueToIndexMap, levelThreadNumber,
+
+            // Scratch
+            localIndicies,
+
+            // Output
+            layout);
+
+      if(levelStatus != 1) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif
+        status = levelStatus;
+      }
+    }
+
+    if(status != 1)
+      return 0;
+  }
+
+  for(idType l = 0; engine_ == Engine::Graphviz && l < nLevels; l++) {
     vector<size_t> nodeIndicies;
     vector<size_t> edgeIndicies;
 
@@ -1,11 +1,12 @@
 #include <Dijkstra.h>
 #include <Geometry.h>
 #include <QuadrangulationSubdivision.h>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <limits>
 #include <numeric>
-#include <stack>
 
 #define MODULE_S "[QuadrangulationSubdivision] "
 
@@ -13,70 +14,114 @@ ttk::SimplexId
   ttk::QuadrangulationSubdivision::findEdgeMiddle(const size_t a,
                                                   const size_t b) const {
 
-  std::vector<float> sum(vertexDistance_[a].size());
+  const auto &distA = vertexDistance_[a];
+  const auto &distB = vertexDistance_[b];
 
   // euclidian barycenter of a and b
   Point edgeEuclBary = (outputPoints_[a] + outputPoints_[b]) * 0.5F;
 
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < sum.size(); ++i) {
-    float m = vertexDistance_[a][i];
-    float n = vertexDistance_[b][i];
-    // stay on the shortest path between a and b
-    sum[i] = m + n;
-    if(m != std::numeric_limits<float>::infinity()
-       && n != std::numeric_limits<float>::infinity()) {
-      // try to get the middle of the shortest path
-      sum[i] += std::abs(m - n);
+  SimplexId res{};
+  float minSum = std::numeric_limits<float>::infinity();
+
+  // only the vertices reached from both a and b are candidates (the
+  // distances are sorted by vertex identifier)
+  size_t i = 0, j = 0;
+  while(i < distA.size() && j < distB.size()) {
+    if(distA[i].first < distB[j].first) {
+      ++i;
+      continue;
     }
+    if(distB[j].first < distA[i].first) {
+      ++j;
+      continue;
+    }
+
+    const auto v = distA[i].first;
+    float m = distA[i].second;
+    float n = distB[j].second;
+    // stay on the shortest path between a and b
+    // and try to get the middle of the shortest path
+    float sum = m + n + std::abs(m - n);
 
     // get the euclidian distance to AB
     Point curr{};
-    triangulation_->getVertexPoint(i, curr.x, curr.y, curr.z);
+    triangulation_->getVertexPoint(v, curr.x, curr.y, curr.z);
     // try to minimize the euclidian distance to AB too
-    sum[i] += Geometry::distance(&curr.x, &edgeEuclBary.x);
+    sum += Geometry::distance(&curr.x, &edgeEuclBary.x);
+
+    if(sum < minSum) {
+      minSum = sum;
+      res = v;
+    }
+    ++i;
+    ++j;
   }
 
-  return std::min_element(sum.begin(), sum.end()) - sum.begin();
+  return res;
 }
 
 ttk::SimplexId ttk::QuadrangulationSubdivision::findQuadBary(
   const std::vector<size_t> &quadVertices) const {
 
-  std::vector<float> sum(vertexDistance_[*quadVertices.begin()].size(),
-                         std::numeric_limits<float>::infinity());
-
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < sum.size(); ++i) {
-
-    // skip following computation if too far from any parent quad vertex
-    bool skip = std::any_of(
-      quadVertices.begin(), quadVertices.end(), [&](const size_t &a) {
-        return vertexDistance_[a][i] == std::numeric_limits<float>::infinity();
-      });
+  std::array<const std::vector<std::pair<SimplexId, float>> *, 4> dists{
+    &vertexDistance_[quadVertices[0]], &vertexDistance_[quadVertices[1]],
+    &vertexDistance_[quadVertices[2]], &vertexDistance_[quadVertices[3]]};
+  std::array<size_t, 4> pos{};
+
+  SimplexId res{};
+  float minSum = std::numeric_limits<float>::infinity();
+
+  // skip the vertices too far from any parent quad vertex: only visit the
+  // vertices reached from the four of them
+  while(true) {
+    SimplexId v{};
+    bool end = false;
+    for(size_t k = 0; k < dists.size(); ++k) {
+      if(pos[k] == dists[k]->size()) {
+        end = true;
+        break;
+      }
+      v = std::max(v, (*dists[k])[pos[k]].first);
+    }
+    if(end) {
+      break;
+    }
 
-    if(skip) {
+    bool common = true;
+    for(size_t k = 0; k < dists.size(); ++k) {
+      while(pos[k] < dists[k]->size() && (*dists[k])[pos[k]].first < v) {
+        pos[k]++;
+      }
+      if(pos[k] == dists[k]->size() || (*dists[k])[pos[k]].first != v) {
+        common = false;
+      }
+    }
+    if(!common) {
       continue;
     }
 
-    float m = vertexDistance_[quadVertices[0]][i];
-    float n = vertexDistance_[quadVertices[1]][i];
-    float o = vertexDistance_[quadVertices[2]][i];
-    float p = vertexDistance_[quadVertices[3]][i];
+    float m = (*dists[0])[pos[0]].second;
+    float n = (*dists[1])[pos[1]].second;
+    float o = (*dists[2])[pos[2]].second;
+    float p = (*dists[3])[pos[3]].second;
 
     // try to be "near" the four parent vertices
-    sum[i] = m + n + o + p;
+    float sum = m + n + o + p;
 
     // try to be on the diagonals intersection
-    sum[i] += std::abs(m - o);
-    sum[i] += std::abs(n - p);
+    sum += std::abs(m - o);
+    sum += std::abs(n - p);
+
+    if(sum < minSum) {
+      minSum = sum;
+      res = v;
+    }
+    for(auto &k : pos) {
+      k++;
+    }
   }
 
-  return std::min_element(sum.begin(), sum.end()) - sum.begin();
+  return res;
 }
 
 int ttk::QuadrangulationSubdivision::subdivise() {
@@ -101,25 +146,41 @@ int ttk::QuadrangulationSubdivision::subdivise() {
   getQuadNeighbors(outputQuads_, quadNeighbors_, true);
 
   // compute shortest distance from every vertex to all other that share a quad
-#ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
-#endif // TTK_ENABLE_OPENMP
+  std::vector<size_t> toCompute{};
+  std::vector<SimplexId> sources{};
+  std::vector<std::vector<SimplexId>> bounds{};
   for(size_t i = 0; i < outputPoints_.size(); ++i) {
 
     // skip if already computed on a coarser subdivision
     if(vertexDistance_[i].empty()) {
+      toCompute.emplace_back(i);
+      sources.emplace_back(nearestVertexIdentifier_[i]);
 
       // do not propagate on the whole mesh
-      std::vector<SimplexId> bounds;
+      bounds.emplace_back();
       for(auto &p : quadNeighbors_[i]) {
-        bounds.emplace_back(nearestVertexIdentifier_[p]);
+        bounds.back().emplace_back(nearestVertexIdentifier_[p]);
       }
-
-      Dijkstra::shortestPath(nearestVertexIdentifier_[i], *triangulation_,
-                             vertexDistance_[i], bounds);
     }
   }
 
+  // one Dijkstra workspace per thread, shared by all the local searches
+  std::vector<Dijkstra::Workspace<float>> workspaces(threadNumber_);
+  Dijkstra::shortestPaths<float>(
+    sources, *triangulation_, workspaces,
+    [&](const size_t i, const Dijkstra::Workspace<float> &workspace) {
+      // only keep the (sparse) distances to the reached vertices
+      auto &dists = vertexDistance_[toCompute[i]];
+      const auto &reached = workspace.getReachedVertices();
+      dists.clear();
+      dists.reserve(reached.size());
+      for(const auto v : reached) {
+        dists.emplace_back(v, workspace.getDistance(v));
+      }
+      std::sort(dists.begin(), dists.end());
+    },
+    bounds);
+
   for(auto &q : outputQuads_) {
     assert(q.n == 4); // magic number...
 
@@ -300,7 +361,9 @@ std::tuple<ttk::QuadrangulationSubdivision::Point,
            size_t,
            ttk::SimplexId>
   ttk::QuadrangulationSubdivision::findProjection(
-    const size_t a, const bool forceReverseProj) const {
+    const size_t a,
+    const bool forceReverseProj,
+    BoundingVolumeHierarchy::Scratch &scratch) const {
 
   // current vertex 3d coordinates
   Point pa = outputPoints_[a];
@@ -320,193 +383,50 @@ std::tuple<ttk::QuadrangulationSubdivision::Point,
     doReverseProj = !std::isnan(normalsMean.x);
   }
 
-  // found a projection in one triangle
-  bool success = false;
-  // list of triangle IDs to test to find a potential projection
-  std::stack<SimplexId> trianglesToTest;
-  // list of triangle IDs already tested
-  // (takes more memory to reduce computation time)
-  std::vector<bool> trianglesTested(
-    triangulation_->getNumberOfTriangles(), false);
-  // vertex in triangle with highest barycentric coordinate
-  SimplexId nearestVertex = nearestVertexIdentifier_[a];
+  // triangle containing the projection
+  SimplexId triangleId{-1};
 
-  // number of triangles around nearest vertex
-  SimplexId triangleNumber
-    = triangulation_->getVertexTriangleNumber(nearestVertex);
-  // init pipeline by checking in every triangle around selected vertex
-  for(SimplexId j = 0; j < triangleNumber; j++) {
-    SimplexId ntid;
-    triangulation_->getVertexTriangle(nearestVertex, j, ntid);
-    trianglesToTest.push(ntid);
+  if(doReverseProj) {
+    // intersection of the triangulation and line (a, normalsMean)
+    // nearest to a
+    triangleId = bvh_.intersectLine(&pa.x, &normalsMean.x, &res.x, scratch);
+  } else {
+    // euclidian projection of a onto the triangulation
+    triangleId = bvh_.closestPoint(&pa.x, &res.x, scratch);
   }
 
-  while(!trianglesToTest.empty()) {
-    SimplexId i = trianglesToTest.top();
-    trianglesToTest.pop();
-
-    // skip if already tested
-    if(trianglesTested[i]) {
-      continue;
-    }
-
-    // get triangle vertices
-    std::array<SimplexId, 3> tverts{};
-    triangulation_->getTriangleVertex(i, 0, tverts[0]);
-    triangulation_->getTriangleVertex(i, 1, tverts[1]);
-    triangulation_->getTriangleVertex(i, 2, tverts[2]);
-
-    // get coordinates of triangle vertices
-    Point pm{}, pn{}, po{};
-    triangulation_->getVertexPoint(tverts[0], pm.x, pm.y, pm.z);
-    triangulation_->getVertexPoint(tverts[1], pn.x, pn.y, pn.z);
-    triangulation_->getVertexPoint(tverts[2], po.x, po.y, po.z);
+  size_t trChecked = scratch.trianglesTested;
 
-    // triangle normal: cross product of two edges
-    Point crossP{};
-    // mn, mo vectors
-    Point mn = pn - pm;
-    Point mo = po - pm;
-    // compute mn ^ mo
-    Geometry::crossProduct(&mn.x, &mo.x, &crossP.x);
-    // unitary normal vector
-    Point normTri = crossP / Geometry::magnitude(&crossP.x);
-
-    // compute intersection of triangle plane and line (a, normalsMean)
-    if(doReverseProj) {
-
-      auto denom = Geometry::dotProduct(&normalsMean.x, &normTri.x);
-
-      // check if triangle plane is parallel to quad normal
-      if(std::abs(denom) < powf(10, -FLT_DIG)) {
-        // skip this iteration after filling pipeline
-        trianglesTested[i] = true;
-        // fill pipeline with neighboring triangles
-        for(auto &vert : tverts) {
-          auto ntr = triangulation_->getVertexTriangleNumber(vert);
-          for(SimplexId j = 0; j < ntr; ++j) {
-            SimplexId tid;
-            triangulation_->getVertexTriangle(vert, j, tid);
-            if(tid != i) {
-              trianglesToTest.push(tid);
-            }
-          }
-        }
-        continue;
-      }
-
-      // use formula from Wikipedia: line-plane intersection
-      auto tmp = pm - pa;
-      auto alpha = Geometry::dotProduct(&tmp.x, &normTri.x) / denom;
-
-      // intersection
-      res = pa + normalsMean * alpha;
-
-    }
-    // compute euclidian projection of a in triangle plane
-    else {
-
-      auto tmp = pa - pm;
-      // projection
-      res = pa - normTri * Geometry::dotProduct(&normTri.x, &tmp.x);
-    }
-
-    // compute barycentric coords of projection
-    std::vector<float> baryCoords;
-    Geometry::computeBarycentricCoordinates(
-      &pm.x, &pn.x, &po.x, &res.x, baryCoords);
-
-    // check if projection in triangle
-    bool inTriangle = true;
-    for(auto &coord : baryCoords) {
-      if(coord < powf(10, -FLT_DIG)) {
-        inTriangle = false;
-      }
-      if(coord > 1 + powf(10, -FLT_DIG)) {
-        inTriangle = false;
-      }
-    }
-
-    // mark triangle as tested
-    trianglesTested[i] = true;
-
-    if(inTriangle) {
-      success = true;
-      // should we check if we have the nearest triangle?
-      break;
-    }
-
-    // extrema values in baryCoords
-    auto extrema = std::minmax_element(baryCoords.begin(), baryCoords.end());
-
-    // find the nearest triangle vertices (with the highest/positive
-    // values in baryCoords) from proj
-    std::vector<SimplexId> vertices(2);
-    vertices[0] = tverts[extrema.second - baryCoords.begin()];
-    for(size_t j = 0; j < baryCoords.size(); j++) {
-      if(j != static_cast<size_t>(extrema.first - baryCoords.begin())
-         && j != static_cast<size_t>(extrema.second - baryCoords.begin())) {
-        vertices[1] = tverts[j];
-        break;
-      }
-    }
-
-    // store vertex with highest barycentric coordinate
-    nearestVertex = vertices[0];
-
-    // triangles around vertices[0] and vertices[1]
-    std::array<std::set<SimplexId>, 2> vertsTriangles{};
-
-    // get triangles around vertices
-    for(size_t j = 0; j < vertices.size(); ++j) {
-      SimplexId tnum = triangulation_->getVertexTriangleNumber(vertices[j]);
-      for(SimplexId k = 0; k < tnum; k++) {
-        SimplexId tid;
-        triangulation_->getVertexTriangle(vertices[j], k, tid);
-        if(tid == i) {
-          continue;
-        }
-        vertsTriangles[j].insert(tid);
-      }
-    }
-
-    // triangles to test next
-    std::vector<SimplexId> common_triangles;
+  // found a projection in one triangle
+  bool success = triangleId != -1;
 
-    // look for triangles sharing the vertices with max values in baryCoords
-    std::set_intersection(vertsTriangles[0].begin(), vertsTriangles[0].end(),
-                          vertsTriangles[1].begin(), vertsTriangles[1].end(),
-                          std::back_inserter(common_triangles));
+  // vertex in triangle nearest to the projection
+  SimplexId nearestVertex = nearestVertexIdentifier_[a];
 
-    for(auto &ntid : common_triangles) {
-      if(!trianglesTested[ntid]) {
-        trianglesToTest.push(ntid);
+  if(success) {
+    float minDist = std::numeric_limits<float>::infinity();
+    for(int j = 0; j < 3; ++j) {
+      SimplexId vert;
+      triangulation_->getTriangleVertex(triangleId, j, vert);
+      Point pv{};
+      triangulation_->getVertexPoint(vert, pv.x, pv.y, pv.z);
+      auto dist = Geometry::distance(&res.x, &pv.x);
+      if(dist < minDist) {
+        minDist = dist;
+        nearestVertex = vert;
       }
     }
-  }
-
-  size_t trChecked
-    = std::count(trianglesTested.begin(), trianglesTested.end(), true);
-  const size_t maxTrChecked = 100;
-
-  if(success && trChecked > maxTrChecked) {
-    success = false;
-  }
-
-  if(!success) {
+  } else {
     if(!forceReverseProj) {
-      return findProjection(a, true);
+      return findProjection(a, true, scratch);
     }
-    // replace proj by the nearest vertex?
-    std::vector<float> dists(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; ++i) {
-      Point pv{};
-      triangulation_->getVertexPoint(i, pv.x, pv.y, pv.z);
-      dists[i] = Geometry::distance(&pa.x, &pv.x);
+    // replace proj by the nearest vertex
+    auto nearest = bvh_.nearestVertex(&pa.x, scratch);
+    trChecked += scratch.trianglesTested;
+    if(nearest != -1) {
+      nearestVertex = nearest;
     }
-    auto min = std::min_element(dists.begin(), dists.end()) - dists.begin();
-    triangulation_->getVertexPoint(min, res.x, res.y, res.z);
-    nearestVertex = min;
+    triangulation_->getVertexPoint(nearestVertex, res.x, res.y, res.z);
   }
 
   SimplexId projSucess = success ? (doReverseProj ? 1 : 2) : 3;
@@ -530,26 +450,34 @@ int ttk::QuadrangulationSubdivision::project(const std::set<size_t> &filtered,
 
   // main loop
 #ifdef TTK_ENABLE_OPENMP
-#pragma omp parallel for num_threads(threadNumber_)
+#pragma omp parallel num_threads(threadNumber_)
 #endif // TTK_ENABLE_OPENMP
-  for(size_t i = 0; i < outputPoints_.size(); i++) {
+  {
+    // per-thread hierarchy query buffers
+    BoundingVolumeHierarchy::Scratch scratch{};
 
-    // skip computation if i in filtered
-    if(filtered.find(i) != filtered.end()) {
-      tmp[i] = outputPoints_[i];
-      continue;
-    }
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif // TTK_ENABLE_OPENMP
+    for(size_t i = 0; i < outputPoints_.size(); i++) {
+
+      // skip computation if i in filtered
+      if(filtered.find(i) != filtered.end()) {
+        tmp[i] = outputPoints_[i];
+        continue;
+      }
 
-    // replace curr in outputPoints_ by its projection
-    auto res = findProjection(i, reverseProjection_);
+      // replace curr in outputPoints_ by its projection
+      auto res = findProjection(i, reverseProjection_, scratch);
 
-    tmp[i] = std::get<0>(res);
-    nearestVertexIdentifier_[i] = std::get<1>(res);
+      tmp[i] = std::get<0>(res);
+      nearestVertexIdentifier_[i] = std::get<1>(res);
 
-    if(lastIter) {
-      // fill in debug info
-      trianglesChecked_[i] = std::get<2>(res);
-      projSucceeded_[i] = std::get<3>(res);
+      if(lastIter) {
+        // fill in debug info
+        trianglesChecked_[i] = std::get<2>(res);
+        projSucceeded_[i] = std::get<3>(res);
+      }
     }
   }
 
@@ -870,6 +798,20 @@ int ttk::QuadrangulationSubdivision::execute() {
     }
   }
 
+  // spatial index used to project the generated points, built once
+  // per input triangulation
+  if(!bvh_.isBuilt(triangulation_)) {
+    bvh_.setThreadNumber(threadNumber_);
+    bvh_.setDebugLevel(debugLevel_);
+    if(bvh_.build(triangulation_) != 0) {
+      std::stringstream msg;
+      msg << MODULE_S "Error: cannot index the input triangulation."
+          << std::endl;
+      dMsg(std::cerr, msg.str(), fatalMsg);
+      return -1;
+    }
+  }
+
   // main loop
   for(size_t i = 0; i < subdivisionLevel_; i++) {
     // subdivise each quadrangle by creating five new points, at the
@@ -14,6 +14,7 @@
 #pragma once
 
 // base code includes
+#include <BoundingVolumeHierarchy.h>
 #include <Triangulation.h>
 #include <Wrapper.h>
 #include <set>
@@ -62,6 +63,9 @@ namespace ttk {
       }
     }
     inline void setupTriangulation(Triangulation *const triangl) {
+      if(triangl != triangulation_) {
+        bvh_.clear();
+      }
       triangulation_ = triangl;
       if(triangulation_ != nullptr) {
         vertexNumber_ = triangulation_->getNumberOfVertices();
@@ -69,6 +73,15 @@ namespace ttk {
         triangulation_->preprocessVertexTriangles();
       }
     }
+    /**
+     * @brief Discard the spatial index of the input triangulation
+     *
+     * To be called when the input triangulation geometry has changed: the
+     * index is otherwise built once and reused across executions.
+     */
+    inline void clearSpatialIndex() {
+      bvh_.clear();
+    }
     int execute();
 
     inline long long *getQuadBuf() {
@@ -194,14 +207,23 @@ namespace ttk {
     /**
      * @brief Compute the projection in the nearest triangle
      *
+     * Use the triangle bounding volume hierarchy either to intersect
+     * the input triangulation with the line supported by the
+     * quadrangulation normal (reverse projection), or to find the
+     * closest point on the input triangulation. If the reverse
+     * projection fails, the nearest input vertex is used instead.
+     *
      * @param[in] a input index of quadrangle vertex
      * @param[in] forceReverseProj Try reverse projection
+     * @param[in] scratch Per-thread hierarchy query buffers
      *
      * @return (coordinates of projection, nearest vertex id, number
      * of triangles checked for result, projection id)
      */
     std::tuple<Point, SimplexId, size_t, SimplexId>
-      findProjection(size_t a, bool forceReverseProj) const;
+      findProjection(size_t a,
+                     bool forceReverseProj,
+                     BoundingVolumeHierarchy::Scratch &scratch) const;
 
     /**
      * @brief Find the middle of a quad edge using Dijkstra
@@ -283,6 +305,8 @@ namespace ttk {
 
     // input triangulation
     Triangulation *triangulation_{};
+    // spatial index over the input triangles
+    BoundingVolumeHierarchy bvh_{};
 
     // array of output quadrangles
     std::vector<Quad> outputQuads_{};
@@ -293,7 +317,8 @@ namespace ttk {
     // array of nearest input vertex TTK identifier
     std::vector<SimplexId> nearestVertexIdentifier_{};
     // holds geodesic distance to every other quad vertex sharing a quad
-    std::vector<std::vector<float>> vertexDistance_{};
+    // (pairs of reached vertex identifier and distance, sorted by identifier)
+    std::vector<std::vector<std::pair<SimplexId, float>>> vertexDistance_{};
 
   public:
     // array of output quadrangle vertex valences
@@ -1,9 +1,7 @@
-// NOTE
-// this class has been implemented recursively. this is bad programming.
-// a non-recursive version will be implemented asap.
-
 #include <RangeDrivenOctree.h>
 
+#include <fstream>
+
 using namespace std;
 using namespace ttk;
 
@@ -23,7 +21,8 @@ RangeDrivenOctree::RangeDrivenOctree() {
   v_ = NULL;
 
   vertexNumber_ = 0;
-  rootId_ = 0;
+  domainVolume_ = 0;
+  rangeArea_ = 0;
 }
 
 RangeDrivenOctree::~RangeDrivenOctree() {
@@ -32,8 +31,7 @@ RangeDrivenOctree::~RangeDrivenOctree() {
 int RangeDrivenOctree::flush() {
 
   nodeList_.clear();
-  cellDomainBox_.clear();
-  cellRangeBox_.clear();
+  cellBuffer_.clear();
 
   return 0;
 }
@@ -51,11 +49,14 @@ int RangeDrivenOctree::getTet2NodeMap(vector<SimplexId> &map,
 
   map.resize(cellNumber_);
   for(SimplexId i = 0; i < (SimplexId)nodeList_.size(); i++) {
-    for(SimplexId j = 0; j < (SimplexId)nodeList_[i].cellList_.size(); j++) {
+    if(!isLeaf(nodeList_[i]))
+      continue;
+    for(SimplexId j = nodeList_[i].cellBegin_; j < nodeList_[i].cellEnd_;
+        j++) {
       if(forSegmentation) {
-        map[nodeList_[i].cellList_[j]] = randomMap[i];
+        map[cellBuffer_[j]] = randomMap[i];
       } else {
-        map[nodeList_[i].cellList_[j]] = i;
+        map[cellBuffer_[j]] = i;
       }
     }
   }
@@ -63,248 +64,398 @@ int RangeDrivenOctree::getTet2NodeMap(vector<SimplexId> &map,
   return 0;
 }
 
+int RangeDrivenOctree::load(const string &fileName,
+                            const unsigned long long &inputHash) {
+
+  Timer t;
+
+  flush();
+
+  ifstream f(fileName.data(), ios::in | ios::binary);
+  if(!f) {
+    stringstream msg;
+    msg << "[RangeDrivenOctree] Could not open file `" << fileName << "'."
+        << endl;
+    dMsg(cerr, msg.str(), detailedInfoMsg);
+    return -1;
+  }
+
+  char magicBytes[8];
+  int idSize = 0;
+  SimplexId cellNumber = 0, vertexNumber = 0, nodeNumber = 0;
+  unsigned long long hash = 0;
+
+  f.read(magicBytes, sizeof(magicBytes));
+  f.read((char *)&idSize, sizeof(idSize));
+  if((!f) || (string(magicBytes, sizeof(magicBytes)) != "TTKRDO02")
+     || (idSize != (int)sizeof(SimplexId))) {
+    stringstream msg;
+    msg << "[RangeDrivenOctree] Invalid octree file `" << fileName << "'."
+        << endl;
+    dMsg(cerr, msg.str(), detailedInfoMsg);
+    return -2;
+  }
+
+  f.read((char *)&cellNumber, sizeof(cellNumber));
+  f.read((char *)&vertexNumber, sizeof(vertexNumber));
+  f.read((char *)&hash, sizeof(hash));
+
+  if((!f) || (cellNumber != cellNumber_) || (vertexNumber != vertexNumber_)
+     || (hash != inputHash)) {
+    stringstream msg;
+    msg << "[RangeDrivenOctree] Octree file `" << fileName
+        << "' does not match the input, ignoring." << endl;
+    dMsg(cout, msg.str(), infoMsg);
+    return -3;
+  }
+
+  f.read((char *)&leafMinimumCellNumber_, sizeof(leafMinimumCellNumber_));
+  f.read((char *)&leafMinimumDomainVolumeRatio_,
+         sizeof(leafMinimumDomainVolumeRatio_));
+  f.read((char *)&leafMinimumRangeAreaRatio_,
+         sizeof(leafMinimumRangeAreaRatio_));
+  f.read((char *)&domainVolume_, sizeof(domainVolume_));
+  f.read((char *)&rangeArea_, sizeof(rangeArea_));
+  f.read((char *)&nodeNumber, sizeof(nodeNumber));
+
+  if((!f) || (nodeNumber <= 0)) {
+    return -4;
+  }
+
+  nodeList_.resize(nodeNumber);
+  cellBuffer_.resize(cellNumber);
+  f.read((char *)nodeList_.data(), nodeNumber * sizeof(OctreeNode));
+  f.read((char *)cellBuffer_.data(), cellNumber * sizeof(SimplexId));
+
+  if(!f) {
+    flush();
+    return -5;
+  }
+
+  {
+    stringstream msg;
+    msg << "[RangeDrivenOctree] Octree loaded from `" << fileName << "' in "
+        << t.getElapsedTime() << " s. (" << nodeList_.size() << " nodes)"
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
 int RangeDrivenOctree::rangeSegmentQuery(const pair<double, double> &p0,
                                          const pair<double, double> &p1,
                                          vector<SimplexId> &cellList) const {
 
   Timer t;
 
-  queryResultNumber_ = 0;
   cellList.clear();
 
-  SimplexId ret = rangeSegmentQuery(p0, p1, rootId_, cellList);
+  if(nodeList_.empty())
+    return -1;
+
+  // depth-first traversal with a fixed size stack: at most 7 pending
+  // siblings per level, plus the 8 children of the deepest node.
+  SimplexId stack[8 * (maxDepth_ + 1)];
+  int stackSize = 0;
+  SimplexId leafNumber = 0;
+
+  stack[stackSize++] = 0;
+
+  while(stackSize) {
+
+    const OctreeNode &node = nodeList_[stack[--stackSize]];
+
+    if(!rangeSegmentIntersection(p0, p1, node))
+      continue;
+
+    if(!isLeaf(node)) {
+      // push in reverse order to visit the children in order
+      for(int i = 7; i >= 0; i--) {
+        stack[stackSize++] = node.childBegin_ + i;
+      }
+    } else if(node.cellEnd_ > node.cellBegin_) {
+      // terminal leaf
+      // return our cells
+      cellList.insert(cellList.end(), cellBuffer_.begin() + node.cellBegin_,
+                      cellBuffer_.begin() + node.cellEnd_);
+      leafNumber++;
+    }
+  }
 
   {
     stringstream msg;
     msg << "[RangeDrivenOctree] Query done in " << t.getElapsedTime() << " s. ("
-        << queryResultNumber_ << " non-empty leaves, " << cellList.size()
-        << " cells)" << endl;
+        << leafNumber << " non-empty leaves, " << cellList.size() << " cells)"
+        << endl;
     dMsg(cout, msg.str(), 10);
   }
 
-  return ret;
+  return 0;
 }
 
-int RangeDrivenOctree::rangeSegmentQuery(const pair<double, double> &p0,
-                                         const pair<double, double> &p1,
-                                         const SimplexId &nodeId,
-                                         vector<SimplexId> &cellList) const {
+bool RangeDrivenOctree::rangeSegmentIntersection(
+  const pair<double, double> &p0,
+  const pair<double, double> &p1,
+  const OctreeNode &node) const {
+
+  const double *rangeBox = node.rangeBox_;
 
   // check for intersection for each segment of the range bounding box
   pair<double, double> q0, q1;
 
   // bottom range segment (min, min) (max, min)
-  q0.first = nodeList_[nodeId].rangeBox_.first.first;
-  q0.second = nodeList_[nodeId].rangeBox_.second.first;
-
-  q1.first = nodeList_[nodeId].rangeBox_.first.second;
+  q0.first = rangeBox[0];
+  q0.second = rangeBox[2];
+  q1.first = rangeBox[1];
   q1.second = q0.second;
 
-  if(segmentIntersection(p0, p1, q0, q1)) {
-    if(nodeList_[nodeId].childList_.size()) {
-      for(SimplexId i = 0; i < (SimplexId)nodeList_[nodeId].childList_.size();
-          i++) {
-        rangeSegmentQuery(p0, p1, nodeList_[nodeId].childList_[i], cellList);
-      }
-      return 0;
-    } else {
-      // terminal leaf
-      // return our cells
-      {
-        stringstream msg;
-        msg << "[RangeDrivenOctree] Node #" << nodeId << " returns its "
-            << nodeList_[nodeId].cellList_.size() << " cell(s)." << endl;
-        dMsg(cout, msg.str(), 10);
-      }
-      cellList.insert(cellList.end(), nodeList_[nodeId].cellList_.begin(),
-                      nodeList_[nodeId].cellList_.end());
-      queryResultNumber_++;
-      return 0;
-    }
-  }
+  if(segmentIntersection(p0, p1, q0, q1))
+    return true;
 
   // right segment (max, min) (max, max)
-  q0.first = nodeList_[nodeId].rangeBox_.first.second;
-  q0.second = nodeList_[nodeId].rangeBox_.second.first;
+  q0.first = rangeBox[1];
+  q0.second = rangeBox[2];
+  q1.first = rangeBox[1];
+  q1.second = rangeBox[3];
 
-  q1.first = nodeList_[nodeId].rangeBox_.first.second;
-  q1.second = nodeList_[nodeId].rangeBox_.second.second;
+  if(segmentIntersection(p0, p1, q0, q1))
+    return true;
 
-  if(segmentIntersection(p0, p1, q0, q1)) {
-    if(nodeList_[nodeId].childList_.size()) {
-      for(SimplexId i = 0; i < (SimplexId)nodeList_[nodeId].childList_.size();
-          i++) {
-        rangeSegmentQuery(p0, p1, nodeList_[nodeId].childList_[i], cellList);
-      }
-      return 0;
-    } else {
-      // terminal leaf
-      // return our cells
-      {
-        stringstream msg;
-        msg << "[RangeDrivenOctree] Node #" << nodeId << " returns its "
-            << nodeList_[nodeId].cellList_.size() << " cell(s)." << endl;
-        dMsg(cout, msg.str(), 10);
-      }
-      cellList.insert(cellList.end(), nodeList_[nodeId].cellList_.begin(),
-                      nodeList_[nodeId].cellList_.end());
-      queryResultNumber_++;
-      return 0;
-    }
+  // top segment (min, max) (max, max)
+  q0.first = rangeBox[0];
+  q0.second = rangeBox[3];
+  q1.first = rangeBox[1];
+  q1.second = rangeBox[3];
+
+  if(segmentIntersection(p0, p1, q0, q1))
+    return true;
+
+  // left segment (min, min) (min, max)
+  q0.first = rangeBox[0];
+  q0.second = rangeBox[2];
+  q1.first = rangeBox[0];
+  q1.second = rangeBox[3];
+
+  if(segmentIntersection(p0, p1, q0, q1))
+    return true;
+
+  // is the segment completely included in the range bounding box?
+  if((p0.first >= rangeBox[0]) && (p0.first < rangeBox[1])
+     && (p0.second >= rangeBox[2]) && (p0.second < rangeBox[3])) {
+    // p0 is in there
+    return true;
+  }
+  if((p1.first >= rangeBox[0]) && (p1.first < rangeBox[1])
+     && (p1.second >= rangeBox[2]) && (p1.second < rangeBox[3])) {
+    // p1 is in there
+    return true;
   }
 
-  // top segment (min, max) (max, max)
-  q0.first = nodeList_[nodeId].rangeBox_.first.first;
-  q0.second = nodeList_[nodeId].rangeBox_.second.second;
+  return false;
+}
 
-  q1.first = nodeList_[nodeId].rangeBox_.first.second;
-  q1.second = nodeList_[nodeId].rangeBox_.second.second;
+int RangeDrivenOctree::save(const string &fileName,
+                            const unsigned long long &inputHash) const {
 
-  if(segmentIntersection(p0, p1, q0, q1)) {
-    if(nodeList_[nodeId].childList_.size()) {
-      for(SimplexId i = 0; i < (SimplexId)nodeList_[nodeId].childList_.size();
-          i++) {
-        rangeSegmentQuery(p0, p1, nodeList_[nodeId].childList_[i], cellList);
-      }
-      return 0;
-    } else {
-      // terminal leaf
-      // return our cells
-      {
-        stringstream msg;
-        msg << "[RangeDrivenOctree] Node #" << nodeId << " returns its "
-            << nodeList_[nodeId].cellList_.size() << " cell(s)." << endl;
-        dMsg(cout, msg.str(), 10);
-      }
-      cellList.insert(cellList.end(), nodeList_[nodeId].cellList_.begin(),
-                      nodeList_[nodeId].cellList_.end());
-      queryResultNumber_++;
-      return 0;
-    }
+  Timer t;
+
+  if(nodeList_.empty())
+    return -1;
+
+  ofstream f(fileName.data(), ios::out | ios::binary);
+  if(!f) {
+    stringstream msg;
+    msg << "[RangeDrivenOctree] Could not write file `" << fileName << "'."
+        << endl;
+    dMsg(cerr, msg.str(), fatalMsg);
+    return -2;
   }
 
-  // left segment (min, min) (min, max)
-  q0.first = nodeList_[nodeId].rangeBox_.first.first;
-  q0.second = nodeList_[nodeId].rangeBox_.second.first;
+  const char magicBytes[] = "TTKRDO02";
+  int idSize = sizeof(SimplexId);
+  SimplexId nodeNumber = nodeList_.size();
+
+  f.write(magicBytes, 8);
+  f.write((const char *)&idSize, sizeof(idSize));
+  f.write((const char *)&cellNumber_, sizeof(cellNumber_));
+  f.write((const char *)&vertexNumber_, sizeof(vertexNumber_));
+  f.write((const char *)&inputHash, sizeof(inputHash));
+  f.write((const char *)&leafMinimumCellNumber_,
+          sizeof(leafMinimumCellNumber_));
+  f.write((const char *)&leafMinimumDomainVolumeRatio_,
+          sizeof(leafMinimumDomainVolumeRatio_));
+  f.write((const char *)&leafMinimumRangeAreaRatio_,
+          sizeof(leafMinimumRangeAreaRatio_));
+  f.write((const char *)&domainVolume_, sizeof(domainVolume_));
+  f.write((const char *)&rangeArea_, sizeof(rangeArea_));
+  f.write((const char *)&nodeNumber, sizeof(nodeNumber));
+  f.write((const char *)nodeList_.data(), nodeNumber * sizeof(OctreeNode));
+  f.write(
+    (const char *)cellBuffer_.data(), cellBuffer_.size() * sizeof(SimplexId));
+
+  if(!f) {
+    stringstream msg;
+    msg << "[RangeDrivenOctree] Could not write file `" << fileName << "'."
+        << endl;
+    dMsg(cerr, msg.str(), fatalMsg);
+    return -3;
+  }
 
-  q1.first = nodeList_[nodeId].rangeBox_.first.first;
-  q1.second = nodeList_[nodeId].rangeBox_.second.second;
+  {
+    stringstream msg;
+    msg << "[RangeDrivenOctree] Octree saved to `" << fileName << "' in "
+        << t.getElapsedTime() << " s." << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
 
-  if(segmentIntersection(p0, p1, q0, q1)) {
-    if(nodeList_[nodeId].childList_.size()) {
-      for(SimplexId i = 0; i < (SimplexId)nodeList_[nodeId].childList_.size();
-          i++) {
-        rangeSegmentQuery(p0, p1, nodeList_[nodeId].childList_[i], cellList);
-      }
-      return 0;
-    } else {
-      // terminal leaf
-      // return our cells
-      {
-        stringstream msg;
-        msg << "[RangeDrivenOctree] Node #" << nodeId << " returns its "
-            << nodeList_[nodeId].cellList_.size() << " cell(s)." << endl;
-        dMsg(cout, msg.str(), 10);
+  return 0;
+}
+
+bool RangeDrivenOctree::splitNode(const OctreeNode &node,
+                                  const int &depth,
+                                  const vector<float> &cellMinPoints,
+                                  const vector<double> &cellRangeBoxes,
+                                  vector<unsigned char> &childIds,
+                                  vector<SimplexId> &scratch,
+                                  OctreeNode *children,
+                                  const bool &parallel) {
+
+  const float *domainBox = node.domainBox_;
+  const double *rangeBox = node.rangeBox_;
+
+  float rangeArea = (rangeBox[1] - rangeBox[0]) * (rangeBox[3] - rangeBox[2]);
+
+  float domainVolume = (domainBox[1] - domainBox[0])
+                       * (domainBox[3] - domainBox[2])
+                       * (domainBox[5] - domainBox[4]);
+
+  if(!((node.cellEnd_ - node.cellBegin_ > leafMinimumCellNumber_)
+       && (rangeArea > leafMinimumRangeAreaRatio_ * rangeArea_)
+       && (domainVolume > leafMinimumDomainVolumeRatio_ * domainVolume_)
+       && (depth < maxDepth_))) {
+    // leaf
+    return false;
+  }
+
+  float mid[3];
+  for(int i = 0; i < 3; i++) {
+    mid[i] = domainBox[2 * i]
+             + (domainBox[2 * i + 1] - domainBox[2 * i]) / 2.0;
+  }
+
+  // child i is on the upper side of the x (resp. y, z) mid-plane
+  // if its 3rd (resp. 2nd, 1st) bit is set:
+  // 0 - - -, 1 - - +, 2 - + -, 3 - + +, 4 + - -, 5 + - +, 6 + + -, 7 + + +
+  for(int i = 0; i < 8; i++) {
+    for(int j = 0; j < 3; j++) {
+      if(i & (4 >> j)) {
+        children[i].domainBox_[2 * j] = mid[j];
+        children[i].domainBox_[2 * j + 1] = domainBox[2 * j + 1];
+      } else {
+        children[i].domainBox_[2 * j] = domainBox[2 * j];
+        children[i].domainBox_[2 * j + 1] = mid[j];
       }
-      cellList.insert(cellList.end(), nodeList_[nodeId].cellList_.begin(),
-                      nodeList_[nodeId].cellList_.end());
-      queryResultNumber_++;
-      return 0;
     }
+    for(int j = 0; j < 4; j++) {
+      children[i].rangeBox_[j] = 0;
+    }
+    children[i].childBegin_ = -1;
   }
 
-  // is the segment completely included in the range bounding box?
-  if((p0.first >= nodeList_[nodeId].rangeBox_.first.first)
-     && (p0.first < nodeList_[nodeId].rangeBox_.first.second)
-     && (p0.second >= nodeList_[nodeId].rangeBox_.second.first)
-     && (p0.second < nodeList_[nodeId].rangeBox_.second.second)) {
+  // classify the cells
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) if(parallel)
+#endif
+  for(SimplexId i = node.cellBegin_; i < node.cellEnd_; i++) {
 
-    // p0 is in there
-    if(nodeList_[nodeId].childList_.size()) {
-      for(SimplexId i = 0; i < (SimplexId)nodeList_[nodeId].childList_.size();
-          i++) {
-        rangeSegmentQuery(p0, p1, nodeList_[nodeId].childList_[i], cellList);
-      }
-      return 0;
-    } else {
-      // terminal leaf
-      // return our cells
-      {
-        stringstream msg;
-        msg << "[RangeDrivenOctree] Node #" << nodeId << " returns its "
-            << nodeList_[nodeId].cellList_.size() << " cell(s)." << endl;
-        dMsg(cout, msg.str(), 10);
+    const float *p = &(cellMinPoints[3 * cellBuffer_[i]]);
+
+    unsigned char childId = 0;
+
+    for(int j = 0; j < 8; j++) {
+      const float *childBox = children[j].domainBox_;
+      if((p[0] >= childBox[0]) && (p[0] < childBox[1])
+         && (p[1] >= childBox[2]) && (p[1] < childBox[3])
+         && (p[2] >= childBox[4]) && (p[2] < childBox[5])) {
+        childId = j;
+        break;
       }
-      cellList.insert(cellList.end(), nodeList_[nodeId].cellList_.begin(),
-                      nodeList_[nodeId].cellList_.end());
-      queryResultNumber_++;
-      return 0;
     }
+
+    childIds[i] = childId;
   }
-  if((p1.first >= nodeList_[nodeId].rangeBox_.first.first)
-     && (p1.first < nodeList_[nodeId].rangeBox_.first.second)
-     && (p1.second >= nodeList_[nodeId].rangeBox_.second.first)
-     && (p1.second < nodeList_[nodeId].rangeBox_.second.second)) {
 
-    // p1 is in there
-    if(nodeList_[nodeId].childList_.size()) {
-      for(SimplexId i = 0; i < (SimplexId)nodeList_[nodeId].childList_.size();
-          i++) {
-        rangeSegmentQuery(p0, p1, nodeList_[nodeId].childList_[i], cellList);
-      }
-      return 0;
+  // stable counting sort of the node's cells by child
+  SimplexId childOffsets[9];
+  for(int i = 0; i < 9; i++)
+    childOffsets[i] = 0;
+  for(SimplexId i = node.cellBegin_; i < node.cellEnd_; i++)
+    childOffsets[childIds[i] + 1]++;
+  childOffsets[0] = node.cellBegin_;
+  for(int i = 1; i < 9; i++)
+    childOffsets[i] += childOffsets[i - 1];
+
+  for(int i = 0; i < 8; i++) {
+    children[i].cellBegin_ = childOffsets[i];
+    children[i].cellEnd_ = childOffsets[i];
+  }
+
+  for(SimplexId i = node.cellBegin_; i < node.cellEnd_; i++) {
+
+    OctreeNode &child = children[childIds[i]];
+    const SimplexId cellId = cellBuffer_[i];
+    const double *cellRangeBox = &(cellRangeBoxes[4 * cellId]);
+
+    // update child's range box
+    if(child.cellEnd_ == child.cellBegin_) {
+      for(int j = 0; j < 4; j++)
+        child.rangeBox_[j] = cellRangeBox[j];
     } else {
-      // terminal leaf
-      // return our cells
-      {
-        stringstream msg;
-        msg << "[RangeDrivenOctree] Node #" << nodeId << " returns its "
-            << nodeList_[nodeId].cellList_.size() << " cell(s)." << endl;
-        dMsg(cout, msg.str(), 10);
-      }
-      cellList.insert(cellList.end(), nodeList_[nodeId].cellList_.begin(),
-                      nodeList_[nodeId].cellList_.end());
-      queryResultNumber_++;
-      return 0;
+      if(cellRangeBox[0] < child.rangeBox_[0])
+        child.rangeBox_[0] = cellRangeBox[0];
+      if(cellRangeBox[1] > child.rangeBox_[1])
+        child.rangeBox_[1] = cellRangeBox[1];
+      if(cellRangeBox[2] < child.rangeBox_[2])
+        child.rangeBox_[2] = cellRangeBox[2];
+      if(cellRangeBox[3] > child.rangeBox_[3])
+        child.rangeBox_[3] = cellRangeBox[3];
     }
+
+    scratch[child.cellEnd_++] = cellId;
   }
 
-  return 0;
+  for(SimplexId i = node.cellBegin_; i < node.cellEnd_; i++)
+    cellBuffer_[i] = scratch[i];
+
+  return true;
 }
 
 int RangeDrivenOctree::statNode(const SimplexId &nodeId, ostream &stream) {
 
+  const OctreeNode &node = nodeList_[nodeId];
+
   stream << "[RangeDrivenOctree]" << endl;
   stream << "[RangeDrivenOctree] Node #" << nodeId << endl;
-  stream << "[RangeDrivenOctree]   Domain box: ["
-         << nodeList_[nodeId].domainBox_[0].first << " "
-         << nodeList_[nodeId].domainBox_[0].second << "] ["
-         << nodeList_[nodeId].domainBox_[1].first << " "
-         << nodeList_[nodeId].domainBox_[1].second << "] ["
-         << nodeList_[nodeId].domainBox_[2].first << " "
-         << nodeList_[nodeId].domainBox_[2].second << "] "
+  stream << "[RangeDrivenOctree]   Domain box: [" << node.domainBox_[0] << " "
+         << node.domainBox_[1] << "] [" << node.domainBox_[2] << " "
+         << node.domainBox_[3] << "] [" << node.domainBox_[4] << " "
+         << node.domainBox_[5] << "] "
          << " volume="
-         << (nodeList_[nodeId].domainBox_[0].second
-             - nodeList_[nodeId].domainBox_[0].first)
-              * (nodeList_[nodeId].domainBox_[1].second
-                 - nodeList_[nodeId].domainBox_[1].first)
-              * (nodeList_[nodeId].domainBox_[2].second
-                 - nodeList_[nodeId].domainBox_[2].first)
+         << (node.domainBox_[1] - node.domainBox_[0])
+              * (node.domainBox_[3] - node.domainBox_[2])
+              * (node.domainBox_[5] - node.domainBox_[4])
          << " threshold=" << leafMinimumDomainVolumeRatio_ * domainVolume_
          << endl;
-  stream << "[RangeDrivenOctree]   Range box: ["
-         << nodeList_[nodeId].rangeBox_.first.first << " "
-         << nodeList_[nodeId].rangeBox_.first.second << "] ["
-         << nodeList_[nodeId].rangeBox_.second.first << " "
-         << nodeList_[nodeId].rangeBox_.second.second << "] "
+  stream << "[RangeDrivenOctree]   Range box: [" << node.rangeBox_[0] << " "
+         << node.rangeBox_[1] << "] [" << node.rangeBox_[2] << " "
+         << node.rangeBox_[3] << "] "
          << " area="
-         << (nodeList_[nodeId].rangeBox_.first.second
-             - nodeList_[nodeId].rangeBox_.first.first)
-              * (nodeList_[nodeId].rangeBox_.second.second
-                 - nodeList_[nodeId].rangeBox_.second.first)
+         << (node.rangeBox_[1] - node.rangeBox_[0])
+              * (node.rangeBox_[3] - node.rangeBox_[2])
          << " threshold=" << leafMinimumRangeAreaRatio_ * rangeArea_ << endl;
   stream << "[RangeDrivenOctree] Number of cells: "
-         << nodeList_[nodeId].cellList_.size() << endl;
+         << (isLeaf(node) ? node.cellEnd_ - node.cellBegin_ : 0) << endl;
 
   return 0;
 }
@@ -317,20 +468,19 @@ int RangeDrivenOctree::stats(ostream &stream) {
   SimplexId maxCellId = 0;
 
   for(SimplexId i = 0; i < (SimplexId)nodeList_.size(); i++) {
-    if(!nodeList_[i].childList_.size()) {
+    if(isLeaf(nodeList_[i])) {
       // leaf
       leafNumber++;
-      if(nodeList_[i].cellList_.size()) {
+      SimplexId cellNumber = nodeList_[i].cellEnd_ - nodeList_[i].cellBegin_;
+      if(cellNumber) {
         nonEmptyLeafNumber++;
-        storedCellNumber += nodeList_[i].cellList_.size();
-
-        averageCellNumber += nodeList_[i].cellList_.size();
-        if((minCellNumber == -1)
-           || ((SimplexId)nodeList_[i].cellList_.size() < minCellNumber))
-          minCellNumber = nodeList_[i].cellList_.size();
-        if((maxCellNumber == -1)
-           || ((SimplexId)nodeList_[i].cellList_.size() > maxCellNumber)) {
-          maxCellNumber = nodeList_[i].cellList_.size();
+        storedCellNumber += cellNumber;
+
+        averageCellNumber += cellNumber;
+        if((minCellNumber == -1) || (cellNumber < minCellNumber))
+          minCellNumber = cellNumber;
+        if((maxCellNumber == -1) || (cellNumber > maxCellNumber)) {
+          maxCellNumber = cellNumber;
           maxCellId = i;
         }
       }
@@ -354,7 +504,8 @@ int RangeDrivenOctree::stats(ostream &stream) {
 
   if(debugLevel_ > 5) {
     for(SimplexId i = 0; i < (SimplexId)nodeList_.size(); i++) {
-      if(nodeList_[i].cellList_.size())
+      if((isLeaf(nodeList_[i]))
+         && (nodeList_[i].cellEnd_ > nodeList_[i].cellBegin_))
         statNode(i, stream);
     }
   }
@@ -9,6 +9,13 @@
 /// This class accelerates range-driven queries in bivariate volumetric data.
 /// This class is typically used to accelerate fiber surface computation.
 ///
+/// The octree is built in parallel, level by level, into a contiguous array
+/// of nodes whose leaves reference ranges of a single flat cell buffer.
+/// Range segment queries are therefore non-recursive and do not allocate
+/// memory (beyond the growth of the output list). Octrees can be saved to
+/// disk with save() and re-loaded with load() for the same input (domain
+/// and bivariate field) across sessions.
+///
 /// \b Related \b publication \n
 /// "Fast and Exact Fiber Surface Extraction for Tetrahedral Meshes" \n
 /// Pavol Klacansky, Julien Tierny, Hamish Carr, Zhao Geng \n
@@ -19,6 +26,9 @@
 #ifndef _RANGE_DRIVEN_OCTREE_H
 #define _RANGE_DRIVEN_OCTREE_H
 
+// standard includes
+#include <string>
+
 // base code includes
 #include <Triangulation.h>
 #include <Wrapper.h>
@@ -44,10 +54,28 @@ namespace ttk {
     int getTet2NodeMap(std::vector<SimplexId> &map,
                        const bool &forSegmentation = false) const;
 
+    /// Load an octree previously saved with save().
+    /// The octree is only loaded if it has been computed on the current
+    /// input (same number of vertices and cells, same point coordinates,
+    /// cell connectivity, u and v fields).
+    /// \param fileName Path to the octree file.
+    /// \return Returns 0 upon success, negative values otherwise (in which
+    /// case the octree is left empty).
+    template <class dataTypeU, class dataTypeV>
+    inline int load(const std::string &fileName);
+
     int rangeSegmentQuery(const std::pair<double, double> &p0,
                           const std::pair<double, double> &p1,
                           std::vector<SimplexId> &cellList) const;
 
+    /// Save the octree to disk, for later re-use with load().
+    /// The input hash checked by load() is only computed here, so that
+    /// build() does not pay for it when no octree file is used.
+    /// \param fileName Path to the octree file.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class dataTypeU, class dataTypeV>
+    inline int save(const std::string &fileName) const;
+
     inline void setCellList(const SimplexId *cellList) {
       cellList_ = cellList;
     }
@@ -90,44 +118,62 @@ namespace ttk {
     int statNode(const SimplexId &nodeId, std::ostream &stream);
 
   protected:
+    // plain old data, to be written to and read from disk as is
     class OctreeNode {
 
     public:
-      std::pair<std::pair<double, double>, std::pair<double, double>> rangeBox_;
-      std::vector<SimplexId> cellList_;
-      std::vector<SimplexId> childList_;
-      std::vector<std::pair<float, float>> domainBox_;
+      // uMin, uMax, vMin, vMax
+      double rangeBox_[4];
+      // xMin, xMax, yMin, yMax, zMin, zMax
+      float domainBox_[6];
+      // range of the node's cells in cellBuffer_ (leaves only)
+      SimplexId cellBegin_, cellEnd_;
+      // index of the first of the 8 (contiguous) children, -1 for leaves
+      SimplexId childBegin_;
     };
 
+    // bounds the depth of the octree, and hence the traversal stack size
+    static const int maxDepth_ = 64;
+
     template <class dataTypeU, class dataTypeV>
-    int buildNode(const std::vector<SimplexId> &cellList,
-                  const std::vector<std::pair<float, float>> &domainBox,
-                  const std::pair<std::pair<double, double>,
-                                  std::pair<double, double>> &rangeBox,
-                  SimplexId &nodeId);
+    inline unsigned long long computeInputHash() const;
 
-    int rangeSegmentQuery(const std::pair<double, double> &p0,
-                          const std::pair<double, double> &p1,
-                          const SimplexId &nodeId,
-                          std::vector<SimplexId> &cellList) const;
+    inline bool isLeaf(const OctreeNode &node) const {
+      return node.childBegin_ == -1;
+    }
+
+    int load(const std::string &fileName, const unsigned long long &inputHash);
+
+    int save(const std::string &fileName,
+             const unsigned long long &inputHash) const;
+
+    bool rangeSegmentIntersection(const std::pair<double, double> &p0,
+                                  const std::pair<double, double> &p1,
+                                  const OctreeNode &node) const;
 
     bool segmentIntersection(const std::pair<double, double> &p0,
                              const std::pair<double, double> &p1,
                              const std::pair<double, double> &q0,
                              const std::pair<double, double> &q1) const;
 
+    bool splitNode(const OctreeNode &node,
+                   const int &depth,
+                   const std::vector<float> &cellMinPoints,
+                   const std::vector<double> &cellRangeBoxes,
+                   std::vector<unsigned char> &childIds,
+                   std::vector<SimplexId> &scratch,
+                   OctreeNode *children,
+                   const bool &parallel);
+
     const void *u_;
     const void *v_;
     const float *pointList_;
     const SimplexId *cellList_;
     float domainVolume_, leafMinimumDomainVolumeRatio_,
       leafMinimumRangeAreaRatio_, rangeArea_;
-    SimplexId cellNumber_, vertexNumber_, leafMinimumCellNumber_, rootId_;
-    mutable SimplexId queryResultNumber_;
+    SimplexId cellNumber_, vertexNumber_, leafMinimumCellNumber_;
     std::vector<OctreeNode> nodeList_;
-    std::vector<std::vector<std::pair<float, float>>> cellDomainBox_;
-    std::vector<std::pair<std::pair<double, double>, std::pair<double, double>>>
-      cellRangeBox_;
+    std::vector<SimplexId> cellBuffer_;
     const Triangulation *triangulation_;
   };
 } // namespace ttk
@@ -141,8 +187,8 @@ int ttk::RangeDrivenOctree::build() {
   Timer t;
   Memory m;
 
-  dataTypeU *u = (dataTypeU *)u_;
-  dataTypeV *v = (dataTypeV *)v_;
+  const dataTypeU *u = (const dataTypeU *)u_;
+  const dataTypeV *v = (const dataTypeV *)v_;
 
   if(triangulation_) {
     cellNumber_ = triangulation_->getNumberOfCells();
@@ -152,9 +198,12 @@ int ttk::RangeDrivenOctree::build() {
     vertexNumber_ = triangulation_->getNumberOfVertices();
   }
 
-  cellDomainBox_.resize(cellNumber_, std::vector<std::pair<float, float>>(3));
+  flush();
 
-  cellRangeBox_.resize(cellNumber_);
+  // lower corner of the domain bounding box and range bounding box
+  // (uMin, uMax, vMin, vMax) of each cell
+  std::vector<float> cellMinPoints(3 * cellNumber_);
+  std::vector<double> cellRangeBoxes(4 * cellNumber_);
 
   // WARNING: assuming tets only here
 #ifdef TTK_ENABLE_OPENMP
@@ -162,9 +211,11 @@ int ttk::RangeDrivenOctree::build() {
 #endif
   for(SimplexId i = 0; i < cellNumber_; i++) {
 
+    float *minPoint = &(cellMinPoints[3 * i]);
+    double *rangeBox = &(cellRangeBoxes[4 * i]);
+
     for(int j = 0; j < 3; j++) {
-      cellDomainBox_[i][j].first = FLT_MAX;
-      cellDomainBox_[i][j].second = -FLT_MAX;
+      minPoint[j] = FLT_MAX;
     }
 
     const SimplexId *cell = NULL;
@@ -174,7 +225,6 @@ int ttk::RangeDrivenOctree::build() {
 
     for(int j = 0; j < 4; j++) {
 
-      // update the domain bounding box for that tet
       SimplexId vertexId = 0;
 
       if(triangulation_) {
@@ -192,59 +242,41 @@ int ttk::RangeDrivenOctree::build() {
         p[2] = pointList_[3 * vertexId + 2];
       }
 
-      // update x-range
-      if(p[0] < cellDomainBox_[i][0].first)
-        cellDomainBox_[i][0].first = p[0];
-      if(p[0] > cellDomainBox_[i][0].second)
-        cellDomainBox_[i][0].second = p[0];
-
-      // update y-range
-      if(p[1] < cellDomainBox_[i][1].first)
-        cellDomainBox_[i][1].first = p[1];
-      if(p[1] > cellDomainBox_[i][1].second)
-        cellDomainBox_[i][1].second = p[1];
-
-      // update z-range
-      if(p[2] < cellDomainBox_[i][2].first)
-        cellDomainBox_[i][2].first = p[2];
-      if(p[2] > cellDomainBox_[i][2].second)
-        cellDomainBox_[i][2].second = p[2];
+      for(int k = 0; k < 3; k++) {
+        if(p[k] < minPoint[k])
+          minPoint[k] = p[k];
+      }
 
       // update the range bounding box
       if(!j) {
-        cellRangeBox_[i].first.first = u[vertexId];
-        cellRangeBox_[i].first.second = u[vertexId];
-
-        cellRangeBox_[i].second.first = v[vertexId];
-        cellRangeBox_[i].second.second = v[vertexId];
+        rangeBox[0] = rangeBox[1] = u[vertexId];
+        rangeBox[2] = rangeBox[3] = v[vertexId];
       } else {
-
-        // update u
-        if(u[vertexId] < cellRangeBox_[i].first.first)
-          cellRangeBox_[i].first.first = u[vertexId];
-        if(u[vertexId] > cellRangeBox_[i].first.second)
-          cellRangeBox_[i].first.second = u[vertexId];
-
-        // update v
-        if(v[vertexId] < cellRangeBox_[i].second.first)
-          cellRangeBox_[i].second.first = v[vertexId];
-        if(v[vertexId] > cellRangeBox_[i].second.second)
-          cellRangeBox_[i].second.second = v[vertexId];
+        if(u[vertexId] < rangeBox[0])
+          rangeBox[0] = u[vertexId];
+        if(u[vertexId] > rangeBox[1])
+          rangeBox[1] = u[vertexId];
+        if(v[vertexId] < rangeBox[2])
+          rangeBox[2] = v[vertexId];
+        if(v[vertexId] > rangeBox[3])
+          rangeBox[3] = v[vertexId];
       }
     }
   }
 
-  std::vector<SimplexId> domain(cellNumber_);
-  for(SimplexId i = 0; i < cellNumber_; i++)
-    domain[i] = i;
-
   // get global bBoxes
-  std::vector<std::pair<float, float>> domainBox(3);
-  std::pair<std::pair<double, double>, std::pair<double, double>> rangeBox;
+  float xMin = FLT_MAX, yMin = FLT_MAX, zMin = FLT_MAX;
+  float xMax = -FLT_MAX, yMax = -FLT_MAX, zMax = -FLT_MAX;
+  double uMin = DBL_MAX, vMin = DBL_MAX;
+  double uMax = -DBL_MAX, vMax = -DBL_MAX;
 
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) \
+  reduction(min : xMin, yMin, zMin, uMin, vMin)     \
+  reduction(max : xMax, yMax, zMax, uMax, vMax)
+#endif
   for(SimplexId i = 0; i < vertexNumber_; i++) {
 
-    // domain one
     float p[3];
     if(triangulation_) {
       triangulation_->getVertexPoint(i, p[0], p[1], p[2]);
@@ -254,38 +286,21 @@ int ttk::RangeDrivenOctree::build() {
       p[2] = pointList_[3 * i + 2];
     }
 
-    for(int j = 0; j < 3; j++) {
-      if(!i) {
-        domainBox[j].first = domainBox[j].second = p[j];
-      } else {
-        if(p[j] < domainBox[j].first)
-          domainBox[j].first = p[j];
-        if(p[j] > domainBox[j].second)
-          domainBox[j].second = p[j];
-      }
-    }
-
-    if(!i) {
-      rangeBox.first.first = rangeBox.first.second = u[i];
-      rangeBox.second.first = rangeBox.second.second = v[i];
-    } else {
-      if(u[i] < rangeBox.first.first)
-        rangeBox.first.first = u[i];
-      if(u[i] > rangeBox.first.second)
-        rangeBox.first.second = u[i];
-
-      if(v[i] < rangeBox.second.first)
-        rangeBox.second.first = v[i];
-      if(v[i] > rangeBox.second.second)
-        rangeBox.second.second = v[i];
-    }
+    xMin = std::min(xMin, p[0]);
+    xMax = std::max(xMax, p[0]);
+    yMin = std::min(yMin, p[1]);
+    yMax = std::max(yMax, p[1]);
+    zMin = std::min(zMin, p[2]);
+    zMax = std::max(zMax, p[2]);
+
+    uMin = std::min(uMin, (double)u[i]);
+    uMax = std::max(uMax, (double)u[i]);
+    vMin = std::min(vMin, (double)v[i]);
+    vMax = std::max(vMax, (double)v[i]);
   }
 
-  rangeArea_ = (rangeBox.first.second - rangeBox.first.first)
-               * (rangeBox.second.second - rangeBox.second.first);
-  domainVolume_ = (domainBox[0].second - domainBox[0].first)
-                  * (domainBox[1].second - domainBox[1].first)
-                  * (domainBox[2].second - domainBox[2].first);
+  rangeArea_ = (uMax - uMin) * (vMax - vMin);
+  domainVolume_ = (xMax - xMin) * (yMax - yMin) * (zMax - zMin);
 
   // special case for tets obtained from regular grid subdivision (assuming 6)
   if(leafMinimumCellNumber_ < 6)
@@ -299,12 +314,79 @@ int ttk::RangeDrivenOctree::build() {
         << leafMinimumRangeAreaRatio_ << std::endl;
     dMsg(std::cout, msg.str(), 4);
   }
-  buildNode<dataTypeU, dataTypeV>(domain, domainBox, rangeBox, rootId_);
+
+  // root node
+  nodeList_.resize(1);
+  nodeList_[0].rangeBox_[0] = uMin;
+  nodeList_[0].rangeBox_[1] = uMax;
+  nodeList_[0].rangeBox_[2] = vMin;
+  nodeList_[0].rangeBox_[3] = vMax;
+  nodeList_[0].domainBox_[0] = xMin;
+  nodeList_[0].domainBox_[1] = xMax;
+  nodeList_[0].domainBox_[2] = yMin;
+  nodeList_[0].domainBox_[3] = yMax;
+  nodeList_[0].domainBox_[4] = zMin;
+  nodeList_[0].domainBox_[5] = zMax;
+  nodeList_[0].cellBegin_ = 0;
+  nodeList_[0].cellEnd_ = cellNumber_;
+  nodeList_[0].childBegin_ = -1;
+
+  cellBuffer_.resize(cellNumber_);
+  for(SimplexId i = 0; i < cellNumber_; i++)
+    cellBuffer_[i] = i;
+
+  // level by level construction: the nodes of a given level are split in
+  // parallel (or, for the top levels, one after the other with parallel
+  // cell classification), then their children are appended contiguously.
+  std::vector<unsigned char> childIds(cellNumber_);
+  std::vector<SimplexId> scratch(cellNumber_);
+  std::vector<SimplexId> frontier(1, 0), nextFrontier;
+  std::vector<OctreeNode> children;
+  std::vector<char> isSplit;
+
+  int depth = 0;
+  while(frontier.size()) {
+
+    children.resize(8 * frontier.size());
+    isSplit.resize(frontier.size());
+
+    if((SimplexId)frontier.size() >= threadNumber_) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_) schedule(dynamic)
+#endif
+      for(SimplexId i = 0; i < (SimplexId)frontier.size(); i++) {
+        isSplit[i] = splitNode(nodeList_[frontier[i]], depth, cellMinPoints,
+                               cellRangeBoxes, childIds, scratch,
+                               &(children[8 * i]), false);
+      }
+    } else {
+      for(SimplexId i = 0; i < (SimplexId)frontier.size(); i++) {
+        isSplit[i] = splitNode(nodeList_[frontier[i]], depth, cellMinPoints,
+                               cellRangeBoxes, childIds, scratch,
+                               &(children[8 * i]), true);
+      }
+    }
+
+    nextFrontier.clear();
+    for(SimplexId i = 0; i < (SimplexId)frontier.size(); i++) {
+      if(isSplit[i]) {
+        nodeList_[frontier[i]].childBegin_ = nodeList_.size();
+        for(int j = 0; j < 8; j++) {
+          nextFrontier.push_back(nodeList_.size());
+          nodeList_.push_back(children[8 * i + j]);
+        }
+      }
+    }
+
+    frontier.swap(nextFrontier);
+    depth++;
+  }
 
   {
     std::stringstream msg;
-    msg << "[RangeDrivenOctree] Octree built in " << t.getElapsedTime() << " s."
-        << std::endl;
+    msg << "[RangeDrivenOctree] Octree built in " << t.getElapsedTime()
+        << " s. (" << nodeList_.size() << " nodes, depth " << depth << ", "
+        << threadNumber_ << " thread(s))" << std::endl;
     dMsg(std::cout, msg.str(), 2);
   }
   {
@@ -322,184 +404,70 @@ int ttk::RangeDrivenOctree::build() {
 }
 
 template <class dataTypeU, class dataTypeV>
-int ttk::RangeDrivenOctree::buildNode(
-  const std::vector<SimplexId> &cellList,
-  const std::vector<std::pair<float, float>> &domainBox,
-  const std::pair<std::pair<double, double>, std::pair<double, double>>
-    &rangeBox,
-  SimplexId &nodeId) {
-
-  nodeId = nodeList_.size();
+unsigned long long ttk::RangeDrivenOctree::computeInputHash() const {
 
-  nodeList_.resize(nodeList_.size() + 1);
+  // FNV-1a hash of the point coordinates, the cell connectivity and the u
+  // and v fields
+  unsigned long long hash = 14695981039346656037ULL;
 
-  nodeList_.back().rangeBox_ = rangeBox;
-  nodeList_.back().domainBox_ = domainBox;
+  const auto hashBytes = [&hash](const void *data, const size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for(size_t i = 0; i < size; i++) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+    }
+  };
 
-  float rangeArea = (rangeBox.first.second - rangeBox.first.first)
-                    * (rangeBox.second.second - rangeBox.second.first);
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    float p[3];
+    if(triangulation_) {
+      triangulation_->getVertexPoint(i, p[0], p[1], p[2]);
+    } else {
+      p[0] = pointList_[3 * i];
+      p[1] = pointList_[3 * i + 1];
+      p[2] = pointList_[3 * i + 2];
+    }
+    hashBytes(p, sizeof(p));
+  }
 
-  float domainVolume = (domainBox[0].second - domainBox[0].first)
-                       * (domainBox[1].second - domainBox[1].first)
-                       * (domainBox[2].second - domainBox[2].first);
+  for(SimplexId i = 0; i < cellNumber_; i++) {
+    SimplexId cell[4];
+    for(int j = 0; j < 4; j++) {
+      if(triangulation_) {
+        triangulation_->getCellVertex(i, j, cell[j]);
+      } else {
+        cell[j] = cellList_[5 * i + 1 + j];
+      }
+    }
+    hashBytes(cell, sizeof(cell));
+  }
 
-  if(((SimplexId)cellList.size() > leafMinimumCellNumber_)
-     && (rangeArea > leafMinimumRangeAreaRatio_ * rangeArea_)
-     && (domainVolume > leafMinimumDomainVolumeRatio_ * domainVolume_)) {
+  if(u_)
+    hashBytes(u_, vertexNumber_ * sizeof(dataTypeU));
+  if(v_)
+    hashBytes(v_, vertexNumber_ * sizeof(dataTypeV));
 
-    nodeList_.back().childList_.resize(8);
+  return hash;
+}
 
-    std::vector<std::vector<std::pair<float, float>>> childDomainBox(8);
-    for(SimplexId i = 0; i < (SimplexId)childDomainBox.size(); i++) {
-      childDomainBox[i].resize(3);
-    }
-    std::vector<std::pair<std::pair<dataTypeU, dataTypeU>,
-                          std::pair<dataTypeV, dataTypeV>>>
-      childRangeBox(8);
-    std::vector<std::vector<SimplexId>> childCellList(8);
-
-    float midX
-      = domainBox[0].first + (domainBox[0].second - domainBox[0].first) / 2.0;
-    float midY
-      = domainBox[1].first + (domainBox[1].second - domainBox[1].first) / 2.0;
-    float midZ
-      = domainBox[2].first + (domainBox[2].second - domainBox[2].first) / 2.0;
-
-    // 0 - - -
-    childDomainBox[0][0].first = domainBox[0].first;
-    childDomainBox[0][0].second = midX;
-    childDomainBox[0][1].first = domainBox[1].first;
-    childDomainBox[0][1].second = midY;
-    childDomainBox[0][2].first = domainBox[2].first;
-    childDomainBox[0][2].second = midZ;
-
-    // 1 - - +
-    childDomainBox[1][0].first = domainBox[0].first;
-    childDomainBox[1][0].second = midX;
-    childDomainBox[1][1].first = domainBox[1].first;
-    childDomainBox[1][1].second = midY;
-    childDomainBox[1][2].first = midZ;
-    childDomainBox[1][2].second = domainBox[2].second;
-
-    // 2 - + -
-    childDomainBox[2][0].first = domainBox[0].first;
-    childDomainBox[2][0].second = midX;
-    childDomainBox[2][1].first = midY;
-    childDomainBox[2][1].second = domainBox[1].second;
-    childDomainBox[2][2].first = domainBox[2].first;
-    childDomainBox[2][2].second = midZ;
-
-    // 3 - + +
-    childDomainBox[3][0].first = domainBox[0].first;
-    childDomainBox[3][0].second = midX;
-    childDomainBox[3][1].first = midY;
-    childDomainBox[3][1].second = domainBox[1].second;
-    childDomainBox[3][2].first = midZ;
-    childDomainBox[3][2].second = domainBox[2].second;
-
-    // 4 + - -
-    childDomainBox[4][0].first = midX;
-    childDomainBox[4][0].second = domainBox[0].second;
-    childDomainBox[4][1].first = domainBox[1].first;
-    childDomainBox[4][1].second = midY;
-    childDomainBox[4][2].first = domainBox[2].first;
-    childDomainBox[4][2].second = midZ;
-
-    // 5 + - +
-    childDomainBox[5][0].first = midX;
-    childDomainBox[5][0].second = domainBox[0].second;
-    childDomainBox[5][1].first = domainBox[1].first;
-    childDomainBox[5][1].second = midY;
-    childDomainBox[5][2].first = midZ;
-    childDomainBox[5][2].second = domainBox[2].second;
-
-    // 6 + + -
-    childDomainBox[6][0].first = midX;
-    childDomainBox[6][0].second = domainBox[0].second;
-    childDomainBox[6][1].first = midY;
-    childDomainBox[6][1].second = domainBox[1].second;
-    childDomainBox[6][2].first = domainBox[2].first;
-    childDomainBox[6][2].second = midZ;
-
-    // 7 + + +
-    childDomainBox[7][0].first = midX;
-    childDomainBox[7][0].second = domainBox[0].second;
-    childDomainBox[7][1].first = midY;
-    childDomainBox[7][1].second = domainBox[1].second;
-    childDomainBox[7][2].first = midZ;
-    childDomainBox[7][2].second = domainBox[2].second;
-
-    for(SimplexId i = 0; i < (SimplexId)cellList.size(); i++) {
-
-      SimplexId childId = 0;
-
-      for(int j = 0; j < 8; j++) {
-        if((cellDomainBox_[cellList[i]][0].first >= childDomainBox[j][0].first)
-           && (cellDomainBox_[cellList[i]][0].first
-               < childDomainBox[j][0].second)
-           && (cellDomainBox_[cellList[i]][1].first
-               >= childDomainBox[j][1].first)
-           && (cellDomainBox_[cellList[i]][1].first
-               < childDomainBox[j][1].second)
-           && (cellDomainBox_[cellList[i]][2].first
-               >= childDomainBox[j][2].first)
-           && (cellDomainBox_[cellList[i]][2].first
-               < childDomainBox[j][2].second)) {
-
-          childId = j;
-          break;
-        }
-      }
+template <class dataTypeU, class dataTypeV>
+int ttk::RangeDrivenOctree::load(const std::string &fileName) {
 
-      // update child's range box
-      if(childCellList[childId].empty()) {
-        childRangeBox[childId].first.first
-          = cellRangeBox_[cellList[i]].first.first;
-        childRangeBox[childId].first.second
-          = cellRangeBox_[cellList[i]].first.second;
-
-        childRangeBox[childId].second.first
-          = cellRangeBox_[cellList[i]].second.first;
-        childRangeBox[childId].second.second
-          = cellRangeBox_[cellList[i]].second.second;
-      } else {
-        if(cellRangeBox_[cellList[i]].first.first
-           < childRangeBox[childId].first.first) {
-          childRangeBox[childId].first.first
-            = cellRangeBox_[cellList[i]].first.first;
-        }
-        if(cellRangeBox_[cellList[i]].first.second
-           > childRangeBox[childId].first.second) {
-          childRangeBox[childId].first.second
-            = cellRangeBox_[cellList[i]].first.second;
-        }
+  if(triangulation_) {
+    cellNumber_ = triangulation_->getNumberOfCells();
+    vertexNumber_ = triangulation_->getNumberOfVertices();
+  }
 
-        if(cellRangeBox_[cellList[i]].second.first
-           < childRangeBox[childId].second.first) {
-          childRangeBox[childId].second.first
-            = cellRangeBox_[cellList[i]].second.first;
-        }
-        if(cellRangeBox_[cellList[i]].second.second
-           > childRangeBox[childId].second.second) {
-          childRangeBox[childId].second.second
-            = cellRangeBox_[cellList[i]].second.second;
-        }
-      }
+  return load(fileName, computeInputHash<dataTypeU, dataTypeV>());
+}
 
-      childCellList[childId].push_back(cellList[i]);
-    }
+template <class dataTypeU, class dataTypeV>
+int ttk::RangeDrivenOctree::save(const std::string &fileName) const {
 
-    for(int i = 0; i < 8; i++) {
-      buildNode<dataTypeU, dataTypeV>(childCellList[i], childDomainBox[i],
-                                      childRangeBox[i],
-                                      nodeList_[nodeId].childList_[i]);
-    }
-  } else {
-    // leaf
-    nodeList_[nodeId].cellList_ = cellList;
-  }
+  if(nodeList_.empty())
+    return -1;
 
-  return 0;
+  return save(fileName, computeInputHash<dataTypeU, dataTypeV>());
 }
 
 #endif // _RANGE_DRIVEN_OCTREE_H
@@ -30,128 +30,97 @@ int ReebSpace::compute1sheetsOnly(
   const vector<pair<SimplexId, char>> &jacobiSet,
   vector<pair<SimplexId, SimplexId>> &jacobiClassification) {
 
-  // bfs on the saddle jacobi edges only to identify saddle 1-sheets as well as
-  // saddle 0-sheets
+  // concurrent flood fills on the jacobi edges only to identify saddle
+  // 1-sheets as well as saddle 0-sheets
 
   Timer t;
 
+  const SimplexId jacobiEdgeNumber = jacobiSet.size();
+
   // alloc
   jacobiClassification.reserve(jacobiSet.size());
+  vector<SimplexId> edge2jacobi(triangulation_->getNumberOfEdges(), -1);
+  vector<SimplexId> vertexJacobiDegrees(vertexNumber_, 0);
 
-  // markup the saddle jacobi and visisted edges
-  for(SimplexId i = 0; i < (SimplexId)jacobiSet.size(); i++) {
+  // markup the saddle jacobi edges
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId i = 0; i < jacobiEdgeNumber; i++) {
     originalData_.edgeTypes_[jacobiSet[i].first] = jacobiSet[i].second;
+    edge2jacobi[jacobiSet[i].first] = i;
   }
 
-  vector<bool> visitedEdges(triangulation_->getNumberOfEdges(), false);
-
-  for(SimplexId i = 0; i < (SimplexId)jacobiSet.size(); i++) {
-
-    if(visitedEdges[jacobiSet[i].first] == false) {
-
-      SimplexId sheet1Id = originalData_.sheet1List_.size();
-      originalData_.sheet1List_.resize(originalData_.sheet1List_.size() + 1);
-      originalData_.sheet1List_.back().hasSaddleEdges_ = false;
-      originalData_.sheet1List_.back().pruned_ = false;
-
-      queue<SimplexId> edgeQueue;
-      edgeQueue.push(jacobiSet[i].first);
-
-      do {
-
-        SimplexId edgeId = edgeQueue.front();
-        edgeQueue.pop();
-
-        if(!visitedEdges[edgeId]) {
-
-          jacobiClassification.push_back(
-            pair<SimplexId, SimplexId>(edgeId, sheet1Id));
-
-          originalData_.sheet1List_.back().edgeList_.push_back(edgeId);
-          originalData_.edge2sheet1_[edgeId] = sheet1Id;
-
-          if(originalData_.edgeTypes_[edgeId] == 1) {
-            originalData_.sheet1List_.back().hasSaddleEdges_ = true;
-          }
-
-          SimplexId vertexId0 = -1;
-          triangulation_->getEdgeVertex(edgeId, 0, vertexId0);
-          SimplexId vertexId1 = -1;
-          triangulation_->getEdgeVertex(edgeId, 1, vertexId1);
-
-          SimplexId neighborNumber = 0;
-
-          SimplexId vertexEdgeNumber
-            = triangulation_->getVertexEdgeNumber(vertexId0);
-
-          for(SimplexId j = 0; j < vertexEdgeNumber; j++) {
-
-            SimplexId vertexEdgeId = -1;
-            triangulation_->getVertexEdge(vertexId0, j, vertexEdgeId);
-
-            if(originalData_.edgeTypes_[vertexEdgeId] != -1) {
-              if(vertexEdgeId != edgeId) {
-
-                neighborNumber++;
-
-                if(!visitedEdges[vertexEdgeId]) {
-                  edgeQueue.push(vertexEdgeId);
-                }
-              }
-            }
-          }
-          if((neighborNumber > 2)
-             && (originalData_.vertex2sheet0_[vertexId0] == -1)) {
-            // vertexId0 is a 0-sheet
-            // mark up the segmentation
-            originalData_.vertex2sheet0_[vertexId0]
-              = originalData_.sheet0List_.size();
-
-            originalData_.sheet0List_.resize(originalData_.sheet0List_.size()
-                                             + 1);
-            originalData_.sheet0List_.back().vertexId_ = vertexId0;
-            originalData_.sheet0List_.back().type_ = 1;
-            originalData_.sheet0List_.back().pruned_ = false;
-          }
+  for(SimplexId i = 0; i < jacobiEdgeNumber; i++) {
+    SimplexId vertexId = -1;
+    triangulation_->getEdgeVertex(jacobiSet[i].first, 0, vertexId);
+    vertexJacobiDegrees[vertexId]++;
+    triangulation_->getEdgeVertex(jacobiSet[i].first, 1, vertexId);
+    vertexJacobiDegrees[vertexId]++;
+  }
 
-          neighborNumber = 0;
-          vertexEdgeNumber = triangulation_->getVertexEdgeNumber(vertexId1);
-          for(SimplexId j = 0; j < vertexEdgeNumber; j++) {
+  vector<SimplexId> jacobiSheets;
+  SimplexId sheetNumber = 0;
+
+  computeComponents(
+    jacobiEdgeNumber, [](const SimplexId &) { return true; },
+    [&](const SimplexId &jacobiId, vector<SimplexId> &neighbors) {
+      SimplexId edgeId = jacobiSet[jacobiId].first;
+      for(int i = 0; i < 2; i++) {
+        SimplexId vertexId = -1;
+        triangulation_->getEdgeVertex(edgeId, i, vertexId);
+        SimplexId vertexEdgeNumber
+          = triangulation_->getVertexEdgeNumber(vertexId);
+        for(SimplexId j = 0; j < vertexEdgeNumber; j++) {
+          SimplexId vertexEdgeId = -1;
+          triangulation_->getVertexEdge(vertexId, j, vertexEdgeId);
+          if((vertexEdgeId != edgeId) && (edge2jacobi[vertexEdgeId] != -1))
+            neighbors.push_back(edge2jacobi[vertexEdgeId]);
+        }
+      }
+    },
+    jacobiSheets, sheetNumber);
+
+  SimplexId sheet1Offset = originalData_.sheet1List_.size();
+  originalData_.sheet1List_.resize(sheet1Offset + sheetNumber);
+  for(SimplexId i = sheet1Offset; i < sheet1Offset + sheetNumber; i++) {
+    originalData_.sheet1List_[i].hasSaddleEdges_ = false;
+    originalData_.sheet1List_[i].pruned_ = false;
+  }
 
-            SimplexId vertexEdgeId = -1;
-            triangulation_->getVertexEdge(vertexId1, j, vertexEdgeId);
+  for(SimplexId i = 0; i < jacobiEdgeNumber; i++) {
 
-            if(originalData_.edgeTypes_[vertexEdgeId] != -1) {
-              if(vertexEdgeId != edgeId) {
+    SimplexId edgeId = jacobiSet[i].first;
+    SimplexId sheet1Id = sheet1Offset + jacobiSheets[i];
 
-                neighborNumber++;
+    originalData_.sheet1List_[sheet1Id].edgeList_.push_back(edgeId);
+    originalData_.edge2sheet1_[edgeId] = sheet1Id;
 
-                if(!visitedEdges[vertexEdgeId]) {
-                  edgeQueue.push(vertexEdgeId);
-                }
-              }
-            }
-          }
-
-          if((neighborNumber > 2)
-             && (originalData_.vertex2sheet0_[vertexId1] == -1)) {
-            // vertexId1 is a 0-sheet
-            // mark up the segmentation
-
-            originalData_.vertex2sheet0_[vertexId1]
-              = originalData_.sheet0List_.size();
-
-            originalData_.sheet0List_.resize(originalData_.sheet0List_.size()
-                                             + 1);
-            originalData_.sheet0List_.back().vertexId_ = vertexId1;
-            originalData_.sheet0List_.back().type_ = 1;
-            originalData_.sheet0List_.back().pruned_ = false;
-          }
-        }
+    if(originalData_.edgeTypes_[edgeId] == 1) {
+      originalData_.sheet1List_[sheet1Id].hasSaddleEdges_ = true;
+    }
+  }
 
-        visitedEdges[edgeId] = true;
+  for(SimplexId i = sheet1Offset; i < sheet1Offset + sheetNumber; i++) {
+    for(SimplexId j = 0;
+        j < (SimplexId)originalData_.sheet1List_[i].edgeList_.size(); j++) {
+      jacobiClassification.push_back(pair<SimplexId, SimplexId>(
+        originalData_.sheet1List_[i].edgeList_[j], i));
+    }
+  }
 
-      } while(edgeQueue.size());
+  // a vertex with more than 2 jacobi neighbors (besides the current edge) is
+  // a 0-sheet
+  for(SimplexId i = 0; i < vertexNumber_; i++) {
+    if((vertexJacobiDegrees[i] > 3)
+       && (originalData_.vertex2sheet0_[i] == -1)) {
+      // mark up the segmentation
+      originalData_.vertex2sheet0_[i] = originalData_.sheet0List_.size();
+
+      originalData_.sheet0List_.resize(originalData_.sheet0List_.size() + 1);
+      originalData_.sheet0List_.back().vertexId_ = i;
+      originalData_.sheet0List_.back().type_ = 1;
+      originalData_.sheet0List_.back().pruned_ = false;
     }
   }
 
@@ -159,7 +128,8 @@ int ReebSpace::compute1sheetsOnly(
     stringstream msg;
     msg << "[ReebSpace] " << originalData_.sheet1List_.size()
         << " 1-sheets and " << originalData_.sheet0List_.size()
-        << " 0-sheets extracted in " << t.getElapsedTime() << " s." << endl;
+        << " 0-sheets extracted in " << t.getElapsedTime() << " s."
+        << " (" << threadNumber_ << " thread(s))" << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
@@ -367,112 +337,87 @@ int ReebSpace::compute1sheets(
   return 0;
 }
 
-int ReebSpace::compute3sheet(
+int ReebSpace::get3sheetNeighbors(
   const SimplexId &vertexId,
-  const vector<vector<vector<SimplexId>>> &tetTriangles) {
-
-  SimplexId sheetId = originalData_.sheet3List_.size();
-  originalData_.sheet3List_.resize(originalData_.sheet3List_.size() + 1);
-  originalData_.sheet3List_.back().pruned_ = false;
-  originalData_.sheet3List_.back().preMerger_ = -1;
-  originalData_.sheet3List_.back().Id_ = sheetId;
-
-  queue<SimplexId> vertexQueue;
-  vertexQueue.push(vertexId);
+  const vector<vector<vector<SimplexId>>> &tetTriangles,
+  vector<SimplexId> &neighbors) const {
 
-  do {
+  // the jacobi vertices are marked with values lower than -1, the other
+  // vertices are not labeled yet (-1).
 
-    SimplexId localVertexId = vertexQueue.front();
-    vertexQueue.pop();
+  SimplexId vertexStarNumber = triangulation_->getVertexStarNumber(vertexId);
 
-    if(originalData_.vertex2sheet3_[localVertexId] == -1) {
-      // not visited yet
+  for(SimplexId i = 0; i < vertexStarNumber; i++) {
+    SimplexId tetId = -1;
+    triangulation_->getVertexStar(vertexId, i, tetId);
 
-      originalData_.sheet3List_.back().vertexList_.push_back(localVertexId);
-      originalData_.vertex2sheet3_[localVertexId] = sheetId;
+    if(tetTriangles[tetId].empty()) {
+      for(int j = 0; j < 4; j++) {
 
-      SimplexId vertexStarNumber
-        = triangulation_->getVertexStarNumber(localVertexId);
-
-      for(SimplexId i = 0; i < vertexStarNumber; i++) {
-        SimplexId tetId = -1;
-        triangulation_->getVertexStar(localVertexId, i, tetId);
-
-        if(tetTriangles[tetId].empty()) {
-          //             if(originalData_.tet2sheet3_[tetId] == -1){
-          //               originalData_.tet2sheet3_[tetId] = sheetId;
-          //               originalData_.sheet3List_.back().tetList_.push_back(tetId);
-          //             }
-          for(int j = 0; j < 4; j++) {
-
-            SimplexId tetVertexId = -1;
-            triangulation_->getCellVertex(tetId, j, tetVertexId);
-
-            if(originalData_.vertex2sheet3_[tetVertexId] == -1) {
-              vertexQueue.push(tetVertexId);
-            }
-          }
-        } else {
-          // fiber surface in there
-          for(int j = 0; j < 4; j++) {
-            SimplexId otherVertexId = -1;
-            triangulation_->getCellVertex(tetId, j, otherVertexId);
-            if((otherVertexId != localVertexId)
-               && (originalData_.vertex2sheet3_[otherVertexId] == -1)) {
-              // we need to see if the edge <localVertexId, otherVertexId> is
-              // cut by a fiber surface triangle or not.
-
-              bool isCut = false;
-              for(SimplexId k = 0; k < (SimplexId)tetTriangles[tetId].size();
-                  k++) {
-                SimplexId l = 0, m = 0, n = 0;
-                l = tetTriangles[tetId][k][0];
-                m = tetTriangles[tetId][k][1];
-                n = tetTriangles[tetId][k][2];
-
-                for(int p = 0; p < 3; p++) {
-                  pair<SimplexId, SimplexId> meshEdge;
-
-                  if(fiberSurfaceVertexList_.size()) {
-                    // the fiber surfaces have been merged
-                    meshEdge
-                      = fiberSurfaceVertexList_[originalData_.sheet2List_[l]
-                                                  .triangleList_[m][n]
-                                                  .vertexIds_[p]]
-                          .meshEdge_;
-                  } else {
-                    // the fiber surfaces have not been merged
-                    meshEdge = originalData_.sheet2List_[l]
-                                 .vertexList_[m][originalData_.sheet2List_[l]
-                                                   .triangleList_[m][n]
-                                                   .vertexIds_[p]]
-                                 .meshEdge_;
-                  }
-
-                  if(((meshEdge.first == localVertexId)
-                      && (meshEdge.second == otherVertexId))
-                     || ((meshEdge.second == localVertexId)
-                         && (meshEdge.first == otherVertexId))) {
-                    isCut = true;
-                    break;
-                  }
-                }
+        SimplexId tetVertexId = -1;
+        triangulation_->getCellVertex(tetId, j, tetVertexId);
 
-                if(isCut)
-                  break;
+        if((tetVertexId != vertexId)
+           && (originalData_.vertex2sheet3_[tetVertexId] == -1)) {
+          neighbors.push_back(tetVertexId);
+        }
+      }
+    } else {
+      // fiber surface in there
+      for(int j = 0; j < 4; j++) {
+        SimplexId otherVertexId = -1;
+        triangulation_->getCellVertex(tetId, j, otherVertexId);
+        if((otherVertexId != vertexId)
+           && (originalData_.vertex2sheet3_[otherVertexId] == -1)) {
+          // we need to see if the edge <vertexId, otherVertexId> is
+          // cut by a fiber surface triangle or not.
+
+          bool isCut = false;
+          for(SimplexId k = 0; k < (SimplexId)tetTriangles[tetId].size();
+              k++) {
+            SimplexId l = 0, m = 0, n = 0;
+            l = tetTriangles[tetId][k][0];
+            m = tetTriangles[tetId][k][1];
+            n = tetTriangles[tetId][k][2];
+
+            for(int p = 0; p < 3; p++) {
+              pair<SimplexId, SimplexId> meshEdge;
+
+              if(fiberSurfaceVertexList_.size()) {
+                // the fiber surfaces have been merged
+                meshEdge = fiberSurfaceVertexList_[originalData_.sheet2List_[l]
+                                                     .triangleList_[m][n]
+                                                     .vertexIds_[p]]
+                             .meshEdge_;
+              } else {
+                // the fiber surfaces have not been merged
+                meshEdge = originalData_.sheet2List_[l]
+                             .vertexList_[m][originalData_.sheet2List_[l]
+                                               .triangleList_[m][n]
+                                               .vertexIds_[p]]
+                             .meshEdge_;
               }
 
-              if(!isCut) {
-                // add the vertex to the queue
-                vertexQueue.push(otherVertexId);
+              if(((meshEdge.first == vertexId)
+                  && (meshEdge.second == otherVertexId))
+                 || ((meshEdge.second == vertexId)
+                     && (meshEdge.first == otherVertexId))) {
+                isCut = true;
+                break;
               }
             }
+
+            if(isCut)
+              break;
+          }
+
+          if(!isCut) {
+            neighbors.push_back(otherVertexId);
           }
         }
       }
     }
-
-  } while(vertexQueue.size());
+  }
 
   return 0;
 }
@@ -519,9 +464,35 @@ int ReebSpace::compute3sheets(vector<vector<vector<SimplexId>>> &tetTriangles) {
     }
   }
 
+  // concurrent flood fills on the non-jacobi vertices. the 3-sheets are
+  // numbered by increasing smallest vertex, as a sequential traversal would.
+  vector<SimplexId> vertexSheets;
+  SimplexId sheetNumber = 0;
+
+  computeComponents(
+    vertexNumber_,
+    [this](const SimplexId &vertexId) {
+      return originalData_.vertex2sheet3_[vertexId] == -1;
+    },
+    [this, &tetTriangles](
+      const SimplexId &vertexId, vector<SimplexId> &neighbors) {
+      get3sheetNeighbors(vertexId, tetTriangles, neighbors);
+    },
+    vertexSheets, sheetNumber);
+
+  SimplexId sheet3Offset = originalData_.sheet3List_.size();
+  originalData_.sheet3List_.resize(sheet3Offset + sheetNumber);
+  for(SimplexId i = sheet3Offset; i < sheet3Offset + sheetNumber; i++) {
+    originalData_.sheet3List_[i].pruned_ = false;
+    originalData_.sheet3List_[i].preMerger_ = -1;
+    originalData_.sheet3List_[i].Id_ = i;
+  }
+
   for(SimplexId i = 0; i < vertexNumber_; i++) {
-    if(originalData_.vertex2sheet3_[i] == -1) {
-      compute3sheet(i, tetTriangles);
+    if(vertexSheets[i] != -1) {
+      SimplexId sheetId = sheet3Offset + vertexSheets[i];
+      originalData_.vertex2sheet3_[i] = sheetId;
+      originalData_.sheet3List_[sheetId].vertexList_.push_back(i);
     }
   }
 
@@ -1487,6 +1458,26 @@ int ReebSpace::simplifySheet(const SimplexId &sheetId,
   return 0;
 }
 
+double ReebSpace::getSheetScore(
+  const SimplexId &sheetId,
+  const SimplificationCriterion &simplificationCriterion) const {
+
+  switch(simplificationCriterion) {
+
+    case ReebSpace::domainVolume:
+      return currentData_.sheet3List_[sheetId].domainVolume_ / totalVolume_;
+
+    case ReebSpace::rangeArea:
+      return currentData_.sheet3List_[sheetId].rangeArea_ / totalArea_;
+
+    case ReebSpace::hyperVolume:
+      return currentData_.sheet3List_[sheetId].hyperVolume_
+             / totalHyperVolume_;
+  }
+
+  return 0;
+}
+
 int ReebSpace::simplifySheets(
   const double &simplificationThreshold,
   const SimplificationCriterion &simplificationCriterion) {
@@ -1499,6 +1490,21 @@ int ReebSpace::simplifySheets(
   SimplexId simplifiedSheets = 0;
   double lastThreshold = -1;
 
+  // merging 3-sheets only increases their measures. hence, only the sheets
+  // initially below the threshold can ever be simplified: restrict the
+  // search for the smallest sheet to these candidates (in increasing id
+  // order, to break ties as an exhaustive scan would) and discard them as
+  // soon as they get pruned or grow above the threshold.
+  vector<SimplexId> candidates;
+
+  for(SimplexId i = 0; i < (SimplexId)currentData_.sheet3List_.size(); i++) {
+    if((!currentData_.sheet3List_[i].pruned_)
+       && (getSheetScore(i, simplificationCriterion)
+           < simplificationThreshold)) {
+      candidates.push_back(i);
+    }
+  }
+
   for(SimplexId it = 0; it < (SimplexId)originalData_.sheet3List_.size();
       it++) {
 
@@ -1507,34 +1513,31 @@ int ReebSpace::simplifySheets(
     double minValue = -1;
     SimplexId minId = -1;
 
-    for(SimplexId i = 0; i < (SimplexId)currentData_.sheet3List_.size(); i++) {
-      if(!currentData_.sheet3List_[i].pruned_) {
+    SimplexId candidateNumber = 0;
 
-        double value = 0;
-        switch(simplificationCriterion) {
+    for(SimplexId i = 0; i < (SimplexId)candidates.size(); i++) {
 
-          case ReebSpace::domainVolume:
-            value = currentData_.sheet3List_[i].domainVolume_ / totalVolume_;
-            break;
+      SimplexId sheetId = candidates[i];
 
-          case ReebSpace::rangeArea:
-            value = currentData_.sheet3List_[i].rangeArea_ / totalArea_;
-            break;
+      if(currentData_.sheet3List_[sheetId].pruned_)
+        continue;
 
-          case ReebSpace::hyperVolume:
-            value
-              = currentData_.sheet3List_[i].hyperVolume_ / totalHyperVolume_;
-            break;
-        }
+      double value = getSheetScore(sheetId, simplificationCriterion);
 
-        if((minId == -1) || (value < minValue)) {
-          minValue = value;
-          minId = i;
-        }
+      if(value >= simplificationThreshold)
+        continue;
+
+      candidates[candidateNumber] = sheetId;
+
+      if((minId == -1) || (value < minValue)) {
+        minValue = value;
+        minId = sheetId;
       }
+      candidateNumber++;
     }
+    candidates.resize(candidateNumber);
 
-    if((minId != -1) && (minValue < simplificationThreshold)) {
+    if(minId != -1) {
       simplifySheet(minId, simplificationCriterion);
       simplifiedSheets++;
       lastThreshold = minValue;
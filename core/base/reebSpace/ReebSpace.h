@@ -39,6 +39,7 @@
 // to add FiberSurface.h
 #include <Wrapper.h>
 
+#include <algorithm>
 #include <map>
 #include <set>
 
@@ -223,6 +224,14 @@ namespace ttk {
       return 0;
     }
 
+#ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
+    /// Set the path of a file to save (and later re-load) the range driven
+    /// octree to (from), see FiberSurface::setOctreeFileName().
+    inline int setOctreeFileName(const std::string &fileName) {
+      return fiberSurface_.setOctreeFileName(fileName);
+    }
+#endif
+
     inline bool setRangeDrivenOctree(const bool &onOff) {
 
       if(onOff != withRangeDrivenOctree_) {
@@ -309,6 +318,13 @@ namespace ttk {
       const std::vector<std::pair<SimplexId, char>> &jacobiSet,
       std::vector<std::pair<SimplexId, SimplexId>> &jacobiSetClassification);
 
+    template <class isNodeFunctor, class neighborFunctor>
+    inline int computeComponents(const SimplexId &nodeNumber,
+                                 const isNodeFunctor &isNode,
+                                 const neighborFunctor &getNeighbors,
+                                 std::vector<SimplexId> &nodeComponents,
+                                 SimplexId &componentNumber) const;
+
     template <class dataTypeU, class dataTypeV>
     inline int compute2sheets(
       const std::vector<std::pair<SimplexId, SimplexId>> &jacobiEdges);
@@ -316,10 +332,6 @@ namespace ttk {
     template <class dataTypeU, class dataTypeV>
     inline int compute2sheetChambers();
 
-    int compute3sheet(
-      const SimplexId &vertexId,
-      const std::vector<std::vector<std::vector<SimplexId>>> &tetTriangles);
-
     int compute3sheets(
       std::vector<std::vector<std::vector<SimplexId>>> &tetTriangles);
 
@@ -368,6 +380,11 @@ namespace ttk {
 
     int flush();
 
+    int get3sheetNeighbors(
+      const SimplexId &vertexId,
+      const std::vector<std::vector<std::vector<SimplexId>>> &tetTriangles,
+      std::vector<SimplexId> &neighbors) const;
+
     int mergeSheets(const SimplexId &smallerId, const SimplexId &biggerId);
 
     int preMergeSheets(const SimplexId &sheetId0, const SimplexId &sheetId1);
@@ -377,6 +394,10 @@ namespace ttk {
     int printConnectivity(std::ostream &stream,
                           const ReebSpaceData &data) const;
 
+    double
+      getSheetScore(const SimplexId &sheetId,
+                    const SimplificationCriterion &simplificationCriterion) const;
+
     int simplifySheets(const double &simplificationThreshold,
                        const SimplificationCriterion &simplificationCriterion);
 
@@ -508,6 +529,161 @@ inline int ttk::ReebSpace::execute() {
   return 0;
 }
 
+template <class isNodeFunctor, class neighborFunctor>
+inline int
+  ttk::ReebSpace::computeComponents(const SimplexId &nodeNumber,
+                                    const isNodeFunctor &isNode,
+                                    const neighborFunctor &getNeighbors,
+                                    std::vector<SimplexId> &nodeComponents,
+                                    SimplexId &componentNumber) const {
+
+  // concurrent flood fills: each thread grows fragments from its seeds,
+  // claiming nodes with atomic visit counters. the fragment of a node is
+  // identified by the seed it has been reached from. contacts between
+  // fragments are recorded and merged afterwards with a union-find.
+  std::vector<SimplexId> visits(nodeNumber, 0);
+  std::vector<SimplexId> fragments(nodeNumber, -1);
+  std::vector<std::vector<std::pair<SimplexId, SimplexId>>> contacts(
+    threadNumber_);
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+  {
+#ifdef TTK_ENABLE_OPENMP
+    ThreadId threadId = omp_get_thread_num();
+#else
+    ThreadId threadId = 0;
+#endif
+
+    std::vector<SimplexId> stack, neighbors;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic, 4096)
+#endif
+    for(SimplexId i = 0; i < nodeNumber; i++) {
+
+      if(!isNode(i))
+        continue;
+
+      SimplexId visit = 0;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif
+      visit = visits[i]++;
+
+      if(visit)
+        continue;
+
+      // i is a new seed
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif
+      fragments[i] = i;
+
+      stack.clear();
+      stack.push_back(i);
+
+      while(stack.size()) {
+
+        SimplexId nodeId = stack.back();
+        stack.pop_back();
+
+        neighbors.clear();
+        getNeighbors(nodeId, neighbors);
+
+        for(SimplexId j = 0; j < (SimplexId)neighbors.size(); j++) {
+
+          SimplexId neighborId = neighbors[j];
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic capture
+#endif
+          visit = visits[neighborId]++;
+
+          if(!visit) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif
+            fragments[neighborId] = i;
+            stack.push_back(neighborId);
+          } else {
+            SimplexId fragmentId = -1;
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic read
+#endif
+            fragmentId = fragments[neighborId];
+
+            // the fragment of neighborId may not be written yet, it will be
+            // resolved after the flood fills.
+            if(fragmentId != i) {
+              contacts[threadId].push_back(
+                std::pair<SimplexId, SimplexId>(i, neighborId));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // merge the fragments in contact, the root of a set being its smallest seed
+  std::vector<SimplexId> &parents = visits;
+  for(SimplexId i = 0; i < nodeNumber; i++)
+    parents[i] = i;
+
+  for(SimplexId i = 0; i < (SimplexId)contacts.size(); i++) {
+    for(SimplexId j = 0; j < (SimplexId)contacts[i].size(); j++) {
+
+      SimplexId root0 = contacts[i][j].first;
+      SimplexId root1 = fragments[contacts[i][j].second];
+
+      while(parents[root0] != root0) {
+        parents[root0] = parents[parents[root0]];
+        root0 = parents[root0];
+      }
+      while(parents[root1] != root1) {
+        parents[root1] = parents[parents[root1]];
+        root1 = parents[root1];
+      }
+
+      if(root0 < root1)
+        parents[root1] = root0;
+      else if(root1 < root0)
+        parents[root0] = root1;
+    }
+    contacts[i].clear();
+  }
+
+  nodeComponents.resize(nodeNumber);
+  for(SimplexId i = 0; i < nodeNumber; i++) {
+    SimplexId rootId = fragments[i];
+    if(rootId != -1) {
+      while(parents[rootId] != rootId)
+        rootId = parents[rootId];
+      parents[fragments[i]] = rootId;
+    }
+    nodeComponents[i] = rootId;
+  }
+
+  // number the components by increasing smallest node
+  std::vector<SimplexId> &rootComponents = fragments;
+  std::fill(rootComponents.begin(), rootComponents.end(), -1);
+  componentNumber = 0;
+
+  for(SimplexId i = 0; i < nodeNumber; i++) {
+    SimplexId rootId = nodeComponents[i];
+    if(rootId != -1) {
+      if(rootComponents[rootId] == -1) {
+        rootComponents[rootId] = componentNumber;
+        componentNumber++;
+      }
+      nodeComponents[i] = rootComponents[rootId];
+    }
+  }
+
+  return 0;
+}
+
 template <class dataTypeU, class dataTypeV>
 inline int ttk::ReebSpace::compute2sheets(
   const std::vector<std::pair<SimplexId, SimplexId>> &jacobiEdges) {
@@ -623,57 +799,6 @@ inline int ttk::ReebSpace::compute2sheets(
     }
   }
 
-  // #ifdef TTK_ENABLE_OPENMP
-  // #pragma omp parallel for num_threads(threadNumber_)
-  // #endif
-  //   for(int i = 0; i < (int) originalData_.sheet2List_.size(); i++){
-  //
-  //     int sheet1Id = originalData_.sheet2List_[i].sheet1Id_;
-  //
-  //     std::vector<bool> inList(tetNumber_, false);
-  //     std::vector<int> seedList;
-  //     std::vector<std::pair<std::pair<double, double>, std::pair<double,
-  //      double> > > edgeList;
-  //     std::vector<int> jacobiEdgeIdList;
-  //
-  //     for(int j = 0;
-  //       j < (int) originalData_.sheet1List_[sheet1Id].edgeList_.size(); j++){
-  //       int edgeId = originalData_.sheet1List_[sheet1Id].edgeList_[j];
-  //
-  //       if(originalData_.edgeTypes_[edgeId] == 1){
-  //         for(int k = 0; k < (int) (*edgeStars_)[edgeId].size(); k++){
-  //           int tetId = (*edgeStars_)[edgeId][k];
-  //           if(!inList[tetId]){
-  //             seedList.push_back(tetId);
-  //           }
-  //         }
-  //       }
-  //
-  //       if((originalData_.edgeTypes_[edgeId] != 1)
-  //         &&(originalData_.edgeTypes_[edgeId] != -1)){
-  //         edgeList.resize(edgeList.size() + 1);
-  //
-  //         edgeList.back().first.first =
-  //           ((dataTypeU *) uField_)[(*edgeList_)[edgeId].first];
-  //         edgeList.back().first.second =
-  //           ((dataTypeV *) vField_)[(*edgeList_)[edgeId].first];
-  //
-  //         edgeList.back().second.first =
-  //           ((dataTypeU *) uField_)[(*edgeList_)[edgeId].second];
-  //         edgeList.back().second.second =
-  //           ((dataTypeV *) vField_)[(*edgeList_)[edgeId].second];
-  //
-  //         jacobiEdgeIdList.push_back(edge2polygonEdgeId[edgeId]);
-  //       }
-  //     }
-  //
-  //     if(seedList.size()){
-  //       fiberSurface_.computeContour<dataTypeU, dataTypeV>(
-  //         edgeList, seedList,
-  //         &jacobiEdgeIdList);
-  //     }
-  //   }
-
   {
     std::stringstream msg;
     msg << "[ReebSpace] Fiber surfaces computed in " << t.getElapsedTime()
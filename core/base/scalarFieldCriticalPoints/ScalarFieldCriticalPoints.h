@@ -9,6 +9,10 @@
 /// This class computes the list of critical points of the input scalar field
 /// and classify them according to their type.
 ///
+/// On regular grids, the lower and upper links of all the vertices are
+/// obtained in one pass from the neighbor masks of ttk::GridStencil, instead
+/// of querying the vertex stars.
+///
 /// \param dataType Data type of the input scalar field (char, float,
 /// etc.).
 ///
@@ -25,6 +29,7 @@
 #include <map>
 
 // base code includes
+#include <GridStencil.h>
 #include <Triangulation.h>
 #include <UnionFind.h>
 #include <Wrapper.h>
@@ -44,6 +49,19 @@ namespace ttk {
     /// \return Returns 0 upon success, negative values otherwise.
     int execute();
 
+    /// Execute the package on a batch of scalar fields defined on the same
+    /// triangulation (for instance the components of a multi-component
+    /// array). The vertex offsets and the triangulation pre-processing are
+    /// shared by all the fields. Small meshes (or batches with at least as
+    /// many fields as threads) are processed with one field per thread, large
+    /// meshes one field at a time with all the threads.
+    /// \param fields Pointers to the scalar values of each field.
+    /// \param outputs Critical points of each field (resized by the call).
+    /// \return Returns 0 upon success, negative values otherwise.
+    int executeBatch(
+      const std::vector<const void *> &fields,
+      std::vector<std::vector<std::pair<SimplexId, char>>> &outputs);
+
     std::pair<SimplexId, SimplexId>
       getNumberOfLowerUpperComponents(const SimplexId vertexId,
                                       Triangulation *triangulation) const;
@@ -60,6 +78,11 @@ namespace ttk {
                          const std::vector<std::pair<SimplexId, SimplexId>>
                            &vertexLinkEdgeList) const;
 
+    /// Classify a vertex from the numbers of connected components of its
+    /// lower and upper links.
+    char getCriticalType(const SimplexId downValence,
+                         const SimplexId upValence) const;
+
     static bool isSosHigherThan(const SimplexId &offset0,
                                 const dataType &value0,
                                 const SimplexId &offset1,
@@ -138,7 +161,16 @@ namespace ttk {
       forceNonManifoldCheck = b;
     }
 
+    /// Set the number of vertices below which the fields of a batch are
+    /// distributed among the threads (one field per thread) instead of
+    /// being processed one after the other with all the threads.
+    void setFieldParallelismThreshold(const SimplexId threshold) {
+      fieldParallelismThreshold_ = threshold;
+    }
+
   protected:
+    int preconditionOffsets();
+
     int dimension_;
     SimplexId vertexNumber_;
     const dataType *scalarValues_;
@@ -148,6 +180,12 @@ namespace ttk {
     std::vector<SimplexId> *sosOffsets_;
     std::vector<SimplexId> localSosOffSets_;
     Triangulation *triangulation_;
+    // scratch buffer, re-used from one execution to the next
+    std::vector<char> vertexTypes_;
+    // stencil path for regular grids
+    GridStencil gridStencil_;
+    std::vector<GridStencil::NeighborMask> lowerMasks_, upperMasks_;
+    SimplexId fieldParallelismThreshold_;
 
     bool forceNonManifoldCheck;
   };
@@ -15,6 +15,7 @@ ttk::ScalarFieldCriticalPoints<dataType>::ScalarFieldCriticalPoints() {
   triangulation_ = NULL;
 
   forceNonManifoldCheck = false;
+  fieldParallelismThreshold_ = 1000000;
 
   //   threadNumber_ = 1;
 }
@@ -46,29 +47,36 @@ int ttk::ScalarFieldCriticalPoints<dataType>::execute() {
     dimension_ = triangulation_->getCellVertexNumber(0) - 1;
   }
 
-  if(!sosOffsets_) {
-    // let's use our own local copy
-    sosOffsets_ = &localSosOffSets_;
-  }
-  if((SimplexId)sosOffsets_->size() != vertexNumber_) {
-    Timer preProcess;
-    sosOffsets_->resize(vertexNumber_);
-    for(SimplexId i = 0; i < vertexNumber_; i++)
-      (*sosOffsets_)[i] = i;
-
-    {
-      std::stringstream msg;
-      msg << "[ScalarFieldCriticalPoints] Offset pre-processing done in "
-          << preProcess.getElapsedTime() << " s. Go!" << std::endl;
-      dMsg(std::cout, msg.str(), timeMsg);
-    }
-  }
+  preconditionOffsets();
 
   Timer t;
 
-  std::vector<char> vertexTypes(vertexNumber_);
+  std::vector<char> &vertexTypes = vertexTypes_;
+  vertexTypes.resize(vertexNumber_);
 
-  if(triangulation_) {
+  gridStencil_.setThreadNumber(threadNumber_);
+  gridStencil_.setDebugLevel(debugLevel_);
+
+  if(triangulation_ && !gridStencil_.setupTriangulation(triangulation_)) {
+    // stencil path for regular grids: the lower and upper links are given by
+    // the neighbor masks, their components by the stencil link connectivity
+    lowerMasks_.resize(vertexNumber_);
+    upperMasks_.resize(vertexNumber_);
+    gridStencil_.computeSteepestNeighbors(
+      scalarValues_, sosOffsets_->data(), static_cast<SimplexId *>(nullptr),
+      static_cast<SimplexId *>(nullptr), lowerMasks_.data(),
+      upperMasks_.data());
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId i = 0; i < (SimplexId)vertexNumber_; i++) {
+
+      vertexTypes[i] = getCriticalType(
+        gridStencil_.getLinkComponentNumber(i, lowerMasks_[i]),
+        gridStencil_.getLinkComponentNumber(i, upperMasks_[i]));
+    }
+  } else if(triangulation_) {
 #ifdef TTK_ENABLE_OPENMP
 #pragma omp parallel for num_threads(threadNumber_)
 #endif
@@ -198,6 +206,113 @@ int ttk::ScalarFieldCriticalPoints<dataType>::execute() {
   return 0;
 }
 
+template <class dataType>
+int ttk::ScalarFieldCriticalPoints<dataType>::preconditionOffsets() {
+
+  if(!sosOffsets_) {
+    // let's use our own local copy
+    sosOffsets_ = &localSosOffSets_;
+  }
+  if((SimplexId)sosOffsets_->size() != vertexNumber_) {
+    Timer preProcess;
+    sosOffsets_->resize(vertexNumber_);
+    for(SimplexId i = 0; i < vertexNumber_; i++)
+      (*sosOffsets_)[i] = i;
+
+    {
+      std::stringstream msg;
+      msg << "[ScalarFieldCriticalPoints] Offset pre-processing done in "
+          << preProcess.getElapsedTime() << " s. Go!" << std::endl;
+      dMsg(std::cout, msg.str(), timeMsg);
+    }
+  }
+
+  return 0;
+}
+
+template <class dataType>
+int ttk::ScalarFieldCriticalPoints<dataType>::executeBatch(
+  const std::vector<const void *> &fields,
+  std::vector<std::vector<std::pair<SimplexId, char>>> &outputs) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((!triangulation_) || (triangulation_->isEmpty()))
+    return -1;
+  for(size_t i = 0; i < fields.size(); i++) {
+    if(!fields[i])
+      return -3;
+  }
+#endif
+
+  Timer t;
+
+  vertexNumber_ = triangulation_->getNumberOfVertices();
+  dimension_ = triangulation_->getCellVertexNumber(0) - 1;
+
+  // shared by all the fields
+  preconditionOffsets();
+
+  outputs.resize(fields.size());
+
+  const SimplexId fieldNumber = fields.size();
+  const bool fieldParallelism
+    = (threadNumber_ > 1) && (fieldNumber > 1)
+      && ((fieldNumber >= threadNumber_)
+          || (vertexNumber_ < fieldParallelismThreshold_));
+
+  if(fieldParallelism) {
+#ifdef TTK_ENABLE_OPENMP
+    const int workerNumber = std::min<SimplexId>(threadNumber_, fieldNumber);
+#pragma omp parallel num_threads(workerNumber)
+#endif
+    {
+      // each thread owns a sequential copy of this object (and thus its own
+      // scratch buffers), which is re-used for all the fields it processes
+      ScalarFieldCriticalPoints<dataType> worker;
+      worker.setThreadNumber(1);
+      worker.setDebugLevel(std::min(debugLevel_, (int)Debug::timeMsg));
+      worker.setNonManifold(forceNonManifoldCheck);
+      worker.dimension_ = dimension_;
+      worker.vertexNumber_ = vertexNumber_;
+      worker.sosOffsets_ = sosOffsets_;
+      worker.triangulation_ = triangulation_;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for(SimplexId i = 0; i < fieldNumber; i++) {
+        worker.setScalarValues(fields[i]);
+        worker.setOutput(&(outputs[i]));
+        worker.execute();
+      }
+    }
+  } else {
+    const dataType *scalarValues = scalarValues_;
+    std::vector<std::pair<SimplexId, char>> *criticalPoints = criticalPoints_;
+
+    for(SimplexId i = 0; i < fieldNumber; i++) {
+      setScalarValues(fields[i]);
+      setOutput(&(outputs[i]));
+      execute();
+    }
+
+    scalarValues_ = scalarValues;
+    criticalPoints_ = criticalPoints;
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[ScalarFieldCriticalPoints] Batch of " << fieldNumber
+        << " field(s) processed in " << t.getElapsedTime() << " s. ("
+        << threadNumber_ << " thread(s), "
+        << (fieldParallelism ? "field" : "vertex") << "-level parallelism)."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
 template <class dataType>
 std::pair<ttk::SimplexId, ttk::SimplexId>
   ttk::ScalarFieldCriticalPoints<dataType>::getNumberOfLowerUpperComponents(
@@ -346,6 +461,13 @@ char ttk::ScalarFieldCriticalPoints<dataType>::getCriticalType(
   std::tie(downValence, upValence)
     = getNumberOfLowerUpperComponents(vertexId, triangulation);
 
+  return getCriticalType(downValence, upValence);
+}
+
+template <class dataType>
+char ttk::ScalarFieldCriticalPoints<dataType>::getCriticalType(
+  const SimplexId downValence, const SimplexId upValence) const {
+
   if(downValence == 0 && upValence == 1) {
     return static_cast<char>(CriticalType::Local_minimum);
   } else if(downValence == 1 && upValence == 0) {
@@ -9,6 +9,7 @@ ScalarFieldSmoother::ScalarFieldSmoother() {
   dimensionNumber_ = 1;
   mask_ = nullptr;
   triangulation_ = nullptr;
+  temporalBlocking_ = 4;
 }
 
 ScalarFieldSmoother::~ScalarFieldSmoother() {
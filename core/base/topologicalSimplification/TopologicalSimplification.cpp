@@ -1,5 +1,7 @@
 #include <TopologicalSimplification.h>
 
+#include <unordered_map>
+
 using namespace std;
 using namespace ttk;
 
@@ -7,11 +9,142 @@ TopologicalSimplification::TopologicalSimplification()
   : triangulation_{}, vertexNumber_{}, constraintNumber_{},
     inputScalarFieldPointer_{}, vertexIdentifierScalarFieldPointer_{},
     inputOffsetScalarFieldPointer_{}, considerIdentifierAsBlackList_{},
-    addPerturbation_{}, outputScalarFieldPointer_{},
+    addPerturbation_{}, useLocalizedMode_{}, outputScalarFieldPointer_{},
     outputOffsetScalarFieldPointer_{} {
   considerIdentifierAsBlackList_ = false;
   addPerturbation_ = false;
+  useLocalizedMode_ = false;
 }
 
 TopologicalSimplification::~TopologicalSimplification() {
 }
+
+int TopologicalSimplification::getLocalizedCriticalType(
+  SimplexId vertexId, const LocalizedOrder &order) const {
+
+  bool isMinimum{true};
+  bool isMaximum{true};
+  SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(vertexId);
+  for(SimplexId i = 0; i < neighborNumber; ++i) {
+    SimplexId neighbor;
+    triangulation_->getVertexNeighbor(vertexId, i, neighbor);
+
+    if(order.isBefore(neighbor, vertexId, true))
+      isMinimum = false;
+    else
+      isMaximum = false;
+    if(!isMinimum and !isMaximum)
+      return 0;
+  }
+
+  if(isMinimum)
+    return -1;
+  if(isMaximum)
+    return 1;
+
+  return 0;
+}
+
+int TopologicalSimplification::floodBasin(
+  SimplexId extremum,
+  bool isIncreasingOrder,
+  const LocalizedOrder &order,
+  const vector<bool> &authorizedExtrema,
+  MonotoneQueue &queue,
+  vector<SimplexId> &region,
+  SimplexId &saddle) const {
+
+  region.clear();
+  saddle = -1;
+
+  auto getItem = [&](SimplexId vertexId) {
+    MonotoneQueue::Item item;
+    item.representative = order.representatives[vertexId];
+    item.key = order.keys[item.representative];
+    if(!isIncreasingOrder)
+      item.key = ~item.key;
+    item.offset = order.offsets[item.representative];
+    item.subLevel = order.subLevels[vertexId];
+    item.vertexId = vertexId;
+    return item;
+  };
+
+  // 1: in the queue, 2: flooded, 3: re-ordered
+  unordered_map<SimplexId, char> status;
+  vector<SimplexId> flooded;
+
+  queue.clear(isIncreasingOrder, getItem(extremum).key);
+  queue.push(getItem(extremum));
+  status[extremum] = 1;
+
+  // the popped keys never decrease: the first popped vertex with an
+  // unvisited neighbor coming before it is the saddle of the basin
+  while(!queue.empty()) {
+    const SimplexId vertexId = queue.pop().vertexId;
+
+    SimplexId neighborNumber
+      = triangulation_->getVertexNeighborNumber(vertexId);
+    for(SimplexId i = 0; i < neighborNumber; ++i) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(vertexId, i, neighbor);
+      if(status.find(neighbor) == status.end()
+         and order.isBefore(neighbor, vertexId, isIncreasingOrder)) {
+        saddle = vertexId;
+        break;
+      }
+    }
+    if(saddle != -1)
+      break;
+
+    status[vertexId] = 2;
+    flooded.push_back(vertexId);
+
+    for(SimplexId i = 0; i < neighborNumber; ++i) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(vertexId, i, neighbor);
+      if(status.find(neighbor) == status.end()) {
+        status[neighbor] = 1;
+        queue.push(getItem(neighbor));
+      }
+    }
+  }
+
+  if(saddle == -1)
+    return -1;
+
+  // breadth-first ordering of the basin from its saddle, such that each
+  // vertex follows one of its neighbors. the authorized extrema of the
+  // opposite type are only expanded last, so that they remain extrema
+  // whenever possible.
+  region.reserve(flooded.size());
+  vector<SimplexId> deferred;
+  size_t deferredPos{};
+  size_t head{};
+  SimplexId current = saddle;
+  while(true) {
+    SimplexId neighborNumber = triangulation_->getVertexNeighborNumber(current);
+    for(SimplexId i = 0; i < neighborNumber; ++i) {
+      SimplexId neighbor;
+      triangulation_->getVertexNeighbor(current, i, neighbor);
+      auto it = status.find(neighbor);
+      if(it != status.end() and it->second == 2) {
+        it->second = 3;
+        if(authorizedExtrema[neighbor])
+          deferred.push_back(neighbor);
+        else
+          region.push_back(neighbor);
+      }
+    }
+
+    if(head < region.size())
+      current = region[head++];
+    else if(deferredPos < deferred.size()) {
+      current = deferred[deferredPos++];
+      region.push_back(current);
+      ++head;
+    } else
+      break;
+  }
+
+  return 0;
+}
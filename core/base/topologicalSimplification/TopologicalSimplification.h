@@ -19,6 +19,15 @@
 /// Proc. of IEEE VIS 2012.\n
 /// IEEE Transactions on Visualization and Computer Graphics, 2012.
 ///
+/// In localized mode (see setUseLocalizedMode()), only the basins of the
+/// extrema to remove are flooded (in parallel, with a monotone radix queue)
+/// and the convergence is only checked around the modified regions, instead
+/// of sweeping the entire domain at each iteration. No global vertex sort is
+/// performed: the vertices are compared on the fly by value and offset, and
+/// only the offsets of the vertices sharing the value of a modified vertex are
+/// re-distributed. The remaining full-domain work consists of linear parallel
+/// passes (copy of the input, single critical point classification).
+///
 /// \sa ttkTopologicalSimplification.cpp %for a usage example.
 
 #ifndef _TOPOLOGICALSIMPLIFICATION_H
@@ -28,10 +37,14 @@
 #include <Wrapper.h>
 
 #include <Triangulation.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <numeric>
 #include <set>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 namespace ttk {
 
@@ -67,6 +80,109 @@ namespace ttk {
     };
   };
 
+  /// Monotone priority queue of the localized simplification.
+  ///
+  /// The keys popped out of the queue never decrease, which enables a radix
+  /// heap organization (one bucket per highest bit differing from the last
+  /// popped key) instead of a balanced tree. Items sharing the last popped
+  /// key are ordered by offset, representative, sub-level and vertex
+  /// identifier (see TopologicalSimplification::LocalizedOrder).
+  class MonotoneQueue {
+  public:
+    struct Item {
+      unsigned long long key;
+      SimplexId offset;
+      SimplexId representative;
+      LongSimplexId subLevel;
+      SimplexId vertexId;
+    };
+
+    // heap order of the items sharing the last popped key
+    struct ItemCmp {
+      bool isIncreasingOrder;
+
+      inline bool operator()(const Item &a, const Item &b) const {
+        if(a.offset != b.offset)
+          return isIncreasingOrder ? a.offset > b.offset : a.offset < b.offset;
+        if(a.representative != b.representative)
+          return isIncreasingOrder ? a.representative > b.representative
+                                   : a.representative < b.representative;
+        if(a.subLevel != b.subLevel)
+          return isIncreasingOrder ? a.subLevel > b.subLevel
+                                   : a.subLevel < b.subLevel;
+        return isIncreasingOrder ? a.vertexId > b.vertexId
+                                 : a.vertexId < b.vertexId;
+      }
+    };
+
+    MonotoneQueue() : cmp_{true}, last_{}, size_{} {
+    }
+
+    inline int clear(bool isIncreasingOrder, unsigned long long key) {
+      for(auto &bucket : buckets_)
+        bucket.clear();
+      cmp_.isIncreasingOrder = isIncreasingOrder;
+      last_ = key;
+      size_ = 0;
+      return 0;
+    }
+
+    inline bool empty() const {
+      return !size_;
+    }
+
+    inline int push(const Item &item) {
+      const int bucketId = getBucketId(item.key);
+      buckets_[bucketId].push_back(item);
+      if(!bucketId)
+        std::push_heap(buckets_[0].begin(), buckets_[0].end(), cmp_);
+      ++size_;
+      return 0;
+    }
+
+    inline Item pop() {
+      if(buckets_[0].empty()) {
+        int bucketId = 1;
+        while(buckets_[bucketId].empty())
+          ++bucketId;
+
+        last_ = buckets_[bucketId][0].key;
+        for(const auto &item : buckets_[bucketId])
+          last_ = std::min(last_, item.key);
+
+        // all the items of this bucket move to lower buckets
+        items_.swap(buckets_[bucketId]);
+        for(const auto &item : items_)
+          buckets_[getBucketId(item.key)].push_back(item);
+        items_.clear();
+        std::make_heap(buckets_[0].begin(), buckets_[0].end(), cmp_);
+      }
+
+      std::pop_heap(buckets_[0].begin(), buckets_[0].end(), cmp_);
+      const Item item = buckets_[0].back();
+      buckets_[0].pop_back();
+      --size_;
+      return item;
+    }
+
+  private:
+    inline int getBucketId(unsigned long long key) const {
+      unsigned long long diff = key ^ last_;
+      int bucketId = 0;
+      while(diff) {
+        diff >>= 1;
+        ++bucketId;
+      }
+      return bucketId;
+    }
+
+    ItemCmp cmp_;
+    unsigned long long last_;
+    size_t size_;
+    std::vector<Item> buckets_[65];
+    std::vector<Item> items_;
+  };
+
   class TopologicalSimplification : public Debug {
 
   public:
@@ -110,6 +226,14 @@ namespace ttk {
     template <typename dataType, typename idType>
     int execute() const;
 
+    /// Localized simplification: only the basins of the extrema to remove
+    /// are flooded and the convergence is only checked around the modified
+    /// vertices.
+    /// \return Returns 0 upon success, 1 if the global sweep has to take
+    /// over (unbounded basin), negative values otherwise.
+    template <typename dataType, typename idType>
+    int executeLocalized() const;
+
     inline int setupTriangulation(Triangulation *triangulation) {
       triangulation_ = triangulation;
       if(triangulation_) {
@@ -154,6 +278,11 @@ namespace ttk {
       return 0;
     }
 
+    inline int setUseLocalizedMode(bool onOff) {
+      useLocalizedMode_ = onOff;
+      return 0;
+    }
+
     inline int setOutputScalarFieldPointer(void *data) {
       outputScalarFieldPointer_ = data;
       return 0;
@@ -165,6 +294,88 @@ namespace ttk {
     }
 
   protected:
+    /// Vertex order of the localized mode. A vertex flattened onto the level
+    /// of a saddle takes the value and offset of an input vertex (its
+    /// representative) and is ordered after it by sub-level. The scalar
+    /// values are compared through order preserving integer keys, which
+    /// also serve as radix keys in the MonotoneQueue.
+    struct LocalizedOrder {
+      std::vector<unsigned long long> keys;
+      const SimplexId *offsets;
+      std::vector<SimplexId> representatives;
+      std::vector<LongSimplexId> subLevels;
+
+      /// Compare two vertices (level, sub-level, identifier).
+      inline bool isBefore(SimplexId a, SimplexId b, bool isIncreasingOrder) const {
+        if(!isIncreasingOrder)
+          std::swap(a, b);
+        const SimplexId ra = representatives[a];
+        const SimplexId rb = representatives[b];
+        if(keys[ra] != keys[rb])
+          return keys[ra] < keys[rb];
+        if(offsets[ra] != offsets[rb])
+          return offsets[ra] < offsets[rb];
+        if(ra != rb)
+          return ra < rb;
+        if(subLevels[a] != subLevels[b])
+          return subLevels[a] < subLevels[b];
+        return a < b;
+      }
+    };
+
+    /// Order preserving integer key of a scalar value.
+    template <typename dataType>
+    static inline unsigned long long getOrderKey(const dataType value) {
+      return getOrderKey(
+        value,
+        std::integral_constant<bool, std::is_floating_point<dataType>::value>(),
+        std::integral_constant<bool, std::is_signed<dataType>::value>());
+    }
+
+    template <typename dataType, bool isSigned>
+    static inline unsigned long long
+      getOrderKey(const dataType value,
+                  std::true_type /* floating point */,
+                  std::integral_constant<bool, isSigned>) {
+      // IEEE 754: flip all the bits of the negative values, the sign bit of
+      // the positive ones
+      double d = value;
+      if(d == 0)
+        d = 0; // -0 == +0
+      unsigned long long bits;
+      std::memcpy(&bits, &d, sizeof(bits));
+      return (bits >> 63) ? ~bits : bits | (1ULL << 63);
+    }
+
+    template <typename dataType>
+    static inline unsigned long long getOrderKey(const dataType value,
+                                                 std::false_type,
+                                                 std::true_type /* signed */) {
+      return ((unsigned long long)(long long)value) ^ (1ULL << 63);
+    }
+
+    template <typename dataType>
+    static inline unsigned long long getOrderKey(const dataType value,
+                                                 std::false_type,
+                                                 std::false_type) {
+      return (unsigned long long)value;
+    }
+
+    int getLocalizedCriticalType(SimplexId vertexId,
+                                 const LocalizedOrder &order) const;
+
+    /// Flood the basin of the input extremum until reaching its saddle.
+    /// \param region Flooded vertices, sorted such that each vertex has a
+    /// neighbor which comes before it in the list (or the saddle).
+    /// \return Returns 0 upon success, -1 if the basin is not bounded.
+    int floodBasin(SimplexId extremum,
+                   bool isIncreasingOrder,
+                   const LocalizedOrder &order,
+                   const std::vector<bool> &authorizedExtrema,
+                   MonotoneQueue &queue,
+                   std::vector<SimplexId> &region,
+                   SimplexId &saddle) const;
+
     Triangulation *triangulation_;
     SimplexId vertexNumber_;
     SimplexId constraintNumber_;
@@ -173,6 +384,7 @@ namespace ttk {
     void *inputOffsetScalarFieldPointer_;
     bool considerIdentifierAsBlackList_;
     bool addPerturbation_;
+    bool useLocalizedMode_;
     void *outputScalarFieldPointer_;
     void *outputOffsetScalarFieldPointer_;
   };
@@ -323,6 +535,18 @@ int ttk::TopologicalSimplification::execute() const {
   SimplexId *offsets
     = static_cast<SimplexId *>(outputOffsetScalarFieldPointer_);
 
+  if(useLocalizedMode_) {
+    const int ret = executeLocalized<dataType, idType>();
+    if(ret <= 0)
+      return ret;
+
+    std::stringstream msg;
+    msg << "[TopologicalSimplification] Unbounded basin, switching to the "
+           "global sweep..."
+        << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
   Timer t;
 
   // pre-processing
@@ -502,4 +726,291 @@ int ttk::TopologicalSimplification::execute() const {
 
   return 0;
 }
+
+template <typename dataType, typename idType>
+int ttk::TopologicalSimplification::executeLocalized() const {
+
+  // get input data
+  dataType *inputScalars = static_cast<dataType *>(inputScalarFieldPointer_);
+  dataType *scalars = static_cast<dataType *>(outputScalarFieldPointer_);
+  idType *identifiers
+    = static_cast<idType *>(vertexIdentifierScalarFieldPointer_);
+  idType *inputOffsets = static_cast<idType *>(inputOffsetScalarFieldPointer_);
+  SimplexId *offsets
+    = static_cast<SimplexId *>(outputOffsetScalarFieldPointer_);
+
+  Timer t;
+
+  // pre-processing
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    scalars[k] = inputScalars[k];
+    if(std::isnan((double)scalars[k]))
+      scalars[k] = 0;
+
+    offsets[k] = inputOffsets[k];
+  }
+
+  // get the user extremum list
+  std::vector<bool> extrema(vertexNumber_, false);
+  for(SimplexId k = 0; k < constraintNumber_; ++k) {
+    const SimplexId identifierId = identifiers[k];
+
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(identifierId >= 0 and identifierId < vertexNumber_)
+#endif
+      extrema[identifierId] = true;
+  }
+
+  // vertex order: initially, each vertex is its own representative
+  LocalizedOrder order;
+  order.keys.resize(vertexNumber_);
+  order.offsets = offsets;
+  order.representatives.resize(vertexNumber_);
+  order.subLevels.resize(vertexNumber_, 0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    order.keys[k] = getOrderKey(scalars[k]);
+    order.representatives[k] = k;
+  }
+
+  // single pass over the extrema: the authorized ones are kept, the others
+  // are the sources of the basins to flood (minima first, then maxima)
+  std::vector<int> type(vertexNumber_);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < vertexNumber_; ++k)
+    type[k] = getCriticalType<dataType>(k, scalars, offsets);
+
+  std::vector<bool> authorizedExtrema(vertexNumber_, false);
+  std::vector<SimplexId> pendingExtrema[2];
+  SimplexId authorizedNumber[2]{};
+  for(SimplexId k = 0; k < vertexNumber_; ++k) {
+    if(!type[k])
+      continue;
+    const int j = type[k] < 0 ? 0 : 1;
+    if(considerIdentifierAsBlackList_ xor extrema[k]) {
+      authorizedExtrema[k] = true;
+      ++authorizedNumber[j];
+    } else
+      pendingExtrema[j].push_back(k);
+  }
+  type.clear();
+
+  {
+    std::stringstream msg;
+    msg << "[TopologicalSimplification] Maintaining " << constraintNumber_
+        << " constraints (" << authorizedNumber[0] << " minima and "
+        << authorizedNumber[1] << " maxima)." << std::endl;
+    dMsg(std::cout, msg.str(), advancedInfoMsg);
+  }
+
+  std::vector<bool> isModified(vertexNumber_, false);
+  std::vector<SimplexId> modifiedVertices;
+
+  // processing
+  int iteration{};
+  for(SimplexId i = 0; i < vertexNumber_; ++i) {
+
+    if(pendingExtrema[0].empty() and pendingExtrema[1].empty())
+      break;
+
+    {
+      std::stringstream msg;
+      msg << "[TopologicalSimplification] Starting localized iteration #" << i
+          << " (" << pendingExtrema[0].size() << " minima, "
+          << pendingExtrema[1].size() << " maxima to remove)..." << std::endl;
+      dMsg(std::cout, msg.str(), advancedInfoMsg);
+    }
+
+    for(int j = 0; j < 2; ++j) {
+
+      const bool isIncreasingOrder = !j;
+      std::vector<SimplexId> &sources = pendingExtrema[j];
+      std::sort(sources.begin(), sources.end());
+      sources.erase(
+        std::unique(sources.begin(), sources.end()), sources.end());
+
+      const SimplexId sourceNumber = sources.size();
+      std::vector<std::vector<SimplexId>> regions(sourceNumber);
+      std::vector<SimplexId> saddles(sourceNumber, -1);
+      int status{};
+
+      // the basins are flooded independently, from the state of the
+      // previous pass
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel num_threads(threadNumber_)
+#endif
+      {
+        MonotoneQueue queue;
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for(SimplexId k = 0; k < sourceNumber; ++k) {
+          if(floodBasin(sources[k], isIncreasingOrder, order,
+                        authorizedExtrema, queue, regions[k], saddles[k])) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp atomic write
+#endif
+            status = -1;
+          }
+        }
+      }
+      if(status)
+        return 1;
+
+      sources.clear();
+
+      // two basins are either disjoint or nested: processing them by
+      // increasing saddle lets the enclosing basins overwrite the nested ones
+      std::vector<SimplexId> regionOrder;
+      for(SimplexId k = 0; k < sourceNumber; ++k)
+        if(!regions[k].empty())
+          regionOrder.push_back(k);
+      std::sort(regionOrder.begin(), regionOrder.end(),
+                [&](const SimplexId a, const SimplexId b) {
+                  if(saddles[a] != saddles[b])
+                    return order.isBefore(
+                      saddles[a], saddles[b], isIncreasingOrder);
+                  return a < b;
+                });
+
+      std::vector<SimplexId> checkList;
+      for(SimplexId k : regionOrder) {
+        const SimplexId saddle = saddles[k];
+        const std::vector<SimplexId> &region = regions[k];
+        const SimplexId regionSize = region.size();
+        for(SimplexId l = 0; l < regionSize; ++l) {
+          const SimplexId vertexId = region[l];
+          order.representatives[vertexId] = order.representatives[saddle];
+          if(isIncreasingOrder)
+            order.subLevels[vertexId] = order.subLevels[saddle] + l + 1;
+          else
+            order.subLevels[vertexId] = order.subLevels[saddle] - l - 1;
+          if(!isModified[vertexId]) {
+            isModified[vertexId] = true;
+            modifiedVertices.push_back(vertexId);
+          }
+        }
+
+        checkList.push_back(saddle);
+        for(SimplexId vertexId : region) {
+          checkList.push_back(vertexId);
+          SimplexId neighborNumber
+            = triangulation_->getVertexNeighborNumber(vertexId);
+          for(SimplexId l = 0; l < neighborNumber; ++l) {
+            SimplexId neighbor;
+            triangulation_->getVertexNeighbor(vertexId, l, neighbor);
+            checkList.push_back(neighbor);
+          }
+        }
+      }
+      std::sort(checkList.begin(), checkList.end());
+      checkList.erase(
+        std::unique(checkList.begin(), checkList.end()), checkList.end());
+
+      // test convergence around the modified vertices only
+      const SimplexId checkNumber = checkList.size();
+      std::vector<int> checkType(checkNumber, 0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+      for(SimplexId k = 0; k < checkNumber; ++k) {
+        if(!authorizedExtrema[checkList[k]])
+          checkType[k] = getLocalizedCriticalType(checkList[k], order);
+      }
+
+      for(SimplexId k = 0; k < checkNumber; ++k) {
+        if(checkType[k] < 0)
+          pendingExtrema[0].push_back(checkList[k]);
+        else if(checkType[k] > 0)
+          pendingExtrema[1].push_back(checkList[k]);
+      }
+    }
+
+    ++iteration;
+  }
+
+  if(!pendingExtrema[0].empty() or !pendingExtrema[1].empty())
+    return 1;
+
+  // write the output: the modified vertices take the value of their
+  // representative
+  const SimplexId modifiedNumber = modifiedVertices.size();
+  std::vector<dataType> modifiedScalars(modifiedNumber);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < modifiedNumber; ++k)
+    modifiedScalars[k]
+      = scalars[order.representatives[modifiedVertices[k]]];
+
+  // the offsets only need to be updated among the vertices sharing the
+  // value of a modified vertex: their offsets are re-distributed following
+  // the vertex order (the other offsets are left unchanged)
+  std::vector<unsigned long long> modifiedKeys(modifiedNumber);
+  for(SimplexId k = 0; k < modifiedNumber; ++k)
+    modifiedKeys[k] = order.keys[order.representatives[modifiedVertices[k]]];
+  std::sort(modifiedKeys.begin(), modifiedKeys.end());
+  modifiedKeys.erase(std::unique(modifiedKeys.begin(), modifiedKeys.end()),
+                     modifiedKeys.end());
+
+  std::vector<char> isTied(vertexNumber_, 0);
+  if(modifiedNumber) {
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(SimplexId k = 0; k < vertexNumber_; ++k) {
+      isTied[k] = isModified[k]
+                  or std::binary_search(
+                    modifiedKeys.begin(), modifiedKeys.end(), order.keys[k]);
+    }
+  }
+
+  std::vector<SimplexId> tiedVertices;
+  for(SimplexId k = 0; k < vertexNumber_; ++k)
+    if(isTied[k])
+      tiedVertices.push_back(k);
+
+  const SimplexId tiedNumber = tiedVertices.size();
+  std::vector<SimplexId> tiedOffsets(tiedNumber);
+  for(SimplexId k = 0; k < tiedNumber; ++k)
+    tiedOffsets[k] = offsets[tiedVertices[k]];
+  std::sort(tiedOffsets.begin(), tiedOffsets.end());
+  std::sort(tiedVertices.begin(), tiedVertices.end(),
+            [&](const SimplexId a, const SimplexId b) {
+              return order.isBefore(a, b, true);
+            });
+
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(SimplexId k = 0; k < modifiedNumber; ++k)
+    scalars[modifiedVertices[k]] = modifiedScalars[k];
+  for(SimplexId k = 0; k < tiedNumber; ++k)
+    offsets[tiedVertices[k]] = tiedOffsets[k];
+
+  // optional adding of perturbation
+  if(addPerturbation_)
+    addPerturbation<dataType>(scalars, offsets);
+
+  {
+    std::stringstream msg;
+    msg << "[TopologicalSimplification] Scalar field simplified (localized)"
+        << " in " << t.getElapsedTime() << " s. (" << threadNumber_
+        << " threads(s), " << iteration << " ite., " << modifiedNumber
+        << " modified vertices, " << tiedNumber << " re-ordered offsets)."
+        << std::endl;
+    dMsg(std::cout, msg.str(), timeMsg);
+  }
+
+  return 0;
+}
+
 #endif // TOPOLOGICALSIMPLIFICATION_H
@@ -9,7 +9,9 @@
 /// %TrackingFromOverlap is a TTK processing package that provides algorithms to
 /// track labled point sets across time (and optionally levels) based on spatial
 /// overlap, where two points overlap iff their corresponding coordinates are
-/// equal.
+/// equal. When consecutive point sets share the same geometry (e.g. the same
+/// image grid), points can directly be matched by index (see
+/// setPointMatching()).
 ///
 /// \b Related \b publication: \n
 /// 'Nested Tracking Graphs'
@@ -20,11 +22,25 @@
 
 #pragma once
 
-#include <algorithm>
 #include <boost/variant.hpp>
+#include <cstring>
 #include <map>
 #include <unordered_map>
 
+#ifdef __APPLE__
+#include <algorithm>
+#else
+#ifdef _WIN32
+#include <algorithm>
+#else
+#ifdef __clang__
+#include <algorithm>
+#else
+#include <parallel/algorithm>
+#endif
+#endif
+#endif
+
 // base code includes
 #include <Wrapper.h>
 
@@ -85,9 +101,35 @@ struct CoordinateComparator {
 namespace ttk {
   class TrackingFromOverlap : public Debug {
   public:
+    /// Strategy used to find the overlapping points of two point sets.
+    enum class PointMatching : int {
+      /// Points are matched by coordinates (sort and merge).
+      Coordinates = 0,
+      /// Points are matched by index if both point sets have the same
+      /// coordinates, by coordinates otherwise.
+      Automatic = 1,
+      /// Both point sets are declared to have the same coordinates: points
+      /// are matched by index.
+      Index = 2
+    };
+
     TrackingFromOverlap(){};
     ~TrackingFromOverlap(){};
 
+    inline int setPointMatching(const PointMatching &pointMatching) {
+      pointMatching_ = pointMatching;
+      return 0;
+    }
+
+    /// Release the cached sort orders.
+    inline int clearCache() {
+      for(auto &entry : sortCache_) {
+        entry.coordinates.clear();
+        entry.sortedIndicies.clear();
+      }
+      return 0;
+    }
+
     // This function sorts points based on their x, y, and then z coordinate
     int sortCoordinates(const float *pointCoordinates,
                         const size_t nPoints,
@@ -108,6 +150,33 @@ namespace ttk {
       return 1;
     }
 
+    // This function returns the sorted coordinate order of a point set,
+    // reusing the order of a previous call on the same coordinates
+    const vector<size_t> &getSortedIndicies(const float *pointCoordinates,
+                                            const size_t nPoints) {
+      const size_t nCoords = nPoints * 3;
+      for(auto &entry : sortCache_) {
+        if(entry.coordinates.size() == nCoords && nCoords > 0
+           && memcmp(entry.coordinates.data(), pointCoordinates,
+                     nCoords * sizeof(float))
+                == 0) {
+          entry.lastUse = ++cacheTime_;
+          return entry.sortedIndicies;
+        }
+      }
+
+      // replace the least recently used entry
+      auto *entry = &sortCache_[0];
+      for(auto &e : sortCache_)
+        if(e.lastUse < entry->lastUse)
+          entry = &e;
+
+      entry->coordinates.assign(pointCoordinates, pointCoordinates + nCoords);
+      this->sortCoordinates(pointCoordinates, nPoints, entry->sortedIndicies);
+      entry->lastUse = ++cacheTime_;
+      return entry->sortedIndicies;
+    }
+
     int computeBranches(vector<Edges> &timeEdgesMap,
                         vector<Nodes> &timeNodesMap) const {
       dMsg(cout, "[ttkTrackingFromOverlap] Computing branches  ... ", timeMsg);
@@ -213,6 +282,13 @@ namespace ttk {
                              const size_t nPoints,
                              map<labelType, size_t> &labelIndexMap) const;
 
+    // This function maps each point to the index of its label in the sorted
+    // list of unique labels (same indices as computeLabelIndexMap)
+    template <typename labelType>
+    int computeLabelIndicies(const labelType *pointLabels,
+                             const size_t nPoints,
+                             vector<unsigned int> &labelIndicies) const;
+
     // This function computes all nodes and their properties based on a labeled
     // point set
     template <typename labelType>
@@ -230,9 +306,20 @@ namespace ttk {
                        const size_t nPoints0,
                        const size_t nPoints1,
 
-                       Edges &edges) const;
+                       Edges &edges);
 
   private:
+    // sort order of the last point sets (the second point set of a timestep
+    // is the first one of the next timestep)
+    struct SortCacheEntry {
+      vector<float> coordinates;
+      vector<size_t> sortedIndicies;
+      size_t lastUse{0};
+    };
+
+    PointMatching pointMatching_{PointMatching::Automatic};
+    SortCacheEntry sortCache_[2];
+    size_t cacheTime_{0};
   };
 } // namespace ttk
 
@@ -299,6 +386,35 @@ int ttk::TrackingFromOverlap::computeNodes(const float *pointCoordinates,
   return 1;
 }
 
+// =============================================================================
+// Compute LabelIndicies
+// =============================================================================
+template <typename labelType>
+int ttk::TrackingFromOverlap::computeLabelIndicies(
+  const labelType *pointLabels,
+  const size_t nPoints,
+  vector<unsigned int> &labelIndicies) const {
+  vector<labelType> labels(pointLabels, pointLabels + nPoints);
+  sort(labels.begin(), labels.end());
+  labels.erase(unique(labels.begin(), labels.end()), labels.end());
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(labels.size() > (size_t)0xFFFFFFFF)
+    return -1;
+#endif
+
+  labelIndicies.resize(nPoints);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+  for(size_t i = 0; i < nPoints; i++)
+    labelIndicies[i]
+      = lower_bound(labels.begin(), labels.end(), pointLabels[i])
+        - labels.begin();
+
+  return 1;
+}
+
 // =============================================================================
 // Track Nodes
 // =============================================================================
@@ -310,22 +426,111 @@ int ttk::TrackingFromOverlap::computeOverlap(const float *pointCoordinates0,
                                              const size_t nPoints0,
                                              const size_t nPoints1,
 
-                                             Edges &edges) const {
+                                             Edges &edges) {
   // -------------------------------------------------------------------------
-  // Compute labelIndexMaps
+  // Compute label indicies
   // -------------------------------------------------------------------------
-  map<labelType, size_t> labelIndexMap0;
-  map<labelType, size_t> labelIndexMap1;
-  this->computeLabelIndexMap<labelType>(pointLabels0, nPoints0, labelIndexMap0);
-  this->computeLabelIndexMap<labelType>(pointLabels1, nPoints1, labelIndexMap1);
+  vector<unsigned int> labelIndicies0;
+  vector<unsigned int> labelIndicies1;
+  if(this->computeLabelIndicies<labelType>(
+       pointLabels0, nPoints0, labelIndicies0)
+       < 0
+     || this->computeLabelIndicies<labelType>(
+          pointLabels1, nPoints1, labelIndicies1)
+          < 0) {
+    dMsg(cerr, "[ttkTrackingFromOverlap] Too many labels.\n", fatalMsg);
+    return -1;
+  }
 
   // -------------------------------------------------------------------------
-  // Sort coordinates
+  // Match points
   // -------------------------------------------------------------------------
-  vector<size_t> sortedIndicies0;
-  vector<size_t> sortedIndicies1;
-  this->sortCoordinates(pointCoordinates0, nPoints0, sortedIndicies0);
-  this->sortCoordinates(pointCoordinates1, nPoints1, sortedIndicies1);
+  // Points overlapping by index if both point sets share the same geometry
+  bool matchByIndex = false;
+  if(this->pointMatching_ == PointMatching::Index) {
+    if(nPoints0 != nPoints1) {
+      dMsg(cout,
+           "[ttkTrackingFromOverlap] Point sets of different sizes, "
+           "matching by coordinates.\n",
+           infoMsg);
+    } else
+      matchByIndex = true;
+  } else if(this->pointMatching_ == PointMatching::Automatic) {
+    matchByIndex = nPoints0 == nPoints1
+                   && (pointCoordinates0 == pointCoordinates1
+                       || memcmp(pointCoordinates0, pointCoordinates1,
+                                 nPoints0 * 3 * sizeof(float))
+                            == 0);
+  }
+
+  // Overlapping points are encoded as packed label index pairs
+  vector<unsigned long long> labelPairs;
+
+  if(matchByIndex) {
+    labelPairs.resize(nPoints0);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+    for(size_t i = 0; i < nPoints0; i++)
+      labelPairs[i] = ((unsigned long long)labelIndicies0[i] << 32)
+                      | labelIndicies1[i];
+  } else {
+    // -----------------------------------------------------------------------
+    // Sort coordinates
+    // -----------------------------------------------------------------------
+    const vector<size_t> &sortedIndicies0
+      = this->getSortedIndicies(pointCoordinates0, nPoints0);
+    const vector<size_t> &sortedIndicies1
+      = this->getSortedIndicies(pointCoordinates1, nPoints1);
+
+    /* Function that determines configuration of point p0 and p1:
+        0: p0Coords = p1Coords
+       >0: p0Coords < p1Coords
+       <0: p0Coords > p1Coords
+    */
+    auto compare = [&](size_t p0, size_t p1) {
+      size_t p0CoordIndex = p0 * 3;
+      size_t p1CoordIndex = p1 * 3;
+
+      float p0_X = pointCoordinates0[p0CoordIndex++];
+      float p0_Y = pointCoordinates0[p0CoordIndex++];
+      float p0_Z = pointCoordinates0[p0CoordIndex];
+
+      float p1_X = pointCoordinates1[p1CoordIndex++];
+      float p1_Y = pointCoordinates1[p1CoordIndex++];
+      float p1_Z = pointCoordinates1[p1CoordIndex];
+
+      return p0_X == p1_X
+               ? p0_Y == p1_Y ? p0_Z == p1_Z ? 0 : p0_Z < p1_Z ? -1 : 1
+                              : p0_Y < p1_Y ? -1 : 1
+               : p0_X < p1_X ? -1 : 1;
+    };
+
+    size_t i = 0; // iterator for 0
+    size_t j = 0; // iterator for 1
+
+    labelPairs.reserve(min(nPoints0, nPoints1));
+    // Iterate over both point sets synchronously using comparison function
+    while(i < nPoints0 && j < nPoints1) {
+      size_t pointIndex0 = sortedIndicies0[i];
+      size_t pointIndex1 = sortedIndicies1[j];
+
+      // Determine point configuration
+      int c = compare(pointIndex0, pointIndex1);
+
+      if(c == 0) { // Points have same coordinates -> track
+        labelPairs.push_back(
+          ((unsigned long long)labelIndicies0[pointIndex0] << 32)
+          | labelIndicies1[pointIndex1]);
+        i++;
+        j++;
+      } else if(c > 0) { // p0 in front of p1 -> let p1 catch up
+        j++;
+      } else { // p1 in front of p0 -> let p0 catch up
+        i++;
+      }
+    }
+  }
 
   // -------------------------------------------------------------------------
   // Track Nodes
@@ -333,78 +538,22 @@ int ttk::TrackingFromOverlap::computeOverlap(const float *pointCoordinates0,
   dMsg(cout, "[ttkTrackingFromOverlap] Tracking .............. ", timeMsg);
   Timer t;
 
-  /* Function that determines configuration of point p0 and p1:
-      0: p0Coords = p1Coords
-     >0: p0Coords < p1Coords
-     <0: p0Coords > p1Coords
-  */
-  auto compare = [&](size_t p0, size_t p1) {
-    size_t p0CoordIndex = p0 * 3;
-    size_t p1CoordIndex = p1 * 3;
-
-    float p0_X = pointCoordinates0[p0CoordIndex++];
-    float p0_Y = pointCoordinates0[p0CoordIndex++];
-    float p0_Z = pointCoordinates0[p0CoordIndex];
-
-    float p1_X = pointCoordinates1[p1CoordIndex++];
-    float p1_Y = pointCoordinates1[p1CoordIndex++];
-    float p1_Z = pointCoordinates1[p1CoordIndex];
-
-    return p0_X == p1_X ? p0_Y == p1_Y ? p0_Z == p1_Z ? 0 : p0_Z < p1_Z ? -1 : 1
-                                       : p0_Y < p1_Y ? -1 : 1
-                        : p0_X < p1_X ? -1 : 1;
-  };
-
-  size_t i = 0; // iterator for 0
-  size_t j = 0; // iterator for 1
-
+  // Overlap of two nodes = number of occurences of their label pair
+#ifdef TTK_ENABLE_OPENMP
+#ifdef _GLIBCXX_PARALLEL_FEATURES_H
+  __gnu_parallel::sort(labelPairs.begin(), labelPairs.end());
+#else
+  sort(labelPairs.begin(), labelPairs.end());
+#endif
+#else
+  sort(labelPairs.begin(), labelPairs.end());
+#endif
+
+  size_t nPairs = labelPairs.size();
   size_t nEdges = 0;
-  unordered_map<size_t, unordered_map<size_t, size_t>> edgesMap;
-  // Iterate over both point sets synchronously using comparison function
-  while(i < nPoints0 && j < nPoints1) {
-    size_t pointIndex0 = sortedIndicies0[i];
-    size_t pointIndex1 = sortedIndicies1[j];
-
-    // Determine point configuration
-    int c = compare(pointIndex0, pointIndex1);
-
-    if(c == 0) { // Points have same coordinates -> track
-      labelType label0 = pointLabels0[pointIndex0];
-      labelType label1 = pointLabels1[pointIndex1];
-
-      size_t &nodeIndex0 = labelIndexMap0[label0];
-      size_t &nodeIndex1 = labelIndexMap1[label1];
-
-      // Find edge and increase overlap counter
-      auto edges0 = edgesMap.find(nodeIndex0); // Edges from label0 to nodes1
-
-      // If map does not exist then create it
-      if(edges0 == edgesMap.end()) {
-        edgesMap[nodeIndex0] = unordered_map<size_t, size_t>();
-        edges0 = edgesMap.find(nodeIndex0);
-      }
-
-      // Find edge label0 -> label1
-      auto edge = edges0->second.find(nodeIndex1);
-
-      // If edge does not exist then create it
-      if(edge == edges0->second.end()) {
-        edges0->second[nodeIndex1] = 0;
-        edge = edges0->second.find(nodeIndex1);
-        nEdges++;
-      }
-
-      // Increase overlap
-      edge->second++;
-
-      i++;
-      j++;
-    } else if(c > 0) { // p0 in front of p1 -> let p1 catch up
-      j++;
-    } else { // p1 in front of p0 -> let p0 catch up
-      i++;
-    }
-  }
+  for(size_t i = 0; i < nPairs; i++)
+    if(i == 0 || labelPairs[i] != labelPairs[i - 1])
+      nEdges++;
 
   // -------------------------------------------------------------------------
   // Pack Output
@@ -412,21 +561,23 @@ int ttk::TrackingFromOverlap::computeOverlap(const float *pointCoordinates0,
   {
     edges.resize(nEdges * 4);
     size_t q = 0;
-    for(auto &it0 : edgesMap) {
-      for(auto &it1 : it0.second) {
-        edges[q++] = it0.first;
-        edges[q++] = it1.first;
-        edges[q++] = it1.second;
-        edges[q++] = -1;
-      }
+    for(size_t i = 0; i < nPairs;) {
+      size_t j = i + 1;
+      while(j < nPairs && labelPairs[j] == labelPairs[i])
+        j++;
+      edges[q++] = labelPairs[i] >> 32;
+      edges[q++] = labelPairs[i] & 0xFFFFFFFF;
+      edges[q++] = j - i;
+      edges[q++] = -1;
+      i = j;
     }
   }
 
   // Print Status
   {
     stringstream msg;
-    msg << "done (#" << nEdges << " in " << t.getElapsedTime() << " s)."
-        << endl;
+    msg << "done (#" << nEdges << (matchByIndex ? " by index" : "") << " in "
+        << t.getElapsedTime() << " s)." << endl;
     dMsg(cout, msg.str(), timeMsg);
   }
 
@@ -1089,6 +1089,13 @@ namespace ttk {
       return 0;
     }
 
+    /// Check if the current object is the implicit triangulation of a
+    /// regular grid with periodic boundary conditions.
+    /// \return Returns true if periodic boundary conditions are used.
+    inline bool hasPeriodicBoundaries() const {
+      return usePeriodicBoundaries_;
+    }
+
     /// Get the number of cells in the triangulation.
     ///
     /// Here the notion of cell refers to the simplicices of maximal
@@ -3034,6 +3041,147 @@ namespace ttk {
       return abstractTriangulation_->preprocessVertexTriangles();
     }
 
+    /// Renumber the vertices and cells of an explicit triangulation to
+    /// improve the memory locality of the traversals (no effect on implicit
+    /// triangulations).
+    ///
+    /// The vertices are sorted along a space-filling (Hilbert) curve or
+    /// with the reverse Cuthill-McKee algorithm and the cells by minimum
+    /// vertex identifier. After this call, all the identifiers used by the
+    /// traversal methods are the reordered ones: the input data arrays
+    /// should be mapped with reorderVertexData() and reorderCellData() and
+    /// the outputs mapped back to the input identifiers with
+    /// restoreVertexData(), restoreCellData(), getOriginalVertexId() and
+    /// getOriginalCellId().
+    ///
+    /// This function should be called after setInputPoints() and
+    /// setInputCells() and before any pre-processing (previous
+    /// pre-processings are discarded).
+    /// \param method Vertex ordering.
+    /// \return Returns 0 upon success, negative values otherwise.
+    inline int
+      reorder(const ExplicitTriangulation::ReorderingMethod &method) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return -1;
+#endif
+      if(abstractTriangulation_ != &explicitTriangulation_)
+        return 0;
+
+      return explicitTriangulation_.reorder(method);
+    }
+
+    /// Check if the vertices and cells have been renumbered by reorder().
+    inline bool isReordered() const {
+      return abstractTriangulation_ == &explicitTriangulation_
+             && explicitTriangulation_.isReordered();
+    }
+
+    /// Get the input identifier of a vertex (different from vertexId only
+    /// after reorder()).
+    inline SimplexId getOriginalVertexId(const SimplexId &vertexId) const {
+      if(!isReordered())
+        return vertexId;
+      return explicitTriangulation_.getOriginalVertexId(vertexId);
+    }
+
+    /// Get the input identifier of a cell (different from cellId only after
+    /// reorder()).
+    inline SimplexId getOriginalCellId(const SimplexId &cellId) const {
+      if(!isReordered())
+        return cellId;
+      return explicitTriangulation_.getOriginalCellId(cellId);
+    }
+
+    /// Map an input vertex data array to the reordered vertex identifiers
+    /// (plain copy if the triangulation is not reordered).
+    /// \param input Input array (indexed by input vertex identifiers).
+    /// \param output Output array (indexed by the current vertex
+    /// identifiers), allocated by the caller.
+    /// \param componentNumber Number of components of the arrays.
+    /// \return Returns 0 upon success, negative values otherwise.
+    template <class dataType>
+    inline int reorderVertexData(const dataType *input,
+                                 dataType *output,
+                                 const int &componentNumber = 1) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return -1;
+#endif
+      if(!isReordered()) {
+        std::copy(input,
+                  input + (size_t)componentNumber * getNumberOfVertices(),
+                  output);
+        return 0;
+      }
+      return explicitTriangulation_.reorderVertexData(
+        input, output, componentNumber);
+    }
+
+    /// Map a vertex data array back to the input vertex identifiers (plain
+    /// copy if the triangulation is not reordered).
+    /// \sa reorderVertexData()
+    template <class dataType>
+    inline int restoreVertexData(const dataType *input,
+                                 dataType *output,
+                                 const int &componentNumber = 1) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return -1;
+#endif
+      if(!isReordered()) {
+        std::copy(input,
+                  input + (size_t)componentNumber * getNumberOfVertices(),
+                  output);
+        return 0;
+      }
+      return explicitTriangulation_.restoreVertexData(
+        input, output, componentNumber);
+    }
+
+    /// Map an input cell data array to the reordered cell identifiers
+    /// (plain copy if the triangulation is not reordered).
+    /// \sa reorderVertexData()
+    template <class dataType>
+    inline int reorderCellData(const dataType *input,
+                               dataType *output,
+                               const int &componentNumber = 1) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return -1;
+#endif
+      if(!isReordered()) {
+        std::copy(input,
+                  input + (size_t)componentNumber * getNumberOfCells(),
+                  output);
+        return 0;
+      }
+      return explicitTriangulation_.reorderCellData(
+        input, output, componentNumber);
+    }
+
+    /// Map a cell data array back to the input cell identifiers (plain copy
+    /// if the triangulation is not reordered).
+    /// \sa reorderVertexData()
+    template <class dataType>
+    inline int restoreCellData(const dataType *input,
+                               dataType *output,
+                               const int &componentNumber = 1) const {
+#ifndef TTK_ENABLE_KAMIKAZE
+      if(isEmptyCheck())
+        return -1;
+#endif
+      if(!isReordered()) {
+        std::copy(input,
+                  input + (size_t)componentNumber * getNumberOfCells(),
+                  output);
+        return 0;
+      }
+      return explicitTriangulation_.restoreCellData(
+        input, output, componentNumber);
+    }
+
     /// Tune the debug level (default: 0)
     inline int setDebugLevel(const int &debugLevel) {
       explicitTriangulation_.setDebugLevel(debugLevel);
@@ -1,9 +1,14 @@
 #include <ttkBlockAggregator.h>
 
+#include <vtkCompositeDataSet.h>
+#include <vtkDirectory.h>
 #include <vtkDoubleArray.h>
 #include <vtkFieldData.h>
+#include <vtkInformation.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
+#include <vtkStringArray.h>
+#include <vtkXMLMultiBlockDataWriter.h>
 
 using namespace std;
 using namespace ttk;
@@ -13,28 +18,115 @@ vtkStandardNewMacro(ttkBlockAggregator)
   int ttkBlockAggregator::AggregateBlock(vtkDataObject *dataObject,
                                          bool useShallowCopy) {
 
-  size_t nBlocks = this->AggregatedMultiBlockDataSet->GetNumberOfBlocks();
+  if(dataObject == nullptr)
+    return 1;
 
-  auto temp0 = vtkSmartPointer<vtkMultiBlockDataSet>::New();
-  temp0->SetBlock(0, dataObject);
+  // a new instance is always created so that the aggregated block does not
+  // alias the (possibly re-executed) input object; in sharing mode, only the
+  // references to the input arrays are copied
+  auto block = vtkSmartPointer<vtkDataObject>::Take(dataObject->NewInstance());
+  if(useShallowCopy || this->CopyMode == 1)
+    block->ShallowCopy(dataObject);
+  else
+    block->DeepCopy(dataObject);
 
-  auto temp1 = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  const size_t index = this->NumberOfAggregatedBlocks++;
+  this->Blocks.push_back(block);
+  this->BlockIndices.push_back(index);
 
-  if(useShallowCopy)
-    temp1->ShallowCopy(temp0);
-  else
-    temp1->DeepCopy(temp0);
+  // Print status
+  stringstream msg;
+  msg << "[ttkBlockAggregator] Added block at index " << index << endl;
+  dMsg(cout, msg.str(), infoMsg);
+
+  return this->EvictBlocks();
+}
+
+int ttkBlockAggregator::EvictBlocks() {
+
+  if(this->WindowSize <= 0)
+    return 1;
 
-  this->AggregatedMultiBlockDataSet->SetBlock(nBlocks, temp1->GetBlock(0));
+  while(this->Blocks.size() > static_cast<size_t>(this->WindowSize)) {
+    if(this->SpillToDisk) {
+      if(!this->SpillBlock(this->Blocks.front(), this->BlockIndices.front()))
+        return 0;
+    } else {
+      stringstream msg;
+      msg << "[ttkBlockAggregator] Released block at index "
+          << this->BlockIndices.front() << endl;
+      dMsg(cout, msg.str(), infoMsg);
+    }
+
+    // dropping the last reference frees the block (and, in sharing mode,
+    // the input arrays no longer referenced upstream)
+    this->Blocks.pop_front();
+    this->BlockIndices.pop_front();
+  }
+
+  return 1;
+}
+
+int ttkBlockAggregator::SpillBlock(vtkDataObject *block, const size_t &index) {
+
+  if(this->SpillDirectory.empty()) {
+    dMsg(cout, "[ttkBlockAggregator] ERROR: Spill directory not set.\n",
+         fatalMsg);
+    return 0;
+  }
+
+  // Create directory if it does not already exist
+  {
+    auto directory = vtkSmartPointer<vtkDirectory>::New();
+    if(!directory->Open(this->SpillDirectory.data())
+       && directory->MakeDirectory(this->SpillDirectory.data()) != 1) {
+      dMsg(cout,
+           "[ttkBlockAggregator] ERROR: Unable to create spill directory.\n",
+           fatalMsg);
+      return 0;
+    }
+  }
+
+  const string path = this->SpillDirectory + "/block_"
+                      + to_string(this->NumberOfResets) + "_"
+                      + to_string(index) + ".vtm";
+
+  auto temp = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  temp->SetBlock(0, block);
+
+  auto mbWriter = vtkSmartPointer<vtkXMLMultiBlockDataWriter>::New();
+  mbWriter->SetFileName(path.data());
+  mbWriter->SetDataModeToAppended();
+  mbWriter->SetCompressorTypeToZLib();
+  mbWriter->SetInputData(temp);
+  if(mbWriter->Write() != 1) {
+    stringstream msg;
+    msg << "[ttkBlockAggregator] ERROR: Unable to write block " << index
+        << " to '" << path << "'." << endl;
+    dMsg(cout, msg.str(), fatalMsg);
+    return 0;
+  }
+
+  this->SpilledFiles.push_back(path);
 
   // Print status
   stringstream msg;
-  msg << "[ttkBlockAggregator] Added block at index " << nBlocks << endl;
+  msg << "[ttkBlockAggregator] Spilled block at index " << index << " to '"
+      << path << "'" << endl;
   dMsg(cout, msg.str(), infoMsg);
 
   return 1;
 }
 
+int ttkBlockAggregator::ResetBlocks() {
+  this->Blocks.clear();
+  this->BlockIndices.clear();
+  this->SpilledFiles.clear();
+  this->NumberOfAggregatedBlocks = 0;
+  this->NumberOfResets++;
+  return 1;
+}
+
 int ttkBlockAggregator::RequestData(vtkInformation *request,
                                     vtkInformationVector **inputVector,
                                     vtkInformationVector *outputVector) {
@@ -68,8 +160,7 @@ int ttkBlockAggregator::RequestData(vtkInformation *request,
   // First timestep
   if(!useStreamingOverTime || this->GetForceReset() || iteration == 0
      || this->AggregatedMultiBlockDataSet == nullptr)
-    this->AggregatedMultiBlockDataSet
-      = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+    this->ResetBlocks();
 
   bool useShallowCopy = this->GetForceReset() && nIterations < 1;
 
@@ -87,12 +178,32 @@ int ttkBlockAggregator::RequestData(vtkInformation *request,
       if(this->GetFlattenInput() && inputAsMB) {
         auto nBlocks = inputAsMB->GetNumberOfBlocks();
         for(size_t j = 0; j < nBlocks; j++)
-          this->AggregateBlock(inputAsMB->GetBlock(j), useShallowCopy);
-      } else
-        this->AggregateBlock(input, useShallowCopy);
+          if(!this->AggregateBlock(inputAsMB->GetBlock(j), useShallowCopy))
+            return 0;
+      } else if(!this->AggregateBlock(input, useShallowCopy))
+        return 0;
     }
   }
 
+  // Rebuild the aggregated multiblock from the blocks within the window
+  this->AggregatedMultiBlockDataSet
+    = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  for(size_t i = 0; i < this->Blocks.size(); i++) {
+    this->AggregatedMultiBlockDataSet->SetBlock(i, this->Blocks[i]);
+    this->AggregatedMultiBlockDataSet->GetMetaData(i)->Set(
+      vtkCompositeDataSet::NAME(),
+      ("Block_" + to_string(this->BlockIndices[i])).data());
+  }
+
+  if(!this->SpilledFiles.empty()) {
+    auto spilledBlocks = vtkSmartPointer<vtkStringArray>::New();
+    spilledBlocks->SetName("_ttk_SpilledBlocks");
+    spilledBlocks->SetNumberOfValues(this->SpilledFiles.size());
+    for(size_t i = 0; i < this->SpilledFiles.size(); i++)
+      spilledBlocks->SetValue(i, this->SpilledFiles[i]);
+    this->AggregatedMultiBlockDataSet->GetFieldData()->AddArray(spilledBlocks);
+  }
+
   // Get Output
   vtkInformation *outInfo = outputVector->GetInformationObject(0);
   auto outMB = vtkMultiBlockDataSet::SafeDownCast(
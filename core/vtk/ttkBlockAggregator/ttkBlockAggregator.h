@@ -9,12 +9,27 @@
 /// This filter iteratively appends its input as a block to a
 /// vtkMultiBlockDataSet.
 ///
+/// By default, each input is deep-copied and all the blocks are kept. Inputs
+/// that are not modified in place upstream can instead be shared (shallow copy
+/// of a new instance, the data arrays being reference counted), and a sliding
+/// window can restrict the output to the last K aggregated blocks (e.g., K=2
+/// for pairwise tracking). Blocks evicted from the window are released, or
+/// first written to disk (one .vtm file per block) if spilling is enabled; the
+/// paths of the spilled files are listed in the "_ttk_SpilledBlocks" field
+/// data array of the output. The file names contain the number of resets of
+/// the filter so that the files of a previous aggregation are not
+/// overwritten.
+///
 /// \param Input vtkDataObject that will be added as a block (vtkDataObject).
 /// \param Output vtkMultiBlockDataSet containing all added blocks
 /// (vtkMultiBlockDataSet).
 
 #pragma once
 
+#include <deque>
+#include <string>
+#include <vector>
+
 // VTK includes
 #include <vtkMultiBlockDataSet.h>
 #include <vtkMultiBlockDataSetAlgorithm.h>
@@ -41,6 +56,20 @@ public:
   vtkSetMacro(FlattenInput, bool);
   vtkGetMacro(FlattenInput, bool);
 
+  // 0: deep copy, 1: share (reference counted)
+  vtkSetMacro(CopyMode, int);
+  vtkGetMacro(CopyMode, int);
+
+  // 0: keep all the blocks
+  vtkSetMacro(WindowSize, int);
+  vtkGetMacro(WindowSize, int);
+
+  vtkSetMacro(SpillToDisk, bool);
+  vtkGetMacro(SpillToDisk, bool);
+
+  vtkSetMacro(SpillDirectory, std::string);
+  vtkGetMacro(SpillDirectory, std::string);
+
   // default ttk setters
   vtkSetMacro(debugLevel_, int);
   void SetThreads() {
@@ -82,6 +111,13 @@ protected:
   ttkBlockAggregator() {
     SetForceReset(false);
     SetFlattenInput(true);
+    SetCopyMode(0);
+    SetWindowSize(0);
+    SetSpillToDisk(false);
+    SetSpillDirectory("");
+
+    NumberOfAggregatedBlocks = 0;
+    NumberOfResets = 0;
 
     UseAllCores = false;
 
@@ -94,6 +130,9 @@ protected:
   int ThreadNumber;
 
   int AggregateBlock(vtkDataObject *dataObject, bool useShallowCopy);
+  int EvictBlocks();
+  int SpillBlock(vtkDataObject *block, const size_t &index);
+  int ResetBlocks();
   int RequestData(vtkInformation *request,
                   vtkInformationVector **inputVector,
                   vtkInformationVector *outputVector) override;
@@ -101,6 +140,18 @@ protected:
 private:
   bool ForceReset;
   bool FlattenInput;
+  int CopyMode;
+  int WindowSize;
+  bool SpillToDisk;
+  std::string SpillDirectory;
+
+  // aggregated blocks (within the window) and their global indices
+  std::deque<vtkSmartPointer<vtkDataObject>> Blocks;
+  std::deque<size_t> BlockIndices;
+  size_t NumberOfAggregatedBlocks;
+  // number of aggregations started so far, used to name the spilled files
+  size_t NumberOfResets;
+  std::vector<std::string> SpilledFiles;
   vtkSmartPointer<vtkMultiBlockDataSet> AggregatedMultiBlockDataSet;
 
   bool needsToAbort() override {
@@ -2,6 +2,8 @@
 
 #include <vtkVersion.h>
 
+#include <algorithm>
+
 #include <vtkCellData.h>
 #include <vtkDoubleArray.h>
 #include <vtkFieldData.h>
@@ -21,6 +23,9 @@
 #include <vtkRenderer.h>
 #include <vtkWindowToImageFilter.h>
 
+// CPU Backend Dependencies
+#include <vtkTriangleFilter.h>
+
 // Value Pass Dependencies
 #if VTK_MAJOR_VERSION >= 7
 #include <vtkCameraPass.h>
@@ -35,7 +40,271 @@ using namespace ttk;
 
 vtkStandardNewMacro(ttkCinemaImaging)
 
-  int ttkCinemaImaging::RequestData(vtkInformation *request,
+  int ttkCinemaImaging::AddFieldData(vtkImageData *outputImage,
+                                     vtkPointSet *inputGrid,
+                                     const size_t i,
+                                     const double *camPosition,
+                                     const double *camUp) {
+  auto outputImageFD = outputImage->GetFieldData();
+
+  // Camera Parameters
+  auto ch = vtkSmartPointer<vtkDoubleArray>::New();
+  ch->SetName("CamHeight");
+  ch->SetNumberOfValues(1);
+  ch->SetValue(0, this->CamHeight);
+  outputImageFD->AddArray(ch);
+
+  auto cnf = vtkSmartPointer<vtkDoubleArray>::New();
+  cnf->SetName("CamNearFar");
+  cnf->SetNumberOfValues(2);
+  cnf->SetValue(0, this->CamNearFar[0]);
+  cnf->SetValue(1, this->CamNearFar[1]);
+  outputImageFD->AddArray(cnf);
+
+  auto cr = vtkSmartPointer<vtkDoubleArray>::New();
+  cr->SetName("CamRes");
+  cr->SetNumberOfValues(2);
+  cr->SetValue(0, this->Resolution[0]);
+  cr->SetValue(1, this->Resolution[1]);
+  outputImageFD->AddArray(cr);
+
+  // Position
+  auto cp = vtkSmartPointer<vtkDoubleArray>::New();
+  cp->SetName("CamPosition");
+  cp->SetNumberOfValues(3);
+  cp->SetValue(0, camPosition[0]);
+  cp->SetValue(1, camPosition[1]);
+  cp->SetValue(2, camPosition[2]);
+  outputImageFD->AddArray(cp);
+
+  // Dir
+  auto cd = vtkSmartPointer<vtkDoubleArray>::New();
+  cd->SetName("CamDirection");
+  cd->SetNumberOfValues(3);
+  double tempCD[3] = {this->CamFocus[0] - camPosition[0],
+                      this->CamFocus[1] - camPosition[1],
+                      this->CamFocus[2] - camPosition[2]};
+  vtkMath::Normalize(tempCD);
+  cd->SetValue(0, tempCD[0]);
+  cd->SetValue(1, tempCD[1]);
+  cd->SetValue(2, tempCD[2]);
+  outputImageFD->AddArray(cd);
+
+  // Up
+  auto cu = vtkSmartPointer<vtkDoubleArray>::New();
+  cu->SetName("CamUp");
+  cu->SetNumberOfValues(3);
+  cu->SetValue(0, camUp[0]);
+  cu->SetValue(1, camUp[1]);
+  cu->SetValue(2, camUp[2]);
+  outputImageFD->AddArray(cu);
+
+  auto inputGridPointData = inputGrid->GetPointData();
+  size_t nInputGridPointData = inputGridPointData->GetNumberOfArrays();
+  for(size_t j = 0; j < nInputGridPointData; j++) {
+    auto array = inputGridPointData->GetAbstractArray(j);
+    auto newArray
+      = vtkSmartPointer<vtkAbstractArray>::Take(array->NewInstance());
+    newArray->SetName(array->GetName());
+    newArray->SetNumberOfTuples(1);
+    newArray->SetNumberOfComponents(array->GetNumberOfComponents());
+    array->GetTuples(i, i, newArray);
+
+    outputImageFD->AddArray(newArray);
+  }
+
+  return 0;
+}
+
+int ttkCinemaImaging::RequestDataCPU(vtkDataObject *inputObject,
+                                     vtkPolyData *poly,
+                                     vtkPointSet *inputGrid,
+                                     vtkMultiBlockDataSet *outputImages) {
+  Memory mem;
+  Timer t;
+
+  // -------------------------------------------------------------------------
+  // Triangulate and Index the Surface (only if the input changed)
+  // -------------------------------------------------------------------------
+  if(surface_ == nullptr || inputObject->GetMTime() != SurfaceMTime) {
+    auto triangleFilter = vtkSmartPointer<vtkTriangleFilter>::New();
+    triangleFilter->SetInputData(poly);
+    triangleFilter->PassVertsOff();
+    triangleFilter->PassLinesOff();
+    triangleFilter->Update();
+
+    surface_ = vtkSmartPointer<vtkPolyData>::New();
+    surface_->ShallowCopy(triangleFilter->GetOutput());
+
+    triangulation_.setWrapper(this);
+    if(surface_->GetNumberOfCells() > 0)
+      triangulation_.setInputData(surface_);
+
+    cinemaImaging_.clear();
+    SurfaceMTime = inputObject->GetMTime();
+  }
+
+  cinemaImaging_.setWrapper(this);
+
+  if(surface_->GetNumberOfCells() > 0) {
+    if(cinemaImaging_.setupTriangulation(triangulation_.getTriangulation())
+       != 0) {
+      stringstream msg;
+      msg << "[ttkCinemaImaging] ERROR: Could not index the input surface."
+          << endl;
+      dMsg(cerr, msg.str(), fatalMsg);
+      return 0;
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Render Images for all Camera Locations
+  // -------------------------------------------------------------------------
+  size_t n = inputGrid->GetNumberOfPoints();
+  vector<double> camPositions(3 * n);
+  for(size_t i = 0; i < n; i++) {
+    inputGrid->GetPoint(i, &camPositions[3 * i]);
+
+    // Cam Up Fix
+    if(camPositions[3 * i] == 0 && camPositions[3 * i + 2] == 0) {
+      camPositions[3 * i] = 0.00000000001;
+      camPositions[3 * i + 2] = 0.00000000001;
+    }
+  }
+
+  // default view up of vtkCamera
+  const double camUp[3] = {0, 1, 0};
+  const size_t imageSize = (size_t)this->Resolution[0] * this->Resolution[1];
+  const bool isEmpty = surface_->GetNumberOfCells() == 0;
+
+  // one image per value array component, as the value passes of the VTK
+  // backend
+  vector<pair<vtkDataArray *, int>> pointArrays, cellArrays;
+  auto listArrays = [](vtkFieldData *data,
+                       vector<pair<vtkDataArray *, int>> &arrays) {
+    size_t nArrays = data->GetNumberOfArrays();
+    for(size_t j = 0; j < nArrays; j++) {
+      auto values = data->GetArray(j);
+      if(values == nullptr)
+        continue;
+      int m = values->GetNumberOfComponents();
+      for(int k = 0; k < m; k++)
+        arrays.push_back(make_pair(values, k));
+    }
+  };
+  listArrays(surface_->GetPointData(), pointArrays);
+  listArrays(surface_->GetCellData(), cellArrays);
+
+  // The cameras are rendered in batches (one camera per thread): the
+  // primitive identifiers and barycentric coordinates are only stored for
+  // the current batch, the depth values are written in the output images
+  const size_t batchSize = max(1, threadNumber_);
+  vector<SimplexId> primitiveIds(min(batchSize, n) * imageSize, -1);
+  vector<float> barycentrics(2 * min(batchSize, n) * imageSize, 0);
+
+  for(size_t batchBegin = 0; batchBegin < n; batchBegin += batchSize) {
+    const size_t batchEnd = min(batchBegin + batchSize, n);
+    const size_t batchNumber = batchEnd - batchBegin;
+
+    // -----------------------------------------------------------------------
+    // Create Output Images and Render their Depth
+    // -----------------------------------------------------------------------
+    vector<vtkSmartPointer<vtkImageData>> images(batchNumber);
+    vector<float *> depthImages(batchNumber);
+    for(size_t b = 0; b < batchNumber; b++) {
+      images[b] = vtkSmartPointer<vtkImageData>::New();
+      images[b]->SetDimensions(this->Resolution[0], this->Resolution[1], 1);
+
+      auto depthValues = vtkSmartPointer<vtkFloatArray>::New();
+      depthValues->SetName("Depth");
+      depthValues->SetNumberOfValues(imageSize);
+      depthImages[b] = (float *)depthValues->GetVoidPointer(0);
+      images[b]->GetPointData()->AddArray(depthValues);
+    }
+
+    if(!isEmpty) {
+      cinemaImaging_.renderImages(
+        batchNumber, &camPositions[3 * batchBegin], this->CamFocus, camUp,
+        this->CamNearFar, this->CamHeight, this->Resolution,
+        depthImages.data(), primitiveIds.data(), barycentrics.data());
+    } else {
+      for(size_t b = 0; b < batchNumber; b++)
+        std::fill(depthImages[b], depthImages[b] + imageSize, 1.0F);
+    }
+
+    for(size_t b = 0; b < batchNumber; b++) {
+      const size_t i = batchBegin + b;
+      auto outputImage = images[b];
+      auto outputImagePD = outputImage->GetPointData();
+
+      // Add Field Data
+      this->AddFieldData(
+        outputImage, inputGrid, i, &camPositions[3 * i], camUp);
+
+      // Add Point Data
+      {
+        const SimplexId *imageIds = &primitiveIds[b * imageSize];
+        const float *imageBarycentrics = &barycentrics[2 * b * imageSize];
+
+        auto addValues = [&](const pair<vtkDataArray *, int> &passData,
+                             const bool isCellData) {
+          auto values = passData.first;
+          int m = values->GetNumberOfComponents();
+
+          auto data = vtkSmartPointer<vtkFloatArray>::New();
+          data->SetName(m < 2 ? values->GetName()
+                              : (string(values->GetName()) + "_"
+                                 + to_string(passData.second))
+                                  .data());
+          data->SetNumberOfValues(imageSize);
+          auto output = (float *)data->GetVoidPointer(0);
+
+          switch(values->GetDataType()) {
+            vtkTemplateMacro(({
+              auto input = (VTK_TT *)values->GetVoidPointer(0);
+              if(isCellData)
+                cinemaImaging_.lookupCellData<VTK_TT>(
+                  input, m, passData.second, imageSize, imageIds, output);
+              else
+                cinemaImaging_.interpolateVertexData<VTK_TT>(
+                  input, m, passData.second, imageSize, imageIds,
+                  imageBarycentrics, output);
+            }));
+          }
+          outputImagePD->AddArray(data);
+        };
+
+        for(auto &passData : pointArrays)
+          addValues(passData, false);
+        for(auto &passData : cellArrays)
+          addValues(passData, true);
+      }
+
+      // Add Image to MultiBlock
+      outputImages->SetBlock(i, outputImage);
+    }
+
+    this->updateProgress(((float)batchEnd) / ((float)n));
+  }
+
+  // Output Performance
+  {
+    stringstream msg;
+    msg << "[ttkCinemaImaging] "
+           "-------------------------------------------------------------"
+        << endl;
+    msg << "[ttkCinemaImaging] " << n << " Images rendered (CPU, "
+        << threadNumber_ << " thread(s))" << endl;
+    msg << "[ttkCinemaImaging]   time: " << t.getElapsedTime() << " s" << endl;
+    msg << "[ttkCinemaImaging] memory: " << mem.getElapsedUsage() << " MB"
+        << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 1;
+}
+
+int ttkCinemaImaging::RequestData(vtkInformation *request,
                                     vtkInformationVector **inputVector,
                                     vtkInformationVector *outputVector) {
   // Print Status
@@ -78,6 +347,9 @@ vtkStandardNewMacro(ttkCinemaImaging)
   toPoly->Update();
   auto poly = toPoly->GetOutput();
 
+  if(this->Backend == 1)
+    return this->RequestDataCPU(inputObject, poly, inputGrid, outputImages);
+
   // Camera
   auto camera = vtkSmartPointer<vtkCamera>::New();
   camera->SetParallelProjection(true);
@@ -227,29 +499,9 @@ vtkStandardNewMacro(ttkCinemaImaging)
   windowToImageFilter
     ->SetInputBufferTypeToZBuffer(); // Set output to depth buffer
 
-  // Prepare Field Data for Depth Values
-  auto ch = vtkSmartPointer<vtkDoubleArray>::New();
-  ch->SetName("CamHeight");
-  ch->SetNumberOfValues(1);
-  ch->SetValue(0, this->CamHeight);
-
-  auto cnf = vtkSmartPointer<vtkDoubleArray>::New();
-  cnf->SetName("CamNearFar");
-  cnf->SetNumberOfValues(2);
-  cnf->SetValue(0, this->CamNearFar[0]);
-  cnf->SetValue(1, this->CamNearFar[1]);
-
-  auto cr = vtkSmartPointer<vtkDoubleArray>::New();
-  cr->SetName("CamRes");
-  cr->SetNumberOfValues(2);
-  cr->SetValue(0, this->Resolution[0]);
-  cr->SetValue(1, this->Resolution[1]);
-
   // Iterate over Locations
   double camPosition[3] = {0, 0, 0};
   size_t n = inputGrid->GetNumberOfPoints();
-  auto inputGridPointData = inputGrid->GetPointData();
-  size_t nInputGridPointData = inputGridPointData->GetNumberOfArrays();
 
   for(size_t i = 0; i < n; i++) {
     // Set Camera Position
@@ -279,58 +531,8 @@ vtkStandardNewMacro(ttkCinemaImaging)
     }
 
     // Add Field Data
-    {
-      auto outputImageFD = outputImage->GetFieldData();
-
-      // Camera Parameters
-      outputImageFD->AddArray(ch);
-      outputImageFD->AddArray(cnf);
-      outputImageFD->AddArray(cr);
-
-      // Position
-      auto cp = vtkSmartPointer<vtkDoubleArray>::New();
-      cp->SetName("CamPosition");
-      cp->SetNumberOfValues(3);
-      cp->SetValue(0, camPosition[0]);
-      cp->SetValue(1, camPosition[1]);
-      cp->SetValue(2, camPosition[2]);
-      outputImageFD->AddArray(cp);
-
-      // Dir
-      auto cd = vtkSmartPointer<vtkDoubleArray>::New();
-      cd->SetName("CamDirection");
-      cd->SetNumberOfValues(3);
-      double tempCD[3] = {this->CamFocus[0] - camPosition[0],
-                          this->CamFocus[1] - camPosition[1],
-                          this->CamFocus[2] - camPosition[2]};
-      vtkMath::Normalize(tempCD);
-      cd->SetValue(0, tempCD[0]);
-      cd->SetValue(1, tempCD[1]);
-      cd->SetValue(2, tempCD[2]);
-      outputImageFD->AddArray(cd);
-
-      // Up
-      auto upd = camera->GetViewUp();
-      auto cu = vtkSmartPointer<vtkDoubleArray>::New();
-      cu->SetName("CamUp");
-      cu->SetNumberOfValues(3);
-      cu->SetValue(0, upd[0]);
-      cu->SetValue(1, upd[1]);
-      cu->SetValue(2, upd[2]);
-      outputImageFD->AddArray(cu);
-
-      for(size_t j = 0; j < nInputGridPointData; j++) {
-        auto array = inputGridPointData->GetAbstractArray(j);
-        auto newArray
-          = vtkSmartPointer<vtkAbstractArray>::Take(array->NewInstance());
-        newArray->SetName(array->GetName());
-        newArray->SetNumberOfTuples(1);
-        newArray->SetNumberOfComponents(array->GetNumberOfComponents());
-        array->GetTuples(i, i, newArray);
-
-        outputImageFD->AddArray(newArray);
-      }
-    }
+    this->AddFieldData(outputImage, inputGrid, i, camPosition,
+                       camera->GetViewUp());
 
 // Add Point Data
 #if VTK_MAJOR_VERSION >= 7
@@ -11,6 +11,12 @@
 /// have vtkDoubleArrays to override the default rendering parameters, i.e, the
 /// resolution, focus, clipping planes, and viewport height.
 ///
+/// Images are either rendered by VTK with OpenGL (default backend) or by the
+/// built-in ray caster of ttk::CinemaImaging (CPU backend), which does not
+/// require any graphics context and renders the cameras in parallel batches
+/// (one camera per thread). With the CPU backend, the input geometry is
+/// triangulated and indexed only when it changes.
+///
 /// VTK wrapping code for the @CinemaImaging package.
 ///
 /// \param Input vtkDataObject that will be depicted (vtkDataObject)
@@ -21,10 +27,17 @@
 #pragma once
 
 // VTK includes
+#include <vtkImageData.h>
 #include <vtkInformation.h>
+#include <vtkMultiBlockDataSet.h>
 #include <vtkMultiBlockDataSetAlgorithm.h>
+#include <vtkPointSet.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
 
 // TTK includes
+#include <CinemaImaging.h>
+#include <ttkTriangulation.h>
 #include <ttkWrapper.h>
 
 #ifndef TTK_PLUGIN
@@ -51,6 +64,10 @@ public:
   vtkSetMacro(CamHeight, double);
   vtkGetMacro(CamHeight, double);
 
+  /// 0: VTK (OpenGL), 1: CPU (ray casting)
+  vtkSetMacro(Backend, int);
+  vtkGetMacro(Backend, int);
+
   // default ttk setters
   vtkSetMacro(debugLevel_, int);
   void SetThreads() {
@@ -102,6 +119,7 @@ protected:
     double foc[3] = {0, 0, 0};
     SetCamFocus(foc);
     SetCamHeight(1);
+    SetBackend(0);
 
     UseAllCores = false;
 
@@ -117,11 +135,31 @@ protected:
   double CamNearFar[2];
   double CamFocus[3];
   double CamHeight;
+  int Backend;
 
   int RequestData(vtkInformation *request,
                   vtkInformationVector **inputVector,
                   vtkInformationVector *outputVector) override;
 
+  // render the images with the built-in ray caster
+  int RequestDataCPU(vtkDataObject *inputObject,
+                     vtkPolyData *poly,
+                     vtkPointSet *inputGrid,
+                     vtkMultiBlockDataSet *outputImages);
+
+  // camera parameters and sampling grid point data of image i
+  int AddFieldData(vtkImageData *outputImage,
+                   vtkPointSet *inputGrid,
+                   const size_t i,
+                   const double *camPosition,
+                   const double *camUp);
+
+  // triangulated surface and its ray casting index (CPU backend)
+  ttk::CinemaImaging cinemaImaging_;
+  ttkTriangulation triangulation_;
+  vtkSmartPointer<vtkPolyData> surface_;
+  vtkMTimeType SurfaceMTime{};
+
 private:
   bool needsToAbort() override {
     return GetAbortExecute();
@@ -1,5 +1,10 @@
 #include <ttkCinemaProductReader.h>
 
+#include <algorithm>
+#include <sys/stat.h>
+#include <unordered_set>
+
+#include <vtkDelimitedTextReader.h>
 #include <vtkDoubleArray.h>
 #include <vtkFieldData.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
@@ -11,6 +16,14 @@
 using namespace std;
 using namespace ttk;
 
+// Modification time of a file (-1 if the file does not exist)
+static long long getModificationTime(const string &path) {
+  struct stat fileStat;
+  if(stat(path.data(), &fileStat) != 0)
+    return -1;
+  return (long long)fileStat.st_mtime;
+}
+
 vtkStandardNewMacro(ttkCinemaProductReader)
 
   int ttkCinemaProductReader::RequestData(vtkInformation *request,
@@ -67,11 +80,23 @@ vtkStandardNewMacro(ttkCinemaProductReader)
       return 0;
     }
 
-    // For each row
+    // Product paths and modification times
+    vector<string> productPaths(n);
+    vector<long long> productTimes(n);
+    for(size_t i = 0; i < n; i++) {
+      productPaths[i]
+        = databasePath + "/" + paths->GetVariantValue(i).ToString();
+      productTimes[i] = getModificationTime(productPaths[i]);
+    }
+
+    // Look up the cache and list the products to read
+    size_t requestTime = ++this->productCacheTime;
+    vector<vtkSmartPointer<vtkDataObject>> products(n);
+    vector<string> toRead;
+    unordered_map<string, size_t> toReadIndex;
+    size_t nHits = 0;
     for(size_t i = 0; i < n; i++) {
-      // Get path
-      auto path = databasePath + "/" + paths->GetVariantValue(i).ToString();
-      auto ext = path.substr(path.length() - 3);
+      const auto &path = productPaths[i];
 
       {
         stringstream msg;
@@ -80,9 +105,7 @@ vtkStandardNewMacro(ttkCinemaProductReader)
       }
 
       // Check if file exists
-      std::ifstream infile(path.data());
-      bool exists = infile.good();
-      if(!exists) {
+      if(productTimes[i] < 0) {
         stringstream msg;
         msg << "[ttkCinemaProductReader]    ERROR: File does not exist."
             << endl;
@@ -90,17 +113,85 @@ vtkStandardNewMacro(ttkCinemaProductReader)
         continue;
       }
 
-      // Read any data using vtkXMLGenericDataObjectReader
-      {
-        auto reader = vtkSmartPointer<vtkXMLGenericDataObjectReader>::New();
-        reader->SetFileName(path.data());
-        reader->Update();
-        output->SetBlock(i, reader->GetOutput());
+      auto cached = this->productCache.find(path);
+      if(cached != this->productCache.end()
+         && cached->second.modificationTime == productTimes[i]) {
+        cached->second.lastUse = requestTime;
+        products[i] = cached->second.product;
+        nHits++;
+      } else if(toReadIndex.find(path) == toReadIndex.end()) {
+        toReadIndex[path] = toRead.size();
+        toRead.push_back(path);
+      }
+    }
+    size_t nRequested = toRead.size();
+
+    // Prefetch: the products of the neighboring rows are read along with
+    // the requested ones (also when all of these are cached)
+    if(this->CacheSize > 0 && this->PrefetchRadius > 0) {
+      vector<string> neighbors;
+      this->getNeighborProducts(databasePath, productPaths, neighbors);
+      for(auto &path : neighbors) {
+        if(toReadIndex.find(path) == toReadIndex.end()) {
+          toReadIndex[path] = toRead.size();
+          toRead.push_back(path);
+        }
+      }
+    }
+
+    // Read the products concurrently with vtkXMLGenericDataObjectReader
+    size_t nRead = toRead.size();
+    vector<vtkSmartPointer<vtkDataObject>> readProducts(nRead);
+    vector<long long> readTimes(nRead);
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threadNumber_)
+#endif
+    for(size_t k = 0; k < nRead; k++) {
+      readTimes[k] = getModificationTime(toRead[k]);
+      auto reader = vtkSmartPointer<vtkXMLGenericDataObjectReader>::New();
+      reader->SetFileName(toRead[k].data());
+      reader->Update();
+      readProducts[k] = reader->GetOutputDataObject(0);
+    }
+
+    // Cache the read products (requested ones are used now, prefetched ones
+    // are the first to be evicted)
+    if(this->CacheSize > 0) {
+      for(size_t k = 0; k < nRead; k++) {
+        if(!readProducts[k])
+          continue;
+        auto &entry = this->productCache[toRead[k]];
+        this->productCacheSize -= entry.memorySize;
+        entry.product = readProducts[k];
+        entry.modificationTime = readTimes[k];
+        entry.memorySize = readProducts[k]->GetActualMemorySize();
+        entry.lastUse = k < nRequested ? requestTime : requestTime - 1;
+        this->productCacheSize += entry.memorySize;
       }
+      this->trimCache(requestTime);
+    } else {
+      this->productCache.clear();
+      this->productCacheSize = 0;
+    }
+
+    // For each row
+    for(size_t i = 0; i < n; i++) {
+      if(productTimes[i] < 0)
+        continue;
+      if(!products[i])
+        products[i] = readProducts[toReadIndex[productPaths[i]]];
+      if(!products[i])
+        continue;
+
+      // The output block is a shallow copy such that the cached product is
+      // not augmented
+      auto block
+        = vtkSmartPointer<vtkDataObject>::Take(products[i]->NewInstance());
+      block->ShallowCopy(products[i]);
+      output->SetBlock(i, block);
 
       // Augment read data with row information
       // TODO: Make Optional
-      auto block = output->GetBlock(i);
       for(size_t j = 0; j < m; j++) {
         auto columnName = inputTable->GetColumnName(j);
         auto fieldData = block->GetFieldData();
@@ -125,6 +216,16 @@ vtkStandardNewMacro(ttkCinemaProductReader)
 
       this->updateProgress(((float)i) / ((float)(n - 1)));
     }
+
+    {
+      stringstream msg;
+      msg << "[ttkCinemaProductReader] " << nHits << " cached, "
+          << nRequested << " read, " << (nRead - nRequested)
+          << " prefetched (cache: " << this->productCache.size()
+          << " products, " << this->productCacheSize / 1024 << " MB)."
+          << endl;
+      dMsg(cout, msg.str(), infoMsg);
+    }
   }
 
   // Output Performance
@@ -142,3 +243,99 @@ vtkStandardNewMacro(ttkCinemaProductReader)
 
   return 1;
 }
+
+// =============================================================================
+// Cache management
+// =============================================================================
+int ttkCinemaProductReader::trimCache(const size_t &protectedTime) {
+  size_t budget = ((size_t)max(this->CacheSize, 0)) * 1024;
+
+  while(this->productCacheSize > budget) {
+    auto lru = this->productCache.end();
+    for(auto it = this->productCache.begin(); it != this->productCache.end();
+        ++it)
+      if(it->second.lastUse < protectedTime
+         && (lru == this->productCache.end()
+             || it->second.lastUse < lru->second.lastUse))
+        lru = it;
+
+    // only products of the current request are left
+    if(lru == this->productCache.end())
+      break;
+
+    this->productCacheSize -= lru->second.memorySize;
+    this->productCache.erase(lru);
+  }
+
+  return 1;
+}
+
+int ttkCinemaProductReader::getNeighborProducts(
+  const string &databasePath,
+  const vector<string> &productPaths,
+  vector<string> &neighbors) {
+
+  // (Re-)index the products of data.csv
+  string csvFile = databasePath + "/data.csv";
+  long long csvTime = getModificationTime(csvFile);
+  if(csvTime < 0)
+    return 0;
+
+  if(this->databaseIndexFile != csvFile || this->databaseIndexTime != csvTime) {
+    this->databaseIndexFile = csvFile;
+    this->databaseIndexTime = csvTime;
+    this->databaseProducts.clear();
+    this->databaseProductRows.clear();
+
+    auto reader = vtkSmartPointer<vtkDelimitedTextReader>::New();
+    reader->SetFileName(csvFile.data());
+    reader->DetectNumericColumnsOff();
+    reader->SetHaveHeaders(true);
+    reader->SetFieldDelimiterCharacters(",");
+    reader->Update();
+
+    auto table = reader->GetOutput();
+    auto column = table->GetColumnByName(this->FilepathColumnName.data());
+    if(column == nullptr)
+      return 0;
+
+    size_t nRows = table->GetNumberOfRows();
+    this->databaseProducts.resize(nRows);
+    for(size_t i = 0; i < nRows; i++) {
+      this->databaseProducts[i]
+        = databasePath + "/" + column->GetVariantValue(i).ToString();
+      this->databaseProductRows[this->databaseProducts[i]] = i;
+    }
+  }
+
+  // Rows at increasing distance from the requested ones (next rows first)
+  size_t nRows = this->databaseProducts.size();
+  unordered_set<string> listed(productPaths.begin(), productPaths.end());
+  for(int r = 1; r <= this->PrefetchRadius; r++) {
+    for(auto &path : productPaths) {
+      auto row = this->databaseProductRows.find(path);
+      if(row == this->databaseProductRows.end())
+        continue;
+
+      size_t candidates[2] = {row->second + r, row->second - r};
+      bool isValid[2] = {row->second + r < nRows, row->second >= (size_t)r};
+      for(int c = 0; c < 2; c++) {
+        if(!isValid[c])
+          continue;
+        auto &candidate = this->databaseProducts[candidates[c]];
+        if(!listed.insert(candidate).second)
+          continue;
+        long long candidateTime = getModificationTime(candidate);
+        auto cached = this->productCache.find(candidate);
+        if(candidateTime < 0
+           || (cached != this->productCache.end()
+               && cached->second.modificationTime == candidateTime))
+          continue;
+
+        neighbors.push_back(candidate);
+      }
+    }
+  }
+
+  return 1;
+}
@@ -10,6 +10,14 @@
 /// results are stored in a vtkMultiBlockDataSet where each block corresponds to
 /// a row of the table with consistent ordering.
 ///
+/// Products are decoded concurrently and kept in an in-memory LRU cache
+/// (keyed by file path and modification time, bounded by CacheSize MB) so
+/// that products shared by successive queries are not read again. With each
+/// request (including fully cached ones), the products of the rows
+/// surrounding the requested ones in the data.csv file of the Cinema database
+/// are read along and cached, so that browsing neighboring rows hits the
+/// cache.
+///
 /// \param Input vtkTable that contains data product references (vtkTable)
 /// \param Output vtkMultiBlockDataSet where each block is a referenced product
 /// of an input table row (vtkMultiBlockDataSet)
@@ -17,10 +25,16 @@
 #pragma once
 
 // VTK includes
+#include <vtkDataObject.h>
 #include <vtkFiltersCoreModule.h>
 #include <vtkInformation.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkMultiBlockDataSetAlgorithm.h>
+#include <vtkSmartPointer.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // TTK includes
 #include <ttkWrapper.h>
@@ -60,6 +74,12 @@ public:
     this->Modified();
   };
 
+  vtkSetMacro(CacheSize, int);
+  vtkGetMacro(CacheSize, int);
+
+  vtkSetMacro(PrefetchRadius, int);
+  vtkGetMacro(PrefetchRadius, int);
+
   int FillInputPortInformation(int port, vtkInformation *info) override {
     switch(port) {
       case 0:
@@ -84,6 +104,8 @@ public:
 
 protected:
   ttkCinemaProductReader() {
+    CacheSize = 1024;
+    PrefetchRadius = 1;
     UseAllCores = false;
 
     SetNumberOfInputPorts(1);
@@ -95,12 +117,40 @@ protected:
   int ThreadNumber;
 
   std::string FilepathColumnName;
+  int CacheSize;
+  int PrefetchRadius;
+
+  // Lists the (not yet cached) products of the rows surrounding the input
+  // products in the data.csv file of the database
+  int getNeighborProducts(const std::string &databasePath,
+                          const std::vector<std::string> &productPaths,
+                          std::vector<std::string> &neighbors);
+
+  // Evicts the least recently used products until the cache fits its budget
+  int trimCache(const size_t &protectedTime);
 
   int RequestData(vtkInformation *request,
                   vtkInformationVector **inputVector,
                   vtkInformationVector *outputVector) override;
 
 private:
+  struct CachedProduct {
+    vtkSmartPointer<vtkDataObject> product;
+    long long modificationTime{-1};
+    size_t memorySize{0}; // KB
+    size_t lastUse{0};
+  };
+
+  std::unordered_map<std::string, CachedProduct> productCache;
+  size_t productCacheSize{0}; // KB
+  size_t productCacheTime{0};
+
+  // product paths of data.csv, to find the neighbors of a product
+  std::string databaseIndexFile;
+  long long databaseIndexTime{-1};
+  std::vector<std::string> databaseProducts;
+  std::unordered_map<std::string, size_t> databaseProductRows;
+
   bool needsToAbort() override {
     return GetAbortExecute();
   };
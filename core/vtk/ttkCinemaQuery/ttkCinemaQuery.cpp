@@ -11,10 +11,24 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/algorithm/string/trim.hpp>
+
+#include <cstdlib>
 
 using namespace std;
 using namespace ttk;
 
+// Default location of the database cache (system temporary directory)
+static string getDefaultCacheFile() {
+  const char *directory = getenv("TMPDIR");
+#ifdef _WIN32
+  if(directory == nullptr)
+    directory = getenv("TEMP");
+#endif
+  return string(directory != nullptr ? directory : "/tmp")
+         + "/ttkCinemaQuery.sqlite";
+}
+
 vtkStandardNewMacro(ttkCinemaQuery)
 
   int ttkCinemaQuery::RequestData(vtkInformation *request,
@@ -48,40 +62,57 @@ vtkStandardNewMacro(ttkCinemaQuery)
     = vtkTable::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
   // -------------------------------------------------------------------------
-  // Convert Input Table to SQL Table
+  // Describe Input Table
   // -------------------------------------------------------------------------
-  string sqlTableDefinition, sqlTableRows;
-  {
-    int nc = inTable->GetNumberOfColumns();
-    int nr = inTable->GetNumberOfRows();
-
-    sqlTableDefinition = "CREATE TABLE InputTable (";
-    vector<bool> isNumeric(nc);
-    for(int i = 0; i < nc; i++) {
-      auto c = inTable->GetColumn(i);
-      isNumeric[i] = c->IsNumeric();
-      sqlTableDefinition += (i > 0 ? "," : "") + string(c->GetName()) + " "
-                            + (isNumeric[i] ? "REAL" : "TEXT");
-    }
-    sqlTableDefinition += ")";
-
-    sqlTableRows = "INSERT INTO InputTable VALUES ";
-    for(int j = 0; j < nr; j++) {
-      if(j > 0)
-        sqlTableRows += ",";
-      sqlTableRows += "(";
-      for(int i = 0; i < nc; i++) {
-        if(i > 0)
-          sqlTableRows += ",";
-        if(isNumeric[i])
-          sqlTableRows += inTable->GetValue(j, i).ToString();
-        else
-          sqlTableRows += "'" + inTable->GetValue(j, i).ToString() + "'";
+  size_t nc = inTable->GetNumberOfColumns();
+  size_t nr = inTable->GetNumberOfRows();
+
+  vector<string> columnNames(nc);
+  vector<bool> isNumeric(nc);
+  for(size_t i = 0; i < nc; i++) {
+    auto c = inTable->GetColumn(i);
+    columnNames[i] = c->GetName();
+    isNumeric[i] = c->IsNumeric();
+  }
+
+  auto getCell = [&](const size_t &row, const size_t &column) {
+    return inTable->GetValue(row, column).ToString();
+  };
+
+  // Optional persistent database, keyed on the data.csv file of the Cinema
+  // database (path, size and modification time, checked by CinemaQuery)
+  string databaseFile = "";
+  string sourceFile = "";
+  string tableSignature = "";
+  if(this->UseDatabaseCache) {
+    auto databasePath = vtkStringArray::SafeDownCast(
+      inTable->GetFieldData()->GetAbstractArray("DatabasePath"));
+    if(databasePath != nullptr && databasePath->GetNumberOfValues() > 0) {
+      sourceFile = databasePath->GetValue(0) + "/data.csv";
+      databaseFile = this->DatabaseCacheFile != "" ? this->DatabaseCacheFile
+                                                   : getDefaultCacheFile();
+
+      // the input table may be a subset of data.csv (e.g. output of another
+      // query): its first and last rows are part of the key (no full scan)
+      stringstream signature;
+      if(nr > 0) {
+        for(size_t i = 0; i < nc; i++)
+          signature << getCell(0, i) << "," << getCell(nr - 1, i) << ",";
       }
-      sqlTableRows += ")";
+      tableSignature = signature.str();
     }
   }
 
+  vector<string> indexedColumns;
+  if(this->IndexedColumns != "") {
+    boost::split(indexedColumns, this->IndexedColumns, boost::is_any_of(","));
+    for(auto &column : indexedColumns)
+      boost::trim(column);
+    indexedColumns.erase(
+      remove(indexedColumns.begin(), indexedColumns.end(), ""),
+      indexedColumns.end());
+  }
+
   // -------------------------------------------------------------------------
   // Replace Variables in QueryString (e.g. {time[2]})
   // -------------------------------------------------------------------------
@@ -132,8 +163,9 @@ vtkStandardNewMacro(ttkCinemaQuery)
   // -------------------------------------------------------------------------
   string result = "";
   {
-    int status = cinemaQuery.execute(
-      sqlTableDefinition, sqlTableRows, finalQueryString, result);
+    int status = cinemaQuery.execute(databaseFile, sourceFile, tableSignature,
+                                     columnNames, isNumeric, nr, getCell,
+                                     indexedColumns, finalQueryString, result);
     if(status != 1)
       return 0;
     if(result.compare("") == 0) {
@@ -7,7 +7,10 @@
 /// vtkTable.
 ///
 /// This filter creates a temporary SQLite3 database from the input table,
-/// performs a SQL query, and then returns the result as a vtkTable.
+/// performs a SQL query, and then returns the result as a vtkTable. If the
+/// input table comes from a Cinema database, the SQLite3 database can
+/// optionally be persisted in a single cache file (outside of the Cinema
+/// database) and reused across queries until data.csv changes.
 ///
 /// VTK wrapping code for the @CinemaQuery package.
 ///
@@ -58,6 +61,15 @@ public:
   vtkSetMacro(QueryString, std::string);
   vtkGetMacro(QueryString, std::string);
 
+  vtkSetMacro(UseDatabaseCache, bool);
+  vtkGetMacro(UseDatabaseCache, bool);
+
+  vtkSetMacro(DatabaseCacheFile, std::string);
+  vtkGetMacro(DatabaseCacheFile, std::string);
+
+  vtkSetMacro(IndexedColumns, std::string);
+  vtkGetMacro(IndexedColumns, std::string);
+
   int FillInputPortInformation(int port, vtkInformation *info) override {
     switch(port) {
       case 0:
@@ -83,6 +95,9 @@ public:
 protected:
   ttkCinemaQuery() {
     QueryString = "";
+    UseDatabaseCache = false;
+    DatabaseCacheFile = "";
+    IndexedColumns = "";
     UseAllCores = false;
 
     SetNumberOfInputPorts(1);
@@ -94,6 +109,9 @@ protected:
   int ThreadNumber;
 
   std::string QueryString;
+  bool UseDatabaseCache;
+  std::string DatabaseCacheFile;
+  std::string IndexedColumns;
   ttk::CinemaQuery cinemaQuery;
 
   int RequestData(vtkInformation *request,
@@ -10,7 +10,8 @@ ttkContourForests::ttkContourForests()
   : // Base //
     FieldId{0}, InputOffsetFieldId{-1},
     inputOffsetScalarFieldName_{ttk::OffsetScalarFieldName}, isLoaded_{},
-    lessPartition_{true}, tree_{},
+    lessPartition_{true}, partitionStrategy_{0}, overDecomposition_{1},
+    tree_{},
     // Here the given number of core only serve for preprocess,
     // a clean tree append before the true process and re-set
     // the good number of threads
@@ -255,6 +256,20 @@ void ttkContourForests::SetLessPartition(bool l) {
   Modified();
 }
 
+void ttkContourForests::SetPartitionStrategy(int strategy) {
+  partitionStrategy_ = strategy;
+
+  toComputeContourTree_ = true;
+  Modified();
+}
+
+void ttkContourForests::SetOverDecomposition(int overDecomposition) {
+  overDecomposition_ = overDecomposition;
+
+  toComputeContourTree_ = true;
+  Modified();
+}
+
 void ttkContourForests::SetSkeletonSmoothing(double skeletonSmoothing) {
   if(skeletonSmoothing >= 0) {
     toComputeSkeleton_ = true;
@@ -1401,6 +1416,9 @@ void ttkContourForests::getTree() {
   contourTree_.setTreeType(treeType_);
   // parallel params
   contourTree_.setLessPartition(lessPartition_);
+  contourTree_.setPartitionStrategy(
+    static_cast<PartitionStrategy>(partitionStrategy_));
+  contourTree_.setOverDecomposition(overDecomposition_);
   contourTree_.setThreadNumber(threadNumber_);
   contourTree_.setPartitionNum(partitionNum_);
   // simplification params
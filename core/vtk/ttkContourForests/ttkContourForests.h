@@ -115,6 +115,8 @@ public:
   void SetArcResolution(int arcResolution);
   void SetPartitionNumber(int partitionNum);
   void SetLessPartition(bool l);
+  void SetPartitionStrategy(int strategy);
+  void SetOverDecomposition(int overDecomposition);
 
   void SetSkeletonSmoothing(double skeletonSmooth);
 
@@ -187,6 +189,8 @@ private:
   std::string inputOffsetScalarFieldName_;
   bool isLoaded_;
   bool lessPartition_;
+  int partitionStrategy_;
+  int overDecomposition_;
   ttk::cf::MergeTree *tree_;
   ttk::cf::ContourForests contourTree_;
   vtkPolyData *skeletonNodes_;
@@ -9,6 +9,7 @@
 
 #include <vtkDataArray.h>
 #include <vtkDoubleArray.h>
+#include <vtkIntArray.h>
 
 using namespace std;
 using namespace ttk;
@@ -44,6 +45,10 @@ vtkStandardNewMacro(ttkDepthImageBasedGeometryApproximation)
   auto outputMBD = vtkMultiBlockDataSet::SafeDownCast(
     outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
+  // Process all depth images at once
+  if(this->GetMergeOutput())
+    return this->RequestDataMerged(inputMBD, outputMBD);
+
   // Process each depth image individually
   size_t nBlocks = inputMBD->GetNumberOfBlocks();
   for(size_t i = 0; i < nBlocks; i++) {
@@ -193,3 +198,224 @@ vtkStandardNewMacro(ttkDepthImageBasedGeometryApproximation)
 
   return 1;
 }
+
+int ttkDepthImageBasedGeometryApproximation::RequestDataMerged(
+  vtkMultiBlockDataSet *inputMBD, vtkMultiBlockDataSet *outputMBD) {
+  Memory mem;
+  Timer t;
+
+  size_t nBlocks = inputMBD->GetNumberOfBlocks();
+
+  // No depth image: the merged output is an empty grid
+  if(nBlocks == 0) {
+    outputMBD->SetNumberOfBlocks(1);
+    outputMBD->SetBlock(0, vtkSmartPointer<vtkUnstructuredGrid>::New());
+    return 1;
+  }
+
+  // Gather depth images and camera parameters
+  vector<vtkImageData *> images(nBlocks);
+  vector<void *> depthPointers(nBlocks);
+  vector<DepthImageBasedGeometryApproximation::CameraParameters> cameras(
+    nBlocks);
+  int depthDataType = VTK_VOID;
+
+  for(size_t i = 0; i < nBlocks; i++) {
+    auto inputImage = vtkImageData::SafeDownCast(inputMBD->GetBlock(i));
+    if(inputImage == nullptr) {
+      stringstream msg;
+      msg << "[ttkDepthImageBasedGeometryApproximation] ERROR: Block " << i
+          << " is not a depth image" << endl;
+      dMsg(cout, msg.str(), fatalMsg);
+      return 0;
+    }
+    images[i] = inputImage;
+
+    auto depthValues = inputImage->GetPointData()->GetAbstractArray(
+      this->GetDepthScalarField().data());
+
+    auto inFieldData = inputImage->GetFieldData();
+    auto camHeight = inFieldData->GetAbstractArray("CamHeight");
+    auto camPosition = inFieldData->GetAbstractArray("CamPosition");
+    auto camDirection = inFieldData->GetAbstractArray("CamDirection");
+    auto camUp = inFieldData->GetAbstractArray("CamUp");
+    auto camNearFar = inFieldData->GetAbstractArray("CamNearFar");
+    auto camRes = inFieldData->GetAbstractArray("CamRes");
+
+    // Check if all parameters are present
+    if(depthValues == nullptr || camHeight == nullptr || camPosition == nullptr
+       || camDirection == nullptr || camUp == nullptr || camNearFar == nullptr
+       || camRes == nullptr) {
+      stringstream msg;
+      msg << "[ttkDepthImageBasedGeometryApproximation] ERROR: Input depth "
+             "image does not have one or more of the required fields (see "
+             "Cinema Spec D - Data Product Specification)"
+          << endl;
+      dMsg(cout, msg.str(), fatalMsg);
+      return 0;
+    }
+
+    // All depth images are processed with the same template instance
+    if(i == 0) {
+      depthDataType = depthValues->GetDataType();
+    } else if(depthValues->GetDataType() != depthDataType) {
+      stringstream msg;
+      msg << "[ttkDepthImageBasedGeometryApproximation] ERROR: Depth values "
+             "of all images must have the same data type to be merged"
+          << endl;
+      dMsg(cout, msg.str(), fatalMsg);
+      return 0;
+    }
+
+    depthPointers[i] = depthValues->GetVoidPointer(0);
+    cameras[i].camPos = (double *)camPosition->GetVoidPointer(0);
+    cameras[i].camDir = (double *)camDirection->GetVoidPointer(0);
+    cameras[i].camUp = (double *)camUp->GetVoidPointer(0);
+    cameras[i].camRes = (double *)camRes->GetVoidPointer(0);
+    cameras[i].camNearFar = (double *)camNearFar->GetVoidPointer(0);
+    cameras[i].camHeight = (double *)camHeight->GetVoidPointer(0);
+  }
+
+  // Vectors to hold raw approximated geometry
+  vector<size_t> imageIndices;
+  vector<size_t> indicies;
+  vector<tuple<double, double, double>> vertices;
+  vector<tuple<SimplexId, SimplexId, SimplexId>> triangles;
+  vector<double> triangleDistortions;
+
+  // Approximate geometry
+  int status = 0;
+  switch(depthDataType) {
+    vtkTemplateMacro(({
+      vector<VTK_TT *> depths(nBlocks);
+      for(size_t i = 0; i < nBlocks; i++)
+        depths[i] = (VTK_TT *)depthPointers[i];
+
+      status = depthImageBasedGeometryApproximation_.executeBatch<VTK_TT>(
+        // Input
+        depths, cameras, this->GetSubsampling(),
+
+        // Output
+        imageIndices, indicies, vertices, triangles, triangleDistortions);
+    }));
+  }
+  if(status != 0)
+    return 0;
+
+  // Represent approximated geometry via VTK
+  auto mesh = vtkSmartPointer<vtkUnstructuredGrid>::New();
+
+  // Create points
+  {
+    size_t n = vertices.size();
+
+    auto points = vtkSmartPointer<vtkPoints>::New();
+    points->SetNumberOfPoints(n);
+
+    auto pointCoords = (float *)points->GetVoidPointer(0);
+    size_t j = 0;
+    for(auto &x : vertices) {
+      pointCoords[j++] = get<0>(x);
+      pointCoords[j++] = get<1>(x);
+      pointCoords[j++] = get<2>(x);
+    }
+
+    mesh->SetPoints(points);
+  }
+
+  // Copy Point Data (arrays present in every depth image)
+  {
+    auto firstPointData = images[0]->GetPointData();
+    size_t n = firstPointData->GetNumberOfArrays();
+
+    auto outPointData = mesh->GetPointData();
+    size_t m = indicies.size();
+
+    for(size_t j = 0; j < n; j++) {
+      auto name = firstPointData->GetArrayName(j);
+
+      vector<vtkDataArray *> inArrays(nBlocks);
+      bool isShared = true;
+      for(size_t i = 0; i < nBlocks && isShared; i++) {
+        inArrays[i] = images[i]->GetPointData()->GetArray(name);
+        isShared = inArrays[i] != nullptr;
+      }
+      if(!isShared)
+        continue;
+
+      auto outArray = vtkDataArray::CreateDataArray(inArrays[0]->GetDataType());
+      outArray->SetName(name);
+      outArray->SetNumberOfComponents(inArrays[0]->GetNumberOfComponents());
+      outArray->SetNumberOfTuples(m);
+
+      for(size_t k = 0; k < m; k++) {
+        outArray->SetTuple(k, inArrays[imageIndices[k]]->GetTuple(indicies[k]));
+      }
+
+      outPointData->AddArray(outArray);
+      outArray->Delete();
+    }
+
+    // Depth image of each point
+    auto imageIndexScalars = vtkSmartPointer<vtkIntArray>::New();
+    imageIndexScalars->SetNumberOfComponents(1);
+    imageIndexScalars->SetNumberOfValues(m);
+    imageIndexScalars->SetName("ImageIndex");
+    for(size_t k = 0; k < m; k++) {
+      imageIndexScalars->SetValue(k, imageIndices[k]);
+    }
+    outPointData->AddArray(imageIndexScalars);
+  }
+
+  // Create cells
+  {
+    size_t n = triangles.size();
+
+    auto cells = vtkSmartPointer<vtkIdTypeArray>::New();
+    cells->SetNumberOfValues(4 * n);
+    auto cellIds = (vtkIdType *)cells->GetVoidPointer(0);
+
+    auto triangleDistortionsScalars = vtkSmartPointer<vtkDoubleArray>::New();
+    triangleDistortionsScalars->SetNumberOfValues(n);
+    triangleDistortionsScalars->SetNumberOfComponents(1);
+    triangleDistortionsScalars->SetName("Distortion");
+    double *triangleDistortionsScalarsData
+      = (double *)triangleDistortionsScalars->GetVoidPointer(0);
+
+    size_t q = 0;
+    for(size_t j = 0; j < triangles.size(); j++) {
+      cellIds[q++] = 3;
+      cellIds[q++] = (vtkIdType)get<0>(triangles[j]);
+      cellIds[q++] = (vtkIdType)get<1>(triangles[j]);
+      cellIds[q++] = (vtkIdType)get<2>(triangles[j]);
+
+      triangleDistortionsScalarsData[j] = triangleDistortions[j];
+    }
+
+    auto cellArray = vtkSmartPointer<vtkCellArray>::New();
+    cellArray->SetCells(n, cells);
+    mesh->SetCells(VTK_TRIANGLE, cellArray);
+
+    mesh->GetCellData()->AddArray(triangleDistortionsScalars);
+  }
+
+  outputMBD->SetNumberOfBlocks(1);
+  outputMBD->SetBlock(0, mesh);
+
+  // Print status
+  {
+    stringstream msg;
+    msg << "[ttkDepthImageBasedGeometryApproximation] "
+           "--------------------------------------"
+        << endl
+        << "[ttkDepthImageBasedGeometryApproximation] " << nBlocks
+        << " Images processed and merged" << endl
+        << "[ttkDepthImageBasedGeometryApproximation]   Time: "
+        << t.getElapsedTime() << " s" << endl
+        << "[ttkDepthImageBasedGeometryApproximation] Memory: "
+        << mem.getElapsedUsage() << " MB" << endl;
+    dMsg(cout, msg.str(), timeMsg);
+  }
+
+  return 1;
+}
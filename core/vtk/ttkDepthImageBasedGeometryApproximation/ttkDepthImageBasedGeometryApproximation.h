@@ -21,8 +21,11 @@
 /// represented by vtkImagedata objects. (vtkMultiBlockDataSet) \param
 /// Subsampling The factor that controls the sampling rate (0: no Subsampling,
 /// 1: skip every second sample, 2: skip every second and third sample...)
+/// \param MergeOutput Process the depth images in parallel and merge their
+/// geometries into a single unstructured grid (with an ImageIndex point data
+/// array)
 /// \param Output A set of unstructured grids where each grid corresponds to a
-/// depth image (vtkMultiBlockDataSet)
+/// depth image, or a single merged grid (vtkMultiBlockDataSet)
 ///
 /// \sa ttk::DepthImageBasedGeometryApproximation
 
@@ -30,6 +33,7 @@
 
 // VTK includes
 #include <vtkInformation.h>
+#include <vtkMultiBlockDataSet.h>
 #include <vtkMultiBlockDataSetAlgorithm.h>
 
 // TTK includes
@@ -55,6 +59,9 @@ public:
   vtkSetMacro(DepthScalarField, string);
   vtkGetMacro(DepthScalarField, string);
 
+  vtkSetMacro(MergeOutput, bool);
+  vtkGetMacro(MergeOutput, bool);
+
   // default ttk setters
   vtkSetMacro(debugLevel_, int);
   void SetThreads() {
@@ -97,6 +104,7 @@ public:
 protected:
   ttkDepthImageBasedGeometryApproximation() {
     Subsampling = 0;
+    MergeOutput = false;
 
     UseAllCores = false;
     SetNumberOfInputPorts(1);
@@ -111,8 +119,13 @@ protected:
                   vtkInformationVector **inputVector,
                   vtkInformationVector *outputVector) override;
 
+  // Process all the depth images at once into a single grid
+  int RequestDataMerged(vtkMultiBlockDataSet *inputMBD,
+                        vtkMultiBlockDataSet *outputMBD);
+
 private:
   int Subsampling;
+  bool MergeOutput;
   string DepthScalarField;
   ttk::DepthImageBasedGeometryApproximation
     depthImageBasedGeometryApproximation_;
@@ -8,7 +8,12 @@ vtkStandardNewMacro(ttkDimensionReduction)
   int ttkDimensionReduction::doIt(vtkTable *input, vtkTable *output) {
   Memory m;
 
-  if(dimensionReduction_.isPythonFound()) {
+  dimensionReduction_.setInputMethod(Method);
+  dimensionReduction_.setInputBackend(
+    static_cast<DimensionReduction::Backend>(Backend));
+
+  if(dimensionReduction_.useNativeBackend()
+     or dimensionReduction_.isPythonFound()) {
     const SimplexId numberOfRows = input->GetNumberOfRows();
     const SimplexId numberOfColumns = ScalarFields.size();
 
@@ -38,7 +43,6 @@ vtkStandardNewMacro(ttkDimensionReduction)
     dimensionReduction_.setInputFunctionName(FunctionName);
     dimensionReduction_.setInputMatrixDimensions(numberOfRows, numberOfColumns);
     dimensionReduction_.setInputMatrix(inputData.data());
-    dimensionReduction_.setInputMethod(Method);
     dimensionReduction_.setInputNumberOfComponents(NumberOfComponents);
     dimensionReduction_.setInputNumberOfNeighbors(NumberOfNeighbors);
     dimensionReduction_.setInputIsDeterministic(IsDeterministic);
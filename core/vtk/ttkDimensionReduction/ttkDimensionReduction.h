@@ -104,6 +104,8 @@ public:
 
   vtkSetMacro(KeepAllDataArrays, int);
   vtkGetMacro(KeepAllDataArrays, int);
+  vtkSetMacro(Backend, int);
+  vtkGetMacro(Backend, int);
 
   // SE
   vtkSetMacro(se_Affinity, std::string);
@@ -260,6 +262,7 @@ protected:
     NumberOfComponents = 2;
     NumberOfNeighbors = 5;
     Method = 2;
+    Backend = static_cast<int>(ttk::DimensionReduction::Backend::Auto);
 
     se_Affinity = "nearest_neighbors";
     se_Gamma = 1;
@@ -326,6 +329,7 @@ private:
   int Method;
   int IsDeterministic;
   bool KeepAllDataArrays;
+  int Backend;
 
   // se
   std::string se_Affinity;
@@ -7,6 +7,7 @@ vtkStandardNewMacro(ttkDistanceField)
 
   ttkDistanceField::ttkDistanceField()
   : identifiers_{} {
+  DistanceMethod = 0;
   OutputScalarFieldType = 0;
   OutputScalarFieldName = "OutputDistanceField";
   ForceInputVertexScalarField = false;
@@ -145,6 +146,7 @@ int ttkDistanceField::doIt(vector<vtkDataSet *> &inputs,
 
   distanceField_.setVertexNumber(numberOfPointsInDomain);
   distanceField_.setSourceNumber(numberOfPointsInSources);
+  distanceField_.setMethod(DistanceMethod);
 
   distanceField_.setVertexIdentifierScalarFieldPointer(
     identifiers_->GetVoidPointer(0));
@@ -20,11 +20,15 @@
 /// See the related ParaView example state files for usage examples within a
 /// VTK pipeline.
 ///
-/// \b Related \b publication \n
+/// \b Related \b publications \n
 /// "A note on two problems in connexion with graphs" \n
 /// Edsger W. Dijkstra \n
 /// Numerische Mathematik, 1959.
 ///
+/// "A Fast Iterative Method for Eikonal Equations" \n
+/// Won-Ki Jeong, Ross T. Whitaker \n
+/// SIAM Journal on Scientific Computing, 2008.
+///
 /// \sa ttk::DistanceField.cpp
 /// \sa vtkIdentifiers
 ///
@@ -75,6 +79,9 @@ public:
     SetThreads();
   }
 
+  vtkSetMacro(DistanceMethod, int);
+  vtkGetMacro(DistanceMethod, int);
+
   vtkSetMacro(OutputScalarFieldType, int);
   vtkGetMacro(OutputScalarFieldType, int);
 
@@ -100,6 +107,7 @@ protected:
 
 private:
   std::string ScalarField;
+  int DistanceMethod;
   int OutputScalarFieldType;
   std::string OutputScalarFieldName;
   bool ForceInputVertexScalarField;
@@ -35,6 +35,11 @@ int ttkEigenField::getTriangulation(vtkDataSet *input) {
   triangulation_->setWrapper(this);
   baseWorker_.setWrapper(this);
   baseWorker_.setupTriangulation(triangulation_);
+  // drop the cached factorization and eigenpairs if the mesh has changed
+  if(input->GetMTime() != MeshMTime) {
+    baseWorker_.clearCache();
+    MeshMTime = input->GetMTime();
+  }
   Modified();
 
   TTK_ABORT_KK(
@@ -63,6 +68,9 @@ int ttkEigenField::doIt(std::vector<vtkDataSet *> &inputs,
 
   baseWorker_.setEigenNumber(EigenNumber);
   baseWorker_.setComputeStatistics(ComputeStatistics);
+  baseWorker_.setSolverMode(
+    static_cast<ttk::EigenField::SolverMode>(SolverMode));
+  baseWorker_.setEigenBasisFile(EigenBasisFile);
 
   // array of eigenfunctions
   vtkSmartPointer<vtkDataArray> eigenFunctions{};
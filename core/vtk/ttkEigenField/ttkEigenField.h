@@ -87,6 +87,12 @@ public:
   vtkSetMacro(ComputeStatistics, bool);
   vtkGetMacro(ComputeStatistics, bool);
 
+  vtkSetMacro(SolverMode, int);
+  vtkGetMacro(SolverMode, int);
+
+  vtkSetMacro(EigenBasisFile, std::string);
+  vtkGetMacro(EigenBasisFile, std::string);
+
   // get mesh from VTK
   int getTriangulation(vtkDataSet *input);
 
@@ -115,6 +121,12 @@ private:
   unsigned int EigenNumber{500};
   // if statistics are to be computed
   bool ComputeStatistics{false};
+  // eigensolver mode (see ttk::EigenField::SolverMode)
+  int SolverMode{0};
+  // file storing the eigenbasis across sessions (none if empty)
+  std::string EigenBasisFile{};
+  // modification time of the last input mesh
+  vtkMTimeType MeshMTime{};
 
   // enum: float or double
   int OutputFieldType{EigenFieldType::Float};
@@ -14,6 +14,7 @@ vtkStandardNewMacro(ttkFiberSurface)
   CaseIds = true;
   PointMerge = false;
   RangeOctree = true;
+  EdgeCaching = true;
   PointMergeDistanceThreshold = 0.000001;
   SetNumberOfInputPorts(2);
 }
@@ -25,6 +26,7 @@ template <typename VTK_T1, typename VTK_T2>
 int ttkFiberSurface::dispatch() {
 #ifdef TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
   if(RangeOctree) {
+    fiberSurface_.setOctreeFileName(OctreeFileName);
     fiberSurface_.buildOctree<VTK_T1, VTK_T2>();
   }
 #endif // TTK_ENABLE_FIBER_SURFACE_WITH_RANGE_OCTREE
@@ -128,6 +130,12 @@ int ttkFiberSurface::doIt(vector<vtkDataSet *> &inputs,
   threadedVertexList_.resize(polygon->GetNumberOfCells());
   fiberSurface_.setPolygon(&inputPolygon_);
 
+  fiberSurface_.setEdgeCaching(EdgeCaching);
+  // any modification of the input data invalidates the cached edge sheets
+  fiberSurface_.setFieldVersion(
+    std::max(input->GetMTime(),
+             std::max(dataUfield->GetMTime(), dataVfield->GetMTime())));
+
   fiberSurface_.setPointMerging(PointMerge);
   fiberSurface_.setPointMergingThreshold(PointMergeDistanceThreshold);
 
@@ -119,6 +119,12 @@ public:
   vtkGetMacro(RangeOctree, bool);
   vtkSetMacro(RangeOctree, bool);
 
+  vtkGetMacro(EdgeCaching, bool);
+  vtkSetMacro(EdgeCaching, bool);
+
+  vtkGetMacro(OctreeFileName, std::string);
+  vtkSetMacro(OctreeFileName, std::string);
+
   vtkGetMacro(PointMergeDistanceThreshold, double);
   vtkSetMacro(PointMergeDistanceThreshold, double);
 
@@ -154,12 +160,12 @@ protected:
 
 private:
   bool RangeCoordinates, EdgeParameterization, EdgeIds, TetIds, CaseIds,
-    RangeOctree, PointMerge;
+    RangeOctree, EdgeCaching, PointMerge;
 
   double PointMergeDistanceThreshold;
 
-  std::string DataUcomponent, DataVcomponent, PolygonUcomponent,
-    PolygonVcomponent;
+  std::string DataUcomponent, DataVcomponent, OctreeFileName,
+    PolygonUcomponent, PolygonVcomponent;
 
   // NOTE: we assume here that this guy is small and that making a copy from
   // VTK is not an issue.
@@ -23,6 +23,7 @@ vtkStandardNewMacro(ttkPersistenceDiagram)
   ShowInsideDomain = false;
   computeDiagram_ = true;
   PeriodicBoundaryConditions = false;
+  BatchMode = false;
 
   triangulation_ = nullptr;
   CTDiagram_ = nullptr;
@@ -169,6 +170,67 @@ int ttkPersistenceDiagram::getOffsets(vtkDataSet *input) {
   return 0;
 }
 
+int ttkPersistenceDiagram::initPersistenceDiagram(
+  vtkUnstructuredGrid *persistenceDiagram, const bool withFieldId) const {
+
+  vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+
+  vtkSmartPointer<ttkSimplexIdTypeArray> vertexIdentifierScalars
+    = vtkSmartPointer<ttkSimplexIdTypeArray>::New();
+  vertexIdentifierScalars->SetNumberOfComponents(1);
+  vertexIdentifierScalars->SetName(ttk::VertexScalarFieldName);
+
+  vtkSmartPointer<vtkIntArray> nodeTypeScalars
+    = vtkSmartPointer<vtkIntArray>::New();
+  nodeTypeScalars->SetNumberOfComponents(1);
+  nodeTypeScalars->SetName("CriticalType");
+
+  vtkSmartPointer<vtkFloatArray> coordsScalars
+    = vtkSmartPointer<vtkFloatArray>::New();
+  coordsScalars->SetNumberOfComponents(3);
+  coordsScalars->SetName("Coordinates");
+
+  vtkSmartPointer<ttkSimplexIdTypeArray> pairIdentifierScalars
+    = vtkSmartPointer<ttkSimplexIdTypeArray>::New();
+  pairIdentifierScalars->SetNumberOfComponents(1);
+  pairIdentifierScalars->SetName("PairIdentifier");
+
+  vtkSmartPointer<vtkIntArray> extremumIndexScalars
+    = vtkSmartPointer<vtkIntArray>::New();
+  extremumIndexScalars->SetNumberOfComponents(1);
+  extremumIndexScalars->SetName("PairType");
+
+  vtkSmartPointer<vtkDoubleArray> persistenceScalars
+    = vtkSmartPointer<vtkDoubleArray>::New();
+  persistenceScalars->SetNumberOfComponents(1);
+  persistenceScalars->SetName("Persistence");
+
+  persistenceDiagram->SetPoints(points);
+  persistenceDiagram->GetPointData()->AddArray(vertexIdentifierScalars);
+  persistenceDiagram->GetPointData()->AddArray(nodeTypeScalars);
+  persistenceDiagram->GetPointData()->AddArray(coordsScalars);
+  persistenceDiagram->GetCellData()->AddArray(pairIdentifierScalars);
+  persistenceDiagram->GetCellData()->AddArray(extremumIndexScalars);
+  persistenceDiagram->GetCellData()->AddArray(persistenceScalars);
+
+  if(withFieldId) {
+    vtkSmartPointer<vtkIntArray> pointFieldIdentifierScalars
+      = vtkSmartPointer<vtkIntArray>::New();
+    pointFieldIdentifierScalars->SetNumberOfComponents(1);
+    pointFieldIdentifierScalars->SetName("FieldId");
+
+    vtkSmartPointer<vtkIntArray> cellFieldIdentifierScalars
+      = vtkSmartPointer<vtkIntArray>::New();
+    cellFieldIdentifierScalars->SetNumberOfComponents(1);
+    cellFieldIdentifierScalars->SetName("FieldId");
+
+    persistenceDiagram->GetPointData()->AddArray(pointFieldIdentifierScalars);
+    persistenceDiagram->GetCellData()->AddArray(cellFieldIdentifierScalars);
+  }
+
+  return 0;
+}
+
 template <typename VTK_TT>
 int ttkPersistenceDiagram::deleteDiagram() {
   using tuple_t = tuple<SimplexId, CriticalType, SimplexId, CriticalType,
@@ -226,6 +288,82 @@ int ttkPersistenceDiagram::dispatch() {
   return ret;
 }
 
+template <typename VTK_TT>
+int ttkPersistenceDiagram::dispatchBatch(
+  const vector<vtkDataArray *> &scalarFields) {
+  int ret = 0;
+  using tuple_t = tuple<SimplexId, CriticalType, SimplexId, CriticalType,
+                        VTK_TT, SimplexId>;
+
+  // one field per component, multi-component arrays are de-interleaved
+  vector<vector<VTK_TT>> components;
+  for(auto scalarField : scalarFields) {
+    const int componentNumber = scalarField->GetNumberOfComponents();
+    if(componentNumber == 1)
+      continue;
+    const SimplexId tupleNumber = scalarField->GetNumberOfTuples();
+    const VTK_TT *values
+      = static_cast<const VTK_TT *>(scalarField->GetVoidPointer(0));
+    for(int j = 0; j < componentNumber; j++) {
+      components.emplace_back(tupleNumber);
+      vector<VTK_TT> &component = components.back();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+      for(SimplexId k = 0; k < tupleNumber; k++) {
+        component[k] = values[k * componentNumber + j];
+      }
+    }
+  }
+
+  vector<void *> fields;
+  size_t componentId = 0;
+  for(auto scalarField : scalarFields) {
+    if(scalarField->GetNumberOfComponents() == 1) {
+      fields.push_back(scalarField->GetVoidPointer(0));
+    } else {
+      for(int j = 0; j < scalarField->GetNumberOfComponents(); j++) {
+        fields.push_back(components[componentId++].data());
+      }
+    }
+  }
+
+  vector<vector<tuple_t>> diagrams(fields.size());
+  vector<void *> diagramPointers(fields.size());
+  for(size_t i = 0; i < diagrams.size(); i++)
+    diagramPointers[i] = &(diagrams[i]);
+
+  const vector<void *> offsets{inputOffsets_->GetVoidPointer(0)};
+  if(inputOffsets_->GetDataType() == VTK_INT)
+    ret = persistenceDiagram_.executeBatch<VTK_TT, int>(
+      fields, offsets, diagramPointers);
+  if(inputOffsets_->GetDataType() == VTK_ID_TYPE)
+    ret = persistenceDiagram_.executeBatch<VTK_TT, vtkIdType>(
+      fields, offsets, diagramPointers);
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(ret) {
+    cerr << "[ttkPersistenceDiagram] PersistenceDiagram.executeBatch() "
+         << "error code : " << ret << endl;
+    return -4;
+  }
+#endif
+
+  vector<const VTK_TT *> scalars(fields.size());
+  for(size_t i = 0; i < fields.size(); i++)
+    scalars[i] = static_cast<const VTK_TT *>(fields[i]);
+
+  ret = getBatchPersistenceDiagrams<VTK_TT>(scalars, diagrams);
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(ret) {
+    cerr << "[ttkPersistenceDiagram] Error : "
+         << "build of batch persistence diagrams has failed." << endl;
+    return -5;
+  }
+#endif
+
+  return ret;
+}
+
 int ttkPersistenceDiagram::doIt(vector<vtkDataSet *> &inputs,
                                 vector<vtkDataSet *> &outputs) {
 
@@ -262,6 +400,89 @@ int ttkPersistenceDiagram::doIt(vector<vtkDataSet *> &inputs,
 
   int ret{};
 
+  if(BatchMode) {
+    if(ShowInsideDomain) {
+      cerr << "[ttkPersistenceDiagram] Error : the embedding of the diagrams "
+              "in the domain is not supported in batch mode."
+           << endl;
+      return -1;
+    }
+
+    // the single-field state (inputScalars_, CTDiagram_) is left untouched
+    vector<vtkDataArray *> scalarFields;
+    for(const auto &name : BatchScalarFields) {
+      vtkDataArray *scalarField = input->GetPointData()->GetArray(name.data());
+      if(!scalarField)
+        continue;
+      if(scalarFields.size()
+         and scalarField->GetDataType() != scalarFields[0]->GetDataType()) {
+        stringstream msg;
+        msg << "[ttkPersistenceDiagram] Field `" << name
+            << "' skipped (data type differs from the rest of the batch)."
+            << endl;
+        dMsg(cerr, msg.str(), infoMsg);
+        continue;
+      }
+      scalarFields.push_back(scalarField);
+    }
+
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(scalarFields.empty()) {
+      cerr << "[ttkPersistenceDiagram] Error : no batch scalar field." << endl;
+      return -1;
+    }
+#endif
+
+    {
+      stringstream msg;
+      msg << "[ttkPersistenceDiagram] Starting batch computation on "
+          << scalarFields.size() << " array(s)..." << endl;
+      dMsg(cout, msg.str(), infoMsg);
+    }
+
+    ret = getTriangulation(input);
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(ret) {
+      cerr << "[ttkPersistenceDiagram] Error : wrong triangulation." << endl;
+      return -2;
+    }
+#endif
+
+    ret = getOffsets(input);
+#ifndef TTK_ENABLE_KAMIKAZE
+    if(ret) {
+      cerr << "[ttkPersistenceDiagram] Error : wrong offsets." << endl;
+      return -3;
+    }
+    if(inputOffsets_->GetDataType() != VTK_INT
+       and inputOffsets_->GetDataType() != VTK_ID_TYPE) {
+      cerr << "[ttkPersistenceDiagram] Error : input offset field type not "
+              "supported."
+           << endl;
+      return -1;
+    }
+#endif
+
+    persistenceDiagram_.setWrapper(this);
+    persistenceDiagram_.setComputeSaddleConnectors(ComputeSaddleConnectors);
+    switch(scalarFields[0]->GetDataType()) {
+      vtkTemplateMacro(ret = dispatchBatch<VTK_TT>(scalarFields));
+    }
+
+    outputCTPersistenceDiagram->ShallowCopy(CTPersistenceDiagram_);
+    // the single-field diagram needs to be recomputed when leaving batch mode
+    computeDiagram_ = true;
+
+    {
+      stringstream msg;
+      msg << "[ttkPersistenceDiagram] Memory usage: " << m.getElapsedUsage()
+          << " MB." << endl;
+      dMsg(cout, msg.str(), memoryMsg);
+    }
+
+    return ret;
+  }
+
   ret = getScalars(input);
 #ifndef TTK_ENABLE_KAMIKAZE
   if(ret) {
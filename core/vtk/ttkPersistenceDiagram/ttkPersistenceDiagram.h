@@ -26,6 +26,14 @@
 /// triangulation (vtkDataSet)
 /// \param Output Output persistence diagram (vtkUnstructuredGrid)
 ///
+/// In batch mode, the persistence diagrams of several scalar fields (all the
+/// components of all the selected arrays) are computed at once, re-using the
+/// contour tree structures from one field to the next and distributing the
+/// fields among the threads on small meshes. The output then gathers all the
+/// diagrams, with an additional "FieldId" array (on points and cells)
+/// identifying the field of each pair (fields are numbered component-wise, in
+/// the order of the selected arrays).
+///
 /// This filter can be used as any other VTK filter (for instance, by using the
 /// sequence of calls SetInputData(), Update(), GetOutput()).
 ///
@@ -148,24 +156,49 @@ public:
   }
   vtkGetMacro(PeriodicBoundaryConditions, int);
 
+  void SetBatchMode(int data) {
+    BatchMode = data;
+    Modified();
+    computeDiagram_ = true;
+  }
+  vtkGetMacro(BatchMode, int);
+
+  void SetBatchScalarFields(std::string s) {
+    BatchScalarFields.push_back(s);
+    Modified();
+    computeDiagram_ = true;
+  }
+
+  void ClearBatchScalarFields() {
+    BatchScalarFields.clear();
+    Modified();
+    computeDiagram_ = true;
+  }
+
   int getScalars(vtkDataSet *input);
   int getTriangulation(vtkDataSet *input);
   int getOffsets(vtkDataSet *input);
 
+  // Creates the (empty) points and arrays of a persistence diagram output,
+  // with FieldId arrays if withFieldId is true.
+  int initPersistenceDiagram(vtkUnstructuredGrid *persistenceDiagram,
+                             const bool withFieldId) const;
+
+  // Appends a persistence diagram (one line per pair and the diagonal) to an
+  // output initialized with initPersistenceDiagram(). scalars is the field
+  // the diagram was computed on, fieldId tags the points and cells of the
+  // diagram (if the output has FieldId arrays).
   template <typename scalarType>
-  int setPersistenceDiagramInfo(
-    ttk::SimplexId id,
-    vtkSmartPointer<ttkSimplexIdTypeArray> vertexIdentifierScalars,
-    vtkSmartPointer<vtkIntArray> nodeTypeScalars,
-    vtkSmartPointer<vtkFloatArray> coordsScalars,
+  int appendPersistenceDiagram(
     const std::vector<std::tuple<ttk::SimplexId,
                                  ttk::CriticalType,
                                  ttk::SimplexId,
                                  ttk::CriticalType,
                                  scalarType,
                                  ttk::SimplexId>> &diagram,
-    vtkSmartPointer<vtkPoints> points,
-    vtkIdType ids[3]);
+    const scalarType *scalars,
+    const int fieldId,
+    vtkUnstructuredGrid *persistenceDiagram) const;
 
   template <typename scalarType>
   int getPersistenceDiagram(
@@ -203,9 +236,22 @@ public:
                                  scalarType,
                                  ttk::SimplexId>> &diagram);
 
+  template <typename scalarType>
+  int getBatchPersistenceDiagrams(
+    const std::vector<const scalarType *> &fields,
+    const std::vector<std::vector<std::tuple<ttk::SimplexId,
+                                             ttk::CriticalType,
+                                             ttk::SimplexId,
+                                             ttk::CriticalType,
+                                             scalarType,
+                                             ttk::SimplexId>>> &diagrams);
+
   template <typename VTK_TT>
   int deleteDiagram();
 
+  template <typename VTK_TT>
+  int dispatchBatch(const std::vector<vtkDataArray *> &scalarFields);
+
   template <typename VTK_TT>
   int dispatch();
 
@@ -224,6 +270,8 @@ private:
   bool ComputeSaddleConnectors;
   int ShowInsideDomain;
   bool PeriodicBoundaryConditions;
+  bool BatchMode;
+  std::vector<std::string> BatchScalarFields;
 
   ttk::PersistenceDiagram persistenceDiagram_;
   ttk::Triangulation *triangulation_;
@@ -238,47 +286,117 @@ private:
 };
 
 template <typename scalarType>
-int ttkPersistenceDiagram::setPersistenceDiagramInfo(
-  ttk::SimplexId id,
-  vtkSmartPointer<ttkSimplexIdTypeArray> vertexIdentifierScalars,
-  vtkSmartPointer<vtkIntArray> nodeTypeScalars,
-  vtkSmartPointer<vtkFloatArray> coordsScalars,
+int ttkPersistenceDiagram::appendPersistenceDiagram(
   const std::vector<std::tuple<ttk::SimplexId,
                                ttk::CriticalType,
                                ttk::SimplexId,
                                ttk::CriticalType,
                                scalarType,
                                ttk::SimplexId>> &diagram,
-  vtkSmartPointer<vtkPoints> points,
-  vtkIdType ids[3]) {
-  double p[3] = {0, 0, 0};
-  const ttk::SimplexId a = std::get<0>(diagram[id]);
-  const ttk::SimplexId na
-    = static_cast<ttk::SimplexId>(std::get<1>(diagram[id]));
-  const ttk::SimplexId b = std::get<2>(diagram[id]);
-  const ttk::SimplexId nb
-    = static_cast<ttk::SimplexId>(std::get<3>(diagram[id]));
+  const scalarType *scalars,
+  const int fieldId,
+  vtkUnstructuredGrid *persistenceDiagram) const {
+
+  vtkPoints *points = persistenceDiagram->GetPoints();
+  vtkPointData *pointData = persistenceDiagram->GetPointData();
+  vtkCellData *cellData = persistenceDiagram->GetCellData();
+  vtkDataArray *vertexIdentifierScalars
+    = pointData->GetArray(ttk::VertexScalarFieldName);
+  vtkDataArray *nodeTypeScalars = pointData->GetArray("CriticalType");
+  vtkDataArray *coordsScalars = pointData->GetArray("Coordinates");
+  vtkDataArray *pointFieldIdentifierScalars = pointData->GetArray("FieldId");
+  vtkDataArray *pairIdentifierScalars = cellData->GetArray("PairIdentifier");
+  vtkDataArray *extremumIndexScalars = cellData->GetArray("PairType");
+  vtkDataArray *persistenceScalars = cellData->GetArray("Persistence");
+  vtkDataArray *cellFieldIdentifierScalars = cellData->GetArray("FieldId");
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!points || !vertexIdentifierScalars || !nodeTypeScalars || !coordsScalars
+     || !pairIdentifierScalars || !extremumIndexScalars
+     || !persistenceScalars)
+    return -1;
+#endif
 
-  nodeTypeScalars->InsertTuple1(2 * id, na);
-  nodeTypeScalars->InsertTuple1(2 * id + 1, nb);
+  const ttk::SimplexId minIndex = 0;
+  const ttk::SimplexId saddleSaddleIndex = 1;
+  const ttk::SimplexId maxIndex = triangulation_->getCellVertexNumber(0) - 2;
 
-  vertexIdentifierScalars->InsertTuple1(2 * id, a);
-  vertexIdentifierScalars->InsertTuple1(2 * id + 1, b);
+  const ttk::SimplexId diagramSize = diagram.size();
+  if(!diagramSize)
+    return 0;
 
+  vtkIdType ids[2];
+  vtkIdType oldIds[2];
+  double p[3] = {0, 0, 0};
   float coords[3];
-  triangulation_->getVertexPoint(a, coords[0], coords[1], coords[2]);
-  coordsScalars->InsertTuple3(2 * id, coords[0], coords[1], coords[2]);
 
-  triangulation_->getVertexPoint(b, coords[0], coords[1], coords[2]);
-  coordsScalars->InsertTuple3(2 * id + 1, coords[0], coords[1], coords[2]);
+  scalarType maxPersistenceValue = std::numeric_limits<scalarType>::min();
+  for(ttk::SimplexId i = 0; i < diagramSize; ++i) {
+    const ttk::SimplexId a = std::get<0>(diagram[i]);
+    const ttk::SimplexId b = std::get<2>(diagram[i]);
+    const scalarType persistenceValue = std::get<4>(diagram[i]);
+    const ttk::SimplexId type = std::get<5>(diagram[i]);
+    maxPersistenceValue = std::max(persistenceValue, maxPersistenceValue);
+
+    p[0] = scalars[a];
+    p[1] = scalars[a];
+    ids[0] = points->InsertNextPoint(p);
+    p[1] = scalars[b];
+    ids[1] = points->InsertNextPoint(p);
+
+    nodeTypeScalars->InsertTuple1(
+      ids[0], static_cast<ttk::SimplexId>(std::get<1>(diagram[i])));
+    nodeTypeScalars->InsertTuple1(
+      ids[1], static_cast<ttk::SimplexId>(std::get<3>(diagram[i])));
+    vertexIdentifierScalars->InsertTuple1(ids[0], a);
+    vertexIdentifierScalars->InsertTuple1(ids[1], b);
+    triangulation_->getVertexPoint(a, coords[0], coords[1], coords[2]);
+    coordsScalars->InsertTuple3(ids[0], coords[0], coords[1], coords[2]);
+    triangulation_->getVertexPoint(b, coords[0], coords[1], coords[2]);
+    coordsScalars->InsertTuple3(ids[1], coords[0], coords[1], coords[2]);
+    if(pointFieldIdentifierScalars) {
+      pointFieldIdentifierScalars->InsertTuple1(ids[0], fieldId);
+      pointFieldIdentifierScalars->InsertTuple1(ids[1], fieldId);
+    }
 
-  p[0] = inputScalars_->GetTuple1(a);
-  p[1] = inputScalars_->GetTuple1(a);
-  ids[0] = points->InsertNextPoint(p);
+    if(!i)
+      oldIds[0] = ids[0];
+
+    // add cell data
+    const vtkIdType cellId
+      = persistenceDiagram->InsertNextCell(VTK_LINE, 2, ids);
+    pairIdentifierScalars->InsertTuple1(cellId, i);
+    if(!i)
+      extremumIndexScalars->InsertTuple1(cellId, -1);
+    else {
+      switch(type) {
+        case 0:
+          extremumIndexScalars->InsertTuple1(cellId, minIndex);
+          break;
+
+        case 1:
+          extremumIndexScalars->InsertTuple1(cellId, saddleSaddleIndex);
+          break;
+
+        case 2:
+          extremumIndexScalars->InsertTuple1(cellId, maxIndex);
+          break;
+      }
+    }
+    persistenceScalars->InsertTuple1(cellId, persistenceValue);
+    if(cellFieldIdentifierScalars)
+      cellFieldIdentifierScalars->InsertTuple1(cellId, fieldId);
+  }
+  oldIds[1] = ids[0];
 
-  p[0] = inputScalars_->GetTuple1(a);
-  p[1] = inputScalars_->GetTuple1(b);
-  ids[1] = points->InsertNextPoint(p);
+  // add diag
+  const vtkIdType cellId
+    = persistenceDiagram->InsertNextCell(VTK_LINE, 2, oldIds);
+  pairIdentifierScalars->InsertTuple1(cellId, -1);
+  extremumIndexScalars->InsertTuple1(cellId, -1);
+  persistenceScalars->InsertTuple1(cellId, 2 * maxPersistenceValue);
+  if(cellFieldIdentifierScalars)
+    cellFieldIdentifierScalars->InsertTuple1(cellId, fieldId);
 
   return 0;
 }
@@ -292,102 +410,18 @@ int ttkPersistenceDiagram::getPersistenceDiagram(
                                ttk::CriticalType,
                                scalarType,
                                ttk::SimplexId>> &diagram) {
-  vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
 
   vtkSmartPointer<vtkUnstructuredGrid> persistenceDiagram
     = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  initPersistenceDiagram(persistenceDiagram, false);
 
-  vtkSmartPointer<ttkSimplexIdTypeArray> vertexIdentifierScalars
-    = vtkSmartPointer<ttkSimplexIdTypeArray>::New();
-  vertexIdentifierScalars->SetNumberOfComponents(1);
-  vertexIdentifierScalars->SetName(ttk::VertexScalarFieldName);
-
-  vtkSmartPointer<vtkIntArray> nodeTypeScalars
-    = vtkSmartPointer<vtkIntArray>::New();
-  nodeTypeScalars->SetNumberOfComponents(1);
-  nodeTypeScalars->SetName("CriticalType");
-
-  vtkSmartPointer<ttkSimplexIdTypeArray> pairIdentifierScalars
-    = vtkSmartPointer<ttkSimplexIdTypeArray>::New();
-  pairIdentifierScalars->SetNumberOfComponents(1);
-  pairIdentifierScalars->SetName("PairIdentifier");
-
-  vtkSmartPointer<vtkDoubleArray> persistenceScalars
-    = vtkSmartPointer<vtkDoubleArray>::New();
-  persistenceScalars->SetNumberOfComponents(1);
-  persistenceScalars->SetName("Persistence");
-
-  vtkSmartPointer<vtkIntArray> extremumIndexScalars
-    = vtkSmartPointer<vtkIntArray>::New();
-  extremumIndexScalars->SetNumberOfComponents(1);
-  extremumIndexScalars->SetName("PairType");
-
-  vtkSmartPointer<vtkFloatArray> coordsScalars
-    = vtkSmartPointer<vtkFloatArray>::New();
-  coordsScalars->SetNumberOfComponents(3);
-  coordsScalars->SetName("Coordinates");
-
-  const ttk::SimplexId minIndex = 0;
-  const ttk::SimplexId saddleSaddleIndex = 1;
-  const ttk::SimplexId maxIndex = triangulation_->getCellVertexNumber(0) - 2;
-
-  const ttk::SimplexId diagramSize = diagram.size();
-  if(diagramSize) {
-    vtkIdType ids[2];
-    vtkIdType oldIds[2];
-
-    scalarType maxPersistenceValue = std::numeric_limits<scalarType>::min();
-    oldIds[0] = 0;
-    for(ttk::SimplexId i = 0; i < diagramSize; ++i) {
-      const scalarType persistenceValue = std::get<4>(diagram[i]);
-      const ttk::SimplexId type = std::get<5>(diagram[i]);
-      maxPersistenceValue = std::max(persistenceValue, maxPersistenceValue);
-
-      setPersistenceDiagramInfo(i, vertexIdentifierScalars, nodeTypeScalars,
-                                coordsScalars, diagram, points, ids);
-
-      // add cell data
-      persistenceDiagram->InsertNextCell(VTK_LINE, 2, ids);
-      pairIdentifierScalars->InsertTuple1(i, i);
-      if(!i)
-        extremumIndexScalars->InsertTuple1(i, -1);
-      else {
-        switch(type) {
-          case 0:
-            extremumIndexScalars->InsertTuple1(i, minIndex);
-            break;
-
-          case 1:
-            extremumIndexScalars->InsertTuple1(i, saddleSaddleIndex);
-            break;
-
-          case 2:
-            extremumIndexScalars->InsertTuple1(i, maxIndex);
-            break;
-        }
-      }
-      persistenceScalars->InsertTuple1(i, persistenceValue);
-    }
-    oldIds[1] = ids[0];
-
-    // add diag
-    persistenceDiagram->InsertNextCell(VTK_LINE, 2, oldIds);
-    pairIdentifierScalars->InsertTuple1(diagramSize, -1);
-    extremumIndexScalars->InsertTuple1(diagramSize, -1);
-    persistenceScalars->InsertTuple1(diagramSize, 2 * maxPersistenceValue);
-  }
-
-  persistenceDiagram->SetPoints(points);
-  persistenceDiagram->GetPointData()->AddArray(vertexIdentifierScalars);
-  persistenceDiagram->GetPointData()->AddArray(nodeTypeScalars);
-  persistenceDiagram->GetPointData()->AddArray(coordsScalars);
-  persistenceDiagram->GetCellData()->AddArray(pairIdentifierScalars);
-  persistenceDiagram->GetCellData()->AddArray(extremumIndexScalars);
-  persistenceDiagram->GetCellData()->AddArray(persistenceScalars);
+  int ret = appendPersistenceDiagram(
+    diagram, static_cast<const scalarType *>(inputScalars_->GetVoidPointer(0)),
+    -1, persistenceDiagram.GetPointer());
 
   CTPersistenceDiagram_->ShallowCopy(persistenceDiagram);
 
-  return 0;
+  return ret;
 }
 
 template <typename scalarType>
@@ -535,4 +569,29 @@ int ttkPersistenceDiagram::getPersistenceDiagramInsideDomain(
   return 0;
 }
 
+template <typename scalarType>
+int ttkPersistenceDiagram::getBatchPersistenceDiagrams(
+  const std::vector<const scalarType *> &fields,
+  const std::vector<std::vector<std::tuple<ttk::SimplexId,
+                                           ttk::CriticalType,
+                                           ttk::SimplexId,
+                                           ttk::CriticalType,
+                                           scalarType,
+                                           ttk::SimplexId>>> &diagrams) {
+
+  vtkSmartPointer<vtkUnstructuredGrid> persistenceDiagram
+    = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  initPersistenceDiagram(persistenceDiagram, true);
+
+  for(size_t f = 0; f < diagrams.size(); f++) {
+    int ret = appendPersistenceDiagram(
+      diagrams[f], fields[f], f, persistenceDiagram.GetPointer());
+    if(ret)
+      return ret;
+  }
+
+  CTPersistenceDiagram_->ShallowCopy(persistenceDiagram);
+  return 0;
+}
+
 #endif // _TTK_PERSISTENCEDIAGRAM_H
@@ -27,6 +27,8 @@ vtkStandardNewMacro(ttkPlanarGraphLayout)
 
   // Set Wrapper
   planarGraphLayout.setWrapper(this);
+  planarGraphLayout.setInputEngine(
+    static_cast<PlanarGraphLayout::Engine>(this->GetLayoutEngine()));
 
   // Prepare input and output
   vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
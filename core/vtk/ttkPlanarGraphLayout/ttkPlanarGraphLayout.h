@@ -81,6 +81,10 @@ public:
   vtkSetMacro(LevelFieldName, std::string);
   vtkGetMacro(LevelFieldName, std::string);
 
+  // getters and setters for the layout engine (0: native, 1: Graphviz)
+  vtkSetMacro(LayoutEngine, int);
+  vtkGetMacro(LayoutEngine, int);
+
   // getters and setters for output field name
   vtkSetMacro(OutputFieldName, std::string);
   vtkGetMacro(OutputFieldName, std::string);
@@ -135,6 +139,7 @@ protected:
     SetUseLevels(false);
     SetLevelFieldName("");
 
+    SetLayoutEngine(0);
     SetOutputFieldName("Layout");
 
     UseAllCores = false;
@@ -162,6 +167,9 @@ private:
   bool UseLevels;
   std::string LevelFieldName;
 
+  // layout engine
+  int LayoutEngine;
+
   // output field name
   std::string OutputFieldName;
 
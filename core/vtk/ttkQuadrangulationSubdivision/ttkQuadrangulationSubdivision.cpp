@@ -41,6 +41,11 @@ int ttkQuadrangulationSubdivision::getTriangulation(
   trg->setWrapper(this);
   baseWorker_.setWrapper(this);
   baseWorker_.setupTriangulation(trg);
+  // re-index the input triangles only if the mesh has changed
+  if(input->GetMTime() != MeshMTime) {
+    baseWorker_.clearSpatialIndex();
+    MeshMTime = input->GetMTime();
+  }
   Modified();
 
   TTK_ABORT_KK(trg->isEmpty(), "ttkTriangulation allocation problem.", -2);
@@ -155,6 +155,9 @@ private:
   // display quadrangle statistics
   bool QuadStatistics{false};
 
+  // modification time of the triangulated input when last indexed
+  vtkMTimeType MeshMTime{};
+
   // base worker object
   ttk::QuadrangulationSubdivision baseWorker_{};
 };
@@ -17,6 +17,8 @@ vtkStandardNewMacro(ttkScalarFieldCriticalPoints)
   OffsetFieldId = -1;
   OffsetField = ttk::OffsetScalarFieldName;
 
+  BatchMode = false;
+
   UseAllCores = true;
 }
 
@@ -52,6 +54,65 @@ int ttkScalarFieldCriticalPoints::dispatch(Triangulation *triangulation,
   return 0;
 }
 
+template <typename VTK_TT>
+int ttkScalarFieldCriticalPoints::dispatchBatch(
+  Triangulation *triangulation,
+  const vector<vtkDataArray *> &scalarFields) {
+
+  ScalarFieldCriticalPoints<VTK_TT> criticalPoints;
+  criticalPoints.setWrapper(this);
+  criticalPoints.setupTriangulation(triangulation);
+  criticalPoints.setSosOffsets(&sosOffsets_);
+
+  // one field per component, multi-component arrays are de-interleaved
+  vector<vector<VTK_TT>> components;
+  for(auto scalarField : scalarFields) {
+    const int componentNumber = scalarField->GetNumberOfComponents();
+    if(componentNumber == 1)
+      continue;
+    const SimplexId tupleNumber = scalarField->GetNumberOfTuples();
+    const VTK_TT *values
+      = static_cast<const VTK_TT *>(scalarField->GetVoidPointer(0));
+    for(int j = 0; j < componentNumber; j++) {
+      components.emplace_back(tupleNumber);
+      vector<VTK_TT> &component = components.back();
+#ifdef TTK_ENABLE_OPENMP
+#pragma omp parallel for num_threads(threadNumber_)
+#endif
+      for(SimplexId k = 0; k < tupleNumber; k++) {
+        component[k] = values[k * componentNumber + j];
+      }
+    }
+  }
+  // pointers are taken once the component storage is stable
+  vector<const void *> fields;
+  size_t componentId = 0;
+  for(auto scalarField : scalarFields) {
+    if(scalarField->GetNumberOfComponents() == 1) {
+      fields.push_back(scalarField->GetVoidPointer(0));
+    } else {
+      for(int j = 0; j < scalarField->GetNumberOfComponents(); j++) {
+        fields.push_back(components[componentId++].data());
+      }
+    }
+  }
+
+  vector<vector<pair<SimplexId, char>>> outputs;
+  int ret = criticalPoints.executeBatch(fields, outputs);
+  if(ret)
+    return ret;
+
+  criticalPoints_.clear();
+  fieldIds_.clear();
+  for(size_t i = 0; i < outputs.size(); i++) {
+    criticalPoints_.insert(
+      criticalPoints_.end(), outputs[i].begin(), outputs[i].end());
+    fieldIds_.resize(criticalPoints_.size(), i);
+  }
+
+  return 0;
+}
+
 int ttkScalarFieldCriticalPoints::doIt(vector<vtkDataSet *> &inputs,
                                        vector<vtkDataSet *> &outputs) {
   Memory m;
@@ -100,8 +161,27 @@ int ttkScalarFieldCriticalPoints::doIt(vector<vtkDataSet *> &inputs,
   // should proceed in the same way.
   vtkDataArray *inputScalarField = NULL;
   vtkDataArray *offsetField = NULL;
-
-  if(ScalarField.length()) {
+  vector<vtkDataArray *> batchScalarFields;
+
+  if(BatchMode) {
+    for(const auto &name : BatchScalarFields) {
+      vtkDataArray *scalarField = input->GetPointData()->GetArray(name.data());
+      if(!scalarField)
+        continue;
+      if((inputScalarField)
+         && (scalarField->GetDataType() != inputScalarField->GetDataType())) {
+        stringstream msg;
+        msg << "[ttkScalarFieldCriticalPoints] Field `" << name
+            << "' skipped (data type differs from the rest of the batch)."
+            << endl;
+        dMsg(cerr, msg.str(), infoMsg);
+        continue;
+      }
+      if(!inputScalarField)
+        inputScalarField = scalarField;
+      batchScalarFields.push_back(scalarField);
+    }
+  } else if(ScalarField.length()) {
     inputScalarField = input->GetPointData()->GetArray(ScalarField.data());
   } else {
     inputScalarField = input->GetPointData()->GetArray(ScalarFieldId);
@@ -112,8 +192,13 @@ int ttkScalarFieldCriticalPoints::doIt(vector<vtkDataSet *> &inputs,
 
   {
     stringstream msg;
-    msg << "[ttkScalarFieldCriticalPoints] Starting computation on field `"
-        << inputScalarField->GetName() << "'..." << endl;
+    if(BatchMode) {
+      msg << "[ttkScalarFieldCriticalPoints] Starting batch computation on "
+          << batchScalarFields.size() << " array(s)..." << endl;
+    } else {
+      msg << "[ttkScalarFieldCriticalPoints] Starting computation on field `"
+          << inputScalarField->GetName() << "'..." << endl;
+    }
     dMsg(cout, msg.str(), infoMsg);
   }
 
@@ -149,10 +234,17 @@ int ttkScalarFieldCriticalPoints::doIt(vector<vtkDataSet *> &inputs,
     }
   }
 
-  switch(inputScalarField->GetDataType()) {
-    vtkTemplateMacro(dispatch<VTK_TT>(triangulation,
-                                      inputScalarField->GetVoidPointer(0),
-                                      input->GetNumberOfPoints()));
+  if(BatchMode) {
+    switch(inputScalarField->GetDataType()) {
+      vtkTemplateMacro(dispatchBatch<VTK_TT>(triangulation, batchScalarFields));
+    }
+  } else {
+    fieldIds_.clear();
+    switch(inputScalarField->GetDataType()) {
+      vtkTemplateMacro(dispatch<VTK_TT>(triangulation,
+                                        inputScalarField->GetVoidPointer(0),
+                                        input->GetNumberOfPoints()));
+    }
   }
 
   // allocate the output
@@ -174,6 +266,19 @@ int ttkScalarFieldCriticalPoints::doIt(vector<vtkDataSet *> &inputs,
   output->SetPoints(pointSet);
   output->GetPointData()->AddArray(vertexTypes);
 
+  if(BatchMode) {
+    vtkSmartPointer<vtkIntArray> fieldIds = vtkSmartPointer<vtkIntArray>::New();
+    fieldIds->SetNumberOfComponents(1);
+    fieldIds->SetNumberOfTuples(fieldIds_.size());
+    fieldIds->SetName("FieldId");
+    for(SimplexId i = 0; i < (SimplexId)fieldIds_.size(); i++) {
+      fieldIds->SetTuple1(i, fieldIds_[i]);
+    }
+    output->GetPointData()->AddArray(fieldIds);
+  } else {
+    output->GetPointData()->RemoveArray("FieldId");
+  }
+
   if(VertexBoundary) {
     vtkSmartPointer<vtkCharArray> vertexBoundary
       = vtkSmartPointer<vtkCharArray>::New();
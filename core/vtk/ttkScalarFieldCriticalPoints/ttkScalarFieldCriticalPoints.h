@@ -12,6 +12,14 @@
 /// \param Input Input PL scalar field (vtkDataSet)
 /// \param Output Output critical points (vtkDataSet)
 ///
+/// In batch mode, the critical points of several scalar fields (all the
+/// components of all the selected arrays) are computed at once, re-using the
+/// pre-processing of the triangulation and distributing the fields among the
+/// threads on small meshes. The output then gathers the critical points of all
+/// the fields, with an additional "FieldId" array identifying the field of
+/// each point (fields are numbered component-wise, in the order of the
+/// selected arrays).
+///
 /// This filter can be used as any other VTK filter (for instance, by using the
 /// sequence of calls SetInputData(), Update(), GetOutput()).
 ///
@@ -103,6 +111,19 @@ public:
   vtkGetMacro(OffsetField, std::string);
   vtkSetMacro(OffsetField, std::string);
 
+  vtkGetMacro(BatchMode, bool);
+  vtkSetMacro(BatchMode, bool);
+
+  void SetBatchScalarFields(std::string s) {
+    BatchScalarFields.push_back(s);
+    Modified();
+  }
+
+  void ClearBatchScalarFields() {
+    BatchScalarFields.clear();
+    Modified();
+  }
+
   int FillOutputPortInformation(int port, vtkInformation *info) override {
     info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkUnstructuredGrid");
     return 1;
@@ -113,6 +134,10 @@ public:
                void *scalarValues,
                const ttk::SimplexId vertexNumber);
 
+  template <typename VTK_TT>
+  int dispatchBatch(ttk::Triangulation *triangulation,
+                    const std::vector<vtkDataArray *> &scalarFields);
+
 protected:
   ttkScalarFieldCriticalPoints();
 
@@ -124,10 +149,14 @@ private:
   bool ForceInputOffsetScalarField;
   int ScalarFieldId, OffsetFieldId;
   bool VertexIds, VertexScalars, VertexBoundary;
+  bool BatchMode;
   std::string ScalarField, OffsetField;
+  std::vector<std::string> BatchScalarFields;
   std::vector<std::vector<std::pair<ttk::SimplexId, ttk::SimplexId>>>
     vertexLinkEdgeList_;
   std::vector<std::pair<ttk::SimplexId, char>> criticalPoints_;
+  // batch mode: field of each critical point
+  std::vector<int> fieldIds_;
   std::vector<ttk::SimplexId> sosOffsets_;
 };
 
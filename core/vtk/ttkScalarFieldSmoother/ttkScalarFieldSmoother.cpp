@@ -16,6 +16,10 @@ vtkStandardNewMacro(ttkScalarFieldSmoother)
   outputScalarField_ = NULL;
 
   UseAllCores = true;
+
+  // the output shares the input mesh and the smoothing does not depend on
+  // the vertex identifiers
+  ReorderingSupported = true;
 }
 
 ttkScalarFieldSmoother::~ttkScalarFieldSmoother() {
@@ -9,6 +9,10 @@
 /// smooths an input scalar field by averaging the scalar values on the link
 /// of each vertex.
 ///
+/// Explicit input triangulations can be reordered to improve the memory
+/// locality of the smoothing (see SetReorderingMethod()), the output being
+/// mapped back to the input identifiers.
+///
 /// \param Input Input scalar field (vtkDataSet)
 /// \param Output Output scalar field (vtkDataSet)
 ///
@@ -15,6 +15,7 @@ vtkStandardNewMacro(ttkTopologicalSimplification)
   OffsetFieldId = -1;
   ForceInputOffsetScalarField = false;
   AddPerturbation = false;
+  UseLocalizedMode = false;
   OutputOffsetScalarFieldName = ttk::OffsetScalarFieldName;
   ForceInputVertexScalarField = false;
   InputVertexScalarFieldName = ttk::VertexScalarFieldName;
@@ -345,6 +346,7 @@ int ttkTopologicalSimplification::doIt(vector<vtkDataSet *> &inputs,
   topologicalSimplification_.setConsiderIdentifierAsBlackList(
     ConsiderIdentifierAsBlackList);
   topologicalSimplification_.setAddPerturbation(AddPerturbation);
+  topologicalSimplification_.setUseLocalizedMode(UseLocalizedMode);
 
   topologicalSimplification_.setInputOffsetScalarFieldPointer(
     inputOffsets_->GetVoidPointer(0));
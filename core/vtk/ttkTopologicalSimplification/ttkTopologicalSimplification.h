@@ -108,6 +108,9 @@ public:
   vtkSetMacro(AddPerturbation, int);
   vtkGetMacro(AddPerturbation, int);
 
+  vtkSetMacro(UseLocalizedMode, int);
+  vtkGetMacro(UseLocalizedMode, int);
+
   vtkSetMacro(InputOffsetScalarFieldName, std::string);
   vtkGetMacro(InputOffsetScalarFieldName, std::string);
 
@@ -152,6 +155,7 @@ private:
   bool PeriodicBoundaryConditions;
   bool ConsiderIdentifierAsBlackList;
   bool AddPerturbation;
+  bool UseLocalizedMode;
   bool hasUpdatedMesh_;
 
   ttk::TopologicalSimplification topologicalSimplification_;
@@ -265,6 +265,8 @@ int ttkTrackingFromOverlap::reset() {
 
   this->previousIterationData = nullptr;
 
+  this->trackingFromOverlap.clearCache();
+
   return 1;
 }
 
@@ -722,6 +724,8 @@ int ttkTrackingFromOverlap::RequestData(vtkInformation *request,
 
   // Set Wrapper
   this->trackingFromOverlap.setWrapper(this);
+  this->trackingFromOverlap.setPointMatching(
+    (ttk::TrackingFromOverlap::PointMatching)this->PointMatching);
 
   // Get Input Object
   vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
@@ -61,6 +61,9 @@ public:
     vtkSetMacro(LabelFieldName, string);
   vtkGetMacro(LabelFieldName, string);
 
+  vtkSetMacro(PointMatching, int);
+  vtkGetMacro(PointMatching, int);
+
   // default ttk setters
   vtkSetMacro(debugLevel_, int);
   void SetThreads() {
@@ -103,6 +106,7 @@ public:
 protected:
   ttkTrackingFromOverlap() {
     SetLabelFieldName("RegionId");
+    SetPointMatching(1);
 
     UseAllCores = false;
 
@@ -137,6 +141,7 @@ protected:
 private:
   int LabelDataType;
   string LabelFieldName;
+  int PointMatching;
   ttk::TrackingFromOverlap trackingFromOverlap;
 
   vtkSmartPointer<vtkMultiBlockDataSet> previousIterationData;
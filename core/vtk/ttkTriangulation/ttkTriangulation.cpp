@@ -305,6 +305,178 @@ int ttkTriangulation::setInputData(vtkDataSet *dataSet) {
   return 0;
 }
 
+int ttkTriangulation::reorderDataSet(
+  vtkDataSet *dataSet, const ExplicitTriangulation::ReorderingMethod &method) {
+
+  ttkTriangulation *ttkDataSet = dynamic_cast<ttkTriangulation *>(dataSet);
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if(!ttkDataSet)
+    return -1;
+#endif
+
+  if(method == ExplicitTriangulation::ReorderingMethod::NONE)
+    return 0;
+
+  vtkPointSet *pointSet = vtkPointSet::SafeDownCast(dataSet);
+  if((!pointSet) || (!pointSet->GetPoints()) || (!dataSet->GetNumberOfCells()))
+    return 0;
+
+  vtkUnstructuredGrid *unstructuredGrid
+    = vtkUnstructuredGrid::SafeDownCast(dataSet);
+  vtkPolyData *polyData = vtkPolyData::SafeDownCast(dataSet);
+
+  if((polyData)
+     && ((polyData->GetNumberOfVerts()) || (polyData->GetNumberOfStrips())
+         || ((polyData->GetNumberOfPolys())
+             && (polyData->GetNumberOfLines())))) {
+    Debug d;
+    stringstream msg;
+    msg << "[ttkTriangulation] Cannot reorder a vtkPolyData with mixed cell "
+        << "types." << endl;
+    d.dMsg(cerr, msg.str(), Debug::fatalMsg);
+    return -2;
+  }
+
+  // the triangulation may be shared with an upstream data-set: renumber a
+  // private one
+  if(!ttkDataSet->hasAllocated_) {
+    ttkDataSet->allocate();
+    ttkDataSet->setInputData(dataSet);
+  }
+
+  Timer t;
+
+  Triangulation *triangulation = ttkDataSet->triangulation_;
+  if(triangulation->reorder(method))
+    return -3;
+  if(!triangulation->isReordered())
+    return 0;
+
+  const SimplexId vertexNumber = triangulation->getNumberOfVertices();
+  const SimplexId cellNumber = triangulation->getNumberOfCells();
+
+  vtkPoints *inputPoints = pointSet->GetPoints();
+  vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+  points->SetDataType(inputPoints->GetDataType());
+  points->SetNumberOfPoints(vertexNumber);
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    points->SetPoint(
+      i, inputPoints->GetPoint(triangulation->getOriginalVertexId(i)));
+  }
+
+  // the triangulation stores the renumbered cells
+  vtkSmartPointer<vtkCellArray> cells = vtkSmartPointer<vtkCellArray>::New();
+  vector<int> cellTypes(unstructuredGrid ? cellNumber : 0);
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    const SimplexId cellSize = triangulation->getCellVertexNumber(i);
+    cells->InsertNextCell(cellSize);
+    for(int j = 0; j < cellSize; j++) {
+      SimplexId vertexId = -1;
+      triangulation->getCellVertex(i, j, vertexId);
+      cells->InsertCellPoint(vertexId);
+    }
+    if(unstructuredGrid) {
+      cellTypes[i]
+        = unstructuredGrid->GetCellType(triangulation->getOriginalCellId(i));
+    }
+  }
+
+  vtkSmartPointer<vtkPointData> pointData
+    = vtkSmartPointer<vtkPointData>::New();
+  pointData->CopyAllocate(dataSet->GetPointData(), vertexNumber);
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    pointData->CopyData(
+      dataSet->GetPointData(), triangulation->getOriginalVertexId(i), i);
+  }
+
+  vtkSmartPointer<vtkCellData> cellData = vtkSmartPointer<vtkCellData>::New();
+  cellData->CopyAllocate(dataSet->GetCellData(), cellNumber);
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    cellData->CopyData(
+      dataSet->GetCellData(), triangulation->getOriginalCellId(i), i);
+  }
+
+  pointSet->SetPoints(points);
+  if(unstructuredGrid) {
+    unstructuredGrid->SetCells(cellTypes.data(), cells);
+  } else if(polyData->GetNumberOfPolys()) {
+    polyData->SetPolys(cells);
+  } else {
+    polyData->SetLines(cells);
+  }
+  dataSet->GetPointData()->ShallowCopy(pointData);
+  dataSet->GetCellData()->ShallowCopy(cellData);
+
+  {
+    Debug d;
+    stringstream msg;
+    msg << "[ttkTriangulation] Data-set reordered in " << t.getElapsedTime()
+        << " s." << endl;
+    d.dMsg(cout, msg.str(), Debug::timeMsg);
+  }
+
+  return 0;
+}
+
+int ttkTriangulation::restoreDataSet(vtkDataSet *reorderedDataSet,
+                                     vtkDataSet *inputDataSet,
+                                     vtkDataSet *output) {
+
+#ifndef TTK_ENABLE_KAMIKAZE
+  if((!reorderedDataSet) || (!inputDataSet) || (!output))
+    return 0;
+#endif
+
+  ttkTriangulation *ttkDataSet
+    = dynamic_cast<ttkTriangulation *>(reorderedDataSet);
+  if((!ttkDataSet) || (!ttkDataSet->triangulation_)
+     || (!ttkDataSet->triangulation_->isReordered()))
+    return 0;
+
+  // only the outputs sharing the reordered points and cells
+  if(output->GetDataObjectType() != reorderedDataSet->GetDataObjectType())
+    return 0;
+  if(vtkPointSet::SafeDownCast(output)->GetPoints()
+     != vtkPointSet::SafeDownCast(reorderedDataSet)->GetPoints())
+    return 0;
+  if(output->GetDataObjectType() == VTK_UNSTRUCTURED_GRID) {
+    if(((vtkUnstructuredGrid *)output)->GetCells()
+       != ((vtkUnstructuredGrid *)reorderedDataSet)->GetCells())
+      return 0;
+  } else if((((vtkPolyData *)output)->GetPolys()
+             != ((vtkPolyData *)reorderedDataSet)->GetPolys())
+            || (((vtkPolyData *)output)->GetLines()
+                != ((vtkPolyData *)reorderedDataSet)->GetLines())) {
+    return 0;
+  }
+
+  Triangulation *triangulation = ttkDataSet->triangulation_;
+  const SimplexId vertexNumber = triangulation->getNumberOfVertices();
+  const SimplexId cellNumber = triangulation->getNumberOfCells();
+
+  vtkSmartPointer<vtkPointData> pointData
+    = vtkSmartPointer<vtkPointData>::New();
+  pointData->CopyAllocate(output->GetPointData(), vertexNumber);
+  for(SimplexId i = 0; i < vertexNumber; i++) {
+    pointData->CopyData(
+      output->GetPointData(), i, triangulation->getOriginalVertexId(i));
+  }
+
+  vtkSmartPointer<vtkCellData> cellData = vtkSmartPointer<vtkCellData>::New();
+  cellData->CopyAllocate(output->GetCellData(), cellNumber);
+  for(SimplexId i = 0; i < cellNumber; i++) {
+    cellData->CopyData(
+      output->GetCellData(), i, triangulation->getOriginalCellId(i));
+  }
+
+  output->CopyStructure(inputDataSet);
+  output->GetPointData()->ShallowCopy(pointData);
+  output->GetCellData()->ShallowCopy(cellData);
+
+  return 1;
+}
+
 int ttkTriangulation::shallowCopy(vtkDataObject *other) {
 
   if((triangulation_) && (hasAllocated_)) {
@@ -36,6 +36,15 @@
 /// must persist as long as their corresponding ttk::Triangulation object
 /// (unspecified behavior otherwise).
 ///
+/// Explicit triangulations can optionally be renumbered to improve the memory
+/// locality of the traversals (see reorderDataSet()). The TTK filters
+/// supporting it do it on their inputs when their reordering method is set
+/// (SetReorderingMethod()) and map their outputs back to the input
+/// identifiers (see restoreDataSet()). Only the filters whose outputs all
+/// share their input mesh and whose results do not depend on the vertex
+/// identifiers (for instance through offsets built from them) support it:
+/// the other ones keep the input order.
+///
 /// \note
 /// Only pre-process the information you need! See the
 /// ttk::Triangulation class documentation.
@@ -53,6 +62,7 @@
 
 // VTK includes
 #include <vtkCellArray.h>
+#include <vtkCellData.h>
 #include <vtkDataSet.h>
 #include <vtkDataSetAlgorithm.h>
 #include <vtkFiltersCoreModule.h>
@@ -60,6 +70,7 @@
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
 #include <vtkObjectFactory.h>
+#include <vtkPointData.h>
 #include <vtkPolyData.h>
 #include <vtkSmartPointer.h>
 #include <vtkUnstructuredGrid.h>
@@ -145,6 +156,36 @@ public:
   /// unspecified (well, this is a nice way to say it's gonna crash).
   int setInputData(vtkDataSet *dataSet);
 
+  /// Renumber the vertices and cells of a vtkUnstructuredGrid or vtkPolyData
+  /// object and of its ttk::Triangulation to improve the memory locality of
+  /// the traversals (see ttk::Triangulation::reorder()). The points, the
+  /// cells and the point and cell data arrays of \p dataSet are replaced by
+  /// reordered copies, the objects shared with other data-sets are not
+  /// modified. No effect on vtkImageData objects.
+  /// \param dataSet Input VTK object, which must be the output of a
+  /// ttkTriangulationFilter.
+  /// \param method Vertex ordering.
+  /// \return Returns 0 upon success, negative values otherwise.
+  /// \sa restoreDataSet()
+  static int reorderDataSet(
+    vtkDataSet *dataSet,
+    const ttk::ExplicitTriangulation::ReorderingMethod &method);
+
+  /// Map an output data-set back to the input identifiers if it shares the
+  /// points and cells of a data-set reordered with reorderDataSet(): its
+  /// point and cell data arrays are permuted back and its points and cells
+  /// are replaced by those of the input data-set. Other data-sets (for
+  /// instance critical points or other derived geometries) are not
+  /// modified.
+  /// \param reorderedDataSet Data-set reordered with reorderDataSet().
+  /// \param inputDataSet Data-set before reordering.
+  /// \param output Output data-set to map back.
+  /// \return Returns 1 if \p output has been mapped back, 0 if it does not
+  /// share the mesh of \p reorderedDataSet.
+  static int restoreDataSet(vtkDataSet *reorderedDataSet,
+                            vtkDataSet *inputDataSet,
+                            vtkDataSet *output);
+
 protected:
   int deepCopy(vtkDataObject *other);
 
@@ -5,6 +5,8 @@ using namespace ttk;
 
 vtkStandardNewMacro(ttkTriangulationFilter) // constructor
   ttkTriangulationFilter::ttkTriangulationFilter() {
+
+  ReorderingMethod = 0;
 }
 
 // transmit abort signals -- to copy paste in other wrappers
@@ -90,5 +92,18 @@ int ttkTriangulationFilter::RequestData(vtkInformation *request,
 
   output->ShallowCopy(input);
 
+  if(ReorderingMethod) {
+    if((ReorderingMethod < 0) || (ReorderingMethod > 2)
+       || (ttkTriangulation::reorderDataSet(
+            output,
+            (ExplicitTriangulation::ReorderingMethod)ReorderingMethod))) {
+      stringstream msg;
+      msg << "[ttkTriangulationFilter] Could not reorder the input, keeping "
+          << "the input order." << endl;
+      dMsg(cerr, msg.str(), Debug::infoMsg);
+      output->ShallowCopy(input);
+    }
+  }
+
   return 1;
 }
@@ -145,7 +145,20 @@ protected:                                                             \
 public:
 
 #define TTK_PIPELINE_REQUEST()                                                 \
+public:                                                                        \
+  void SetReorderingMethod(int method) {                                       \
+    if(ReorderingMethod != method) {                                           \
+      ReorderingMethod = method;                                               \
+      Modified();                                                              \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
 protected:                                                                     \
+  int ReorderingMethod{0};                                                     \
+  /* set by the filters whose outputs all share their input mesh and whose     \
+     results do not depend on the vertex identifiers (e.g. no offsets          \
+     built from them), the other ones ignore ReorderingMethod */               \
+  bool ReorderingSupported{false};                                             \
   std::vector<vtkSmartPointer<ttkTriangulationFilter>> inputTriangulations_;   \
   int RequestData(vtkInformation *request, vtkInformationVector **inputVector, \
                   vtkInformationVector *outputVector) override {               \
@@ -158,12 +171,22 @@ protected:                                                                     \
       }                                                                        \
     }                                                                          \
                                                                                \
+    int reorderingMethod = ReorderingMethod;                                   \
+    if((reorderingMethod) && (!ReorderingSupported)) {                         \
+      std::stringstream msg;                                                   \
+      msg << "[" << GetClassName() << "] Reordering not supported, keeping "   \
+          << "the input order." << std::endl;                                  \
+      dMsg(std::cerr, msg.str(), ttk::Debug::infoMsg);                         \
+      reorderingMethod = 0;                                                    \
+    }                                                                          \
+                                                                               \
     std::vector<vtkDataSet *> inputs(GetNumberOfInputPorts(), NULL);           \
     std::vector<vtkDataSet *> outputs(GetNumberOfOutputPorts(), NULL);         \
                                                                                \
     for(int i = 0; i < GetNumberOfInputPorts(); i++) {                         \
       vtkDataSet *input = vtkDataSet::GetData(inputVector[i]);                 \
       if(input) {                                                              \
+        inputTriangulations_[i]->SetReorderingMethod(reorderingMethod);        \
         inputTriangulations_[i]->SetInputData(input);                          \
         inputTriangulations_[i]->Update();                                     \
         inputs[i] = inputTriangulations_[i]->GetOutput();                      \
@@ -180,6 +203,19 @@ protected:                                                                     \
        && ((int)outputs.size() == GetNumberOfOutputPorts()))                   \
       doIt(inputs, outputs);                                                   \
                                                                                \
+    if(reorderingMethod) {                                                     \
+      /* map the outputs sharing a reordered input mesh back to the input      \
+         identifiers */                                                        \
+      for(int i = 0; i < GetNumberOfOutputPorts(); i++) {                      \
+        for(int j = 0; j < GetNumberOfInputPorts(); j++) {                     \
+          if((outputs[i]) && (inputs[j])                                       \
+             && (ttkTriangulation::restoreDataSet(                             \
+               inputs[j], vtkDataSet::GetData(inputVector[j]), outputs[i])))   \
+            break;                                                             \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
     return 1;                                                                  \
   }
 
@@ -226,10 +262,18 @@ public:
 
   vtkTypeMacro(ttkTriangulationFilter, vtkDataSetAlgorithm);
 
+  /// Vertex and cell ordering of the output explicit triangulations (0: input
+  /// order, 1: space-filling curve, 2: reverse Cuthill-McKee).
+  /// \sa ttkTriangulation::reorderDataSet()
+  vtkSetMacro(ReorderingMethod, int);
+  vtkGetMacro(ReorderingMethod, int);
+
 protected:
   ttkTriangulationFilter();
   ~ttkTriangulationFilter(){};
 
+  int ReorderingMethod;
+
   int RequestData(vtkInformation *request,
                   vtkInformationVector **inputVector,
                   vtkInformationVector *outputVector) override;
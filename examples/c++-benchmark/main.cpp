@@ -0,0 +1,336 @@
+/// \ingroup examples
+/// \date October 2019.
+///
+/// \brief Minimalist C++-only TTK benchmark of the triangulation
+/// data-structures: every relation of an implicit triangulation of a regular
+/// grid is materialized through the bulk accessors of ttk::Triangulation, for
+/// a few grid sizes.
+///
+/// With "-r", the grids are instead converted into explicit triangulations
+/// whose vertices and cells are randomly shuffled (as produced by
+/// unstructured mesh generators) and the merge tree (FTMTree) and discrete
+/// gradient computations are timed with each vertex reordering of
+/// ttk::Triangulation::reorder().
+
+// include the local headers
+#include <CommandLineParser.h>
+#include <DiscreteGradient.h>
+#include <FTMTree.h>
+#include <Triangulation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <random>
+
+// total number of entries of a relation (0 if not available)
+template <typename containerType>
+size_t relationSize(const std::vector<containerType> *relation) {
+  if(relation == nullptr)
+    return 0;
+  size_t res = 0;
+  for(const auto &r : *relation)
+    res += r.size();
+  return res;
+}
+
+template <>
+size_t relationSize(
+  const std::vector<std::pair<ttk::SimplexId, ttk::SimplexId>> *relation) {
+  return relation == nullptr ? 0 : 2 * relation->size();
+}
+
+int benchmark(const int size, const int dimension) {
+
+  ttk::Debug d;
+
+  ttk::Triangulation triangulation;
+  triangulation.setThreadNumber(ttk::globalThreadNumber_);
+  triangulation.setInputGrid(
+    0, 0, 0, 1, 1, 1, size, size, dimension == 3 ? size : 1);
+
+  {
+    std::stringstream msg;
+    msg << "[main::benchmark] Grid " << size << "^" << dimension << " ("
+        << triangulation.getNumberOfVertices() << " vertices, "
+        << triangulation.getNumberOfCells() << " cells, "
+        << ttk::globalThreadNumber_ << " thread(s))" << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  using relation = std::pair<std::string, std::function<size_t()>>;
+  auto &t = triangulation;
+
+  const std::vector<relation> relations{
+    {"vertex neighbors",
+     [&]() {
+       t.preprocessVertexNeighbors();
+       return relationSize(t.getVertexNeighbors());
+     }},
+    {"vertex edges",
+     [&]() {
+       t.preprocessVertexEdges();
+       return relationSize(t.getVertexEdges());
+     }},
+    {"vertex triangles",
+     [&]() {
+       t.preprocessVertexTriangles();
+       return relationSize(t.getVertexTriangles());
+     }},
+    {"vertex links",
+     [&]() {
+       t.preprocessVertexLinks();
+       return relationSize(t.getVertexLinks());
+     }},
+    {"vertex stars",
+     [&]() {
+       t.preprocessVertexStars();
+       return relationSize(t.getVertexStars());
+     }},
+    {"edges",
+     [&]() {
+       t.preprocessEdges();
+       return relationSize(t.getEdges());
+     }},
+    {"edge triangles",
+     [&]() {
+       t.preprocessEdgeTriangles();
+       return relationSize(t.getEdgeTriangles());
+     }},
+    {"edge links",
+     [&]() {
+       t.preprocessEdgeLinks();
+       return relationSize(t.getEdgeLinks());
+     }},
+    {"edge stars",
+     [&]() {
+       t.preprocessEdgeStars();
+       return relationSize(t.getEdgeStars());
+     }},
+    {"triangles",
+     [&]() {
+       t.preprocessTriangles();
+       return relationSize(t.getTriangles());
+     }},
+    {"triangle edges",
+     [&]() {
+       t.preprocessTriangleEdges();
+       return relationSize(t.getTriangleEdges());
+     }},
+    {"triangle links",
+     [&]() {
+       t.preprocessTriangleLinks();
+       return relationSize(t.getTriangleLinks());
+     }},
+    {"triangle stars",
+     [&]() {
+       t.preprocessTriangleStars();
+       return relationSize(t.getTriangleStars());
+     }},
+    {"cell edges",
+     [&]() {
+       t.preprocessCellEdges();
+       return relationSize(t.getCellEdges());
+     }},
+    {"cell triangles",
+     [&]() {
+       t.preprocessCellTriangles();
+       return relationSize(t.getCellTriangles());
+     }},
+    {"cell neighbors",
+     [&]() {
+       t.preprocessCellNeighbors();
+       return relationSize(t.getCellNeighbors());
+     }},
+  };
+
+  double total = 0;
+
+  for(const auto &r : relations) {
+    // skip the relations that do not exist in 2D
+    if(dimension == 2
+       && (r.first == "triangle links" || r.first == "triangle stars"
+           || r.first == "cell triangles"))
+      continue;
+
+    ttk::Timer timer;
+    const size_t entries = r.second();
+    const double elapsed = timer.getElapsedTime();
+    total += elapsed;
+
+    std::stringstream msg;
+    msg << "[main::benchmark]   " << std::left << std::setw(18) << r.first
+        << std::right << std::setw(12) << entries << " entries in "
+        << elapsed << " s." << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[main::benchmark] All relations materialized in " << total
+        << " s." << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  return 0;
+}
+
+int benchmarkReordering(const int size, const int dimension) {
+
+  ttk::Debug d;
+
+  // explicit copy of a triangulated grid, with shuffled vertices and cells
+  ttk::Triangulation grid;
+  grid.setInputGrid(0, 0, 0, 1, 1, 1, size, size, dimension == 3 ? size : 1);
+
+  const ttk::SimplexId vertexNumber = grid.getNumberOfVertices();
+  const ttk::SimplexId cellNumber = grid.getNumberOfCells();
+  const ttk::SimplexId cellSize = grid.getCellVertexNumber(0);
+
+  std::mt19937 generator(0);
+  std::vector<ttk::SimplexId> vertexShuffle(vertexNumber);
+  std::vector<ttk::SimplexId> cellShuffle(cellNumber);
+  std::iota(vertexShuffle.begin(), vertexShuffle.end(), 0);
+  std::iota(cellShuffle.begin(), cellShuffle.end(), 0);
+  std::shuffle(vertexShuffle.begin(), vertexShuffle.end(), generator);
+  std::shuffle(cellShuffle.begin(), cellShuffle.end(), generator);
+
+  std::vector<ttk::SimplexId> shuffledIds(vertexNumber);
+  for(ttk::SimplexId i = 0; i < vertexNumber; i++)
+    shuffledIds[vertexShuffle[i]] = i;
+
+  // a smooth scalar field with many critical points, and the vertex
+  // identifiers as offsets (simulation of simplicity)
+  std::vector<float> pointSet(3 * vertexNumber);
+  std::vector<float> scalars(vertexNumber);
+  std::vector<ttk::SimplexId> offsets(vertexNumber);
+  for(ttk::SimplexId i = 0; i < vertexNumber; i++) {
+    float *p = &pointSet[3 * i];
+    grid.getVertexPoint(vertexShuffle[i], p[0], p[1], p[2]);
+    scalars[i] = std::sin(0.3f * p[0]) * std::cos(0.2f * p[1])
+                 + std::sin(0.25f * (p[1] + p[2]));
+    offsets[i] = i;
+  }
+
+  std::vector<ttk::LongSimplexId> cellArray((cellSize + 1) * cellNumber);
+  for(ttk::SimplexId i = 0; i < cellNumber; i++) {
+    cellArray[(cellSize + 1) * i] = cellSize;
+    for(ttk::SimplexId j = 0; j < cellSize; j++) {
+      ttk::SimplexId v{};
+      grid.getCellVertex(cellShuffle[i], j, v);
+      cellArray[(cellSize + 1) * i + j + 1] = shuffledIds[v];
+    }
+  }
+
+  {
+    std::stringstream msg;
+    msg << "[main::benchmarkReordering] Shuffled grid " << size << "^"
+        << dimension << " (" << vertexNumber << " vertices, " << cellNumber
+        << " cells, " << ttk::globalThreadNumber_ << " thread(s))"
+        << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  using method
+    = std::pair<std::string, ttk::ExplicitTriangulation::ReorderingMethod>;
+  const std::vector<method> methods{
+    {"input order", ttk::ExplicitTriangulation::ReorderingMethod::NONE},
+    {"space-filling curve",
+     ttk::ExplicitTriangulation::ReorderingMethod::SPACE_FILLING_CURVE},
+    {"reverse Cuthill-McKee",
+     ttk::ExplicitTriangulation::ReorderingMethod::REVERSE_CUTHILL_MCKEE},
+  };
+
+  for(const auto &m : methods) {
+    ttk::Triangulation triangulation;
+    triangulation.setThreadNumber(ttk::globalThreadNumber_);
+    triangulation.setInputPoints(vertexNumber, pointSet.data());
+    triangulation.setInputCells(cellNumber, cellArray.data());
+
+    ttk::Timer reorderTimer;
+    triangulation.reorder(m.second);
+    std::vector<float> reorderedScalars(vertexNumber);
+    std::vector<ttk::SimplexId> reorderedOffsets(vertexNumber);
+    triangulation.reorderVertexData(scalars.data(), reorderedScalars.data());
+    triangulation.reorderVertexData(offsets.data(), reorderedOffsets.data());
+    const double reorderTime = reorderTimer.getElapsedTime();
+
+    // contour tree
+    ttk::Timer treeTimer;
+    ttk::ftm::FTMTree tree;
+    tree.setThreadNumber(ttk::globalThreadNumber_);
+    tree.setupTriangulation(&triangulation);
+    tree.setVertexScalars(reorderedScalars.data());
+    tree.setVertexSoSoffsets(reorderedOffsets.data());
+    tree.setTreeType(ttk::ftm::TreeType::Contour);
+    tree.setSegmentation(false);
+    tree.build<float, ttk::SimplexId>();
+    const double treeTime = treeTimer.getElapsedTime();
+
+    // the tree nodes, mapped back to the input vertex identifiers, do not
+    // depend on the reordering
+    auto contourTree = tree.getTree(ttk::ftm::TreeType::Contour);
+    const ttk::SimplexId nodeNumber = contourTree->getNumberOfNodes();
+    ttk::SimplexId nodeChecksum = 0;
+    for(ttk::SimplexId i = 0; i < nodeNumber; i++)
+      nodeChecksum ^= triangulation.getOriginalVertexId(
+        contourTree->getNode(i)->getVertexId());
+
+    // discrete gradient (relations materialized by setupTriangulation()
+    // included)
+    ttk::Timer gradientTimer;
+    ttk::dcg::DiscreteGradient gradient;
+    gradient.setThreadNumber(ttk::globalThreadNumber_);
+    gradient.setupTriangulation(&triangulation);
+    gradient.setInputScalarField(reorderedScalars.data());
+    gradient.setInputOffsets(reorderedOffsets.data());
+    gradient.buildGradient<float, ttk::SimplexId>();
+    const double gradientTime = gradientTimer.getElapsedTime();
+
+    std::vector<ttk::dcg::Cell> criticalCells;
+    gradient.getCriticalPoints(criticalCells);
+
+    std::stringstream msg;
+    msg << "[main::benchmarkReordering]   " << std::left << std::setw(22)
+        << m.first << std::right << " reorder " << std::setw(10)
+        << reorderTime << " s, FTMTree " << std::setw(10) << treeTime
+        << " s (" << nodeNumber << " nodes, checksum " << nodeChecksum
+        << "), DiscreteGradient " << std::setw(10) << gradientTime << " s ("
+        << criticalCells.size() << " critical cells)." << std::endl;
+    d.dMsg(std::cout, msg.str(), d.timeMsg);
+  }
+
+  return 0;
+}
+
+int main(int argc, char **argv) {
+
+  std::vector<int> sizes;
+  int dimension = 3;
+  bool reordering = false;
+  ttk::CommandLineParser parser;
+
+  ttk::globalDebugLevel_ = 1;
+
+  // register the arguments to the command line parser
+  parser.setArgument("s", &sizes, "Grid size (repeat for several sizes)", true);
+  parser.setArgument("D", &dimension, "Grid dimension (2 or 3)", true);
+  parser.setOption(
+    "r", &reordering, "Benchmark the reordering of shuffled explicit meshes");
+  // parse
+  parser.parse(argc, argv);
+
+  if(sizes.empty())
+    sizes = {32, 64, 128};
+
+  for(const auto size : sizes) {
+    if(reordering)
+      benchmarkReordering(size, dimension);
+    else
+      benchmark(size, dimension);
+  }
+
+  return 0;
+}